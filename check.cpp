@@ -0,0 +1,774 @@
+/*  lsrac regression check
+
+    usage: check [-t tolerance] [-w] [-v] [golden file]
+
+    Runs a corpus of synthetic signals through every engine and compares the output with the
+    golden outputs stored in check_golden.bin:
+
+        convert    lsrac_convert_audio() at every rate pair and signal, and with strided
+                   buffers, extra samples and each edge policy
+        stream     streams fed in odd sized chunks, at two quality presets and the Lanczos
+                   preview, with a mix, with dithered s16 output and with each
+                   accumulation mode
+        pool       stream pools of three streams
+        vstream    variable speed streams gliding from half to double speed
+        ranges     lsrac_plan_convert() over uneven ranges on several threads
+        batch      lsrac_batch_run() with segments small enough to spread over all workers
+
+    The threaded engines must give the same output as a stream, so they are compared with
+    the stream's golden outputs. Without -t every sample must be bit-identical, with -t the
+    largest absolute difference may be tolerance. -w rewrites the golden file from this
+    build's output, which should be the scalar build (make golden).
+
+    The signals are generated without libm, so the corpus is the same on every platform.
+    Exits with 1 if any output differs.
+
+*/
+
+#define LSRAC_IMPLEMENTATION
+#include "simple_raw_audio_converter.h"
+
+#define DR_WAV_IMPLEMENTATION
+#include "dr_wav.h"
+
+#define LSRAC_BATCH_IMPLEMENTATION
+#include "lsrac_batch.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+#define CHECK_SRC_FRAMES      256
+#define CHECK_CHUNK_FRAMES    37        // stream input per call
+#define CHECK_DST_FRAMES      29        // stream output per call
+#define CHECK_POOL_BLOCK      64
+#define CHECK_THREADS         4
+#define CHECK_SENTINEL        7.0f      // fills the channels a strided conversion must not touch
+
+static const char golden_magic[8] = { 'L', 'S', 'R', 'A', 'C', 'G', 'L', 'D' };
+
+static const uint32_t rates[][2] = {
+    { 44100, 48000 },
+    { 48000, 44100 },
+    { 8000,  48000 },
+    { 48000, 8000 },
+    { 96000, 44100 },
+    { 48000, 48000 },
+};
+
+// One output of the corpus. Results of different engines may share a golden output.
+struct result {
+    std::string         name;       // key of the golden output
+    std::string         engine;
+    bool                ran;
+    std::vector<float>  output;
+};
+
+/*
+ *  Signals
+ */
+
+static const double pi = 3.14159265358979323846;
+
+// sin() from basic arithmetic only, so the signals do not depend on the platform's libm.
+static double check_sin(double x)
+{
+    x -= 2.0 * pi * floor(x / (2.0 * pi) + 0.5);
+
+    double term = x;
+    double sum = x;
+    for (int k = 1; k < 16; ++k) {
+        term *= -x * x / static_cast<double>((2 * k) * (2 * k + 1));
+        sum += term;
+    }
+    return sum;
+}
+
+enum signal_kind {
+    SIGNAL_IMPULSE,
+    SIGNAL_SINE,
+    SIGNAL_CHIRP,
+    SIGNAL_NOISE,
+    SIGNAL_STEPS,
+    SIGNAL_COUNT,
+};
+
+static const char * signal_names[SIGNAL_COUNT] = { "impulse", "sine", "chirp", "noise", "steps" };
+
+static std::vector<float> make_signal(signal_kind kind, size_t frames)
+{
+    std::vector<float> x(frames, 0.0f);
+    uint32_t random = 0x12345678u;
+
+    for (size_t i = 0; i < frames; ++i) {
+        double t = static_cast<double>(i);
+        double n = static_cast<double>(frames);
+
+        switch (kind) {
+        case SIGNAL_IMPULSE:
+            x[i] = i == frames / 2 ? 1.0f : i == 3 ? -0.5f : 0.0f;
+            break;
+        case SIGNAL_SINE:
+            x[i] = static_cast<float>(0.7 * check_sin(2.0 * pi * 0.05 * t));
+            break;
+        case SIGNAL_CHIRP:
+            x[i] = static_cast<float>(0.8 * check_sin(pi * (0.01 + 0.45 * t / n) * t));
+            break;
+        case SIGNAL_NOISE:
+            random = random * 1664525u + 1013904223u;
+            x[i] = static_cast<float>((static_cast<double>(random >> 8) / 16777216.0 - 0.5) * 1.8);
+            break;
+        case SIGNAL_STEPS:
+            x[i] = 3 * i < frames ? -0.5f : 3 * i < 2 * frames ? 0.75f : 0.25f;
+            break;
+        default:
+            break;
+        }
+    }
+
+    return x;
+}
+
+static std::string rate_name(size_t r)
+{
+    char name[32];
+    snprintf(name, sizeof(name), "%u>%u", rates[r][0], rates[r][1]);
+    return name;
+}
+
+/*
+ *  Engines
+ */
+
+static result convert_case(size_t r, signal_kind kind, uint32_t stride, int32_t before, int32_t after, uint32_t edge)
+{
+    static const char * edge_names[] = { "renormalize", "zero", "reflect", "clamp" };
+
+    result res;
+    res.name = "convert " + rate_name(r) + " " + signal_names[kind];
+    if (stride != 1 || before != 0 || after != 0 || edge != LSRAC_EDGE_RENORMALIZE) {
+        char variant[64];
+        snprintf(variant, sizeof(variant), " stride %u extra %d/%d %s", stride, before, after, edge_names[edge]);
+        res.name += variant;
+    }
+    res.engine = "convert";
+
+    uint64_t src_samples = CHECK_SRC_FRAMES;
+    uint64_t dst_samples = src_samples * rates[r][1] / rates[r][0];
+
+    // The signal is read from channel 1 of stride interleaved channels, its extra samples
+    // around it
+    std::vector<float> signal = make_signal(kind, src_samples + before + after);
+    std::vector<float> src(signal.size() * stride, CHECK_SENTINEL);
+    std::vector<float> dst(dst_samples * stride, CHECK_SENTINEL);
+    uint32_t channel = stride > 1 ? 1 : 0;
+
+    for (size_t i = 0; i < signal.size(); ++i) {
+        src[i * stride + channel] = signal[i];
+    }
+
+    res.ran = lsrac_convert_audio_edge(dst.data() + channel, src.data() + static_cast<size_t>(before) * stride + channel,
+                                       dst_samples, src_samples, stride * sizeof(float), stride * sizeof(float),
+                                       before, after, edge) == LSRAC_RET_VAL_OK;
+
+    res.output.resize(dst_samples);
+    for (size_t i = 0; i < dst.size(); ++i) {
+        if (i % stride == channel) {
+            res.output[i / stride] = dst[i];
+        } else if (dst[i] != CHECK_SENTINEL) {
+            res.ran = false;
+        }
+    }
+
+    return res;
+}
+
+// Two channels (chirp and noise) through a stream, in chunks that never line up with
+// anything. mix_gains, if set, mixes them to two other channels, s16 dithers the output.
+static result stream_case(size_t r, uint32_t quality, const float * mix_gains, bool s16, uint32_t accumulation)
+{
+    static const char * quality_names[] = { "best", "high", "medium", "fast", "preview" };
+    static const char * accumulation_names[] = { "", " pairwise", " kahan" };
+
+    result res;
+    res.name = "stream " + rate_name(r) + " " + quality_names[quality];
+    if (mix_gains != nullptr) {
+        res.name += " mix";
+    }
+    if (s16) {
+        res.name += " s16";
+    }
+    res.name += accumulation_names[accumulation];
+    res.engine = "stream";
+    res.ran = false;
+
+    lsrac_plan_t plan;
+    if (lsrac_plan_init(&plan, rates[r][0], rates[r][1], 2, nullptr) != LSRAC_RET_VAL_OK ||
+        lsrac_plan_set_quality(&plan, quality) != LSRAC_RET_VAL_OK ||
+        lsrac_plan_set_accumulation(&plan, accumulation) != LSRAC_RET_VAL_OK ||
+        (mix_gains != nullptr && lsrac_plan_set_mix(&plan, 2, mix_gains) != LSRAC_RET_VAL_OK)) {
+        return res;
+    }
+
+    std::vector<float> chirp = make_signal(SIGNAL_CHIRP, CHECK_SRC_FRAMES);
+    std::vector<float> noise = make_signal(SIGNAL_NOISE, CHECK_SRC_FRAMES);
+    std::vector<float> src(2 * CHECK_SRC_FRAMES);
+    for (size_t i = 0; i < CHECK_SRC_FRAMES; ++i) {
+        src[2 * i] = chirp[i];
+        src[2 * i + 1] = noise[i];
+    }
+
+    uint64_t dst_total = lsrac_plan_dst_frames(&plan, CHECK_SRC_FRAMES);
+    std::vector<float> dst_f32(2 * dst_total);
+    std::vector<int16_t> dst_s16(2 * dst_total);
+
+    lsrac_stream_t stream;
+    lsrac_stream_init(&stream, &plan, nullptr);
+    if (s16) {
+        lsrac_stream_set_output(&stream, 1.0f, LSRAC_OUTPUT_DITHER | LSRAC_OUTPUT_NOISE_SHAPING);
+    }
+
+    lsrac_buffer_t src_buffer;
+    lsrac_buffer_t dst_buffer;
+    lsrac_buffer_interleaved(&src_buffer, src.data(), 2, LSRAC_FORMAT_F32);
+    if (s16) {
+        lsrac_buffer_interleaved(&dst_buffer, dst_s16.data(), 2, LSRAC_FORMAT_S16);
+    } else {
+        lsrac_buffer_interleaved(&dst_buffer, dst_f32.data(), 2, LSRAC_FORMAT_F32);
+    }
+
+    uint64_t read_total = 0;
+    uint64_t written_total = 0;
+    bool stuck = false;
+
+    while (read_total < CHECK_SRC_FRAMES && !stuck) {
+        uint64_t src_frames = CHECK_SRC_FRAMES - read_total < CHECK_CHUNK_FRAMES ? CHECK_SRC_FRAMES - read_total : CHECK_CHUNK_FRAMES;
+        uint64_t dst_frames = dst_total - written_total < CHECK_DST_FRAMES ? dst_total - written_total : CHECK_DST_FRAMES;
+        uint64_t read = 0;
+        uint64_t written = 0;
+        lsrac_stream_process_buffers(&stream, &dst_buffer, dst_frames, &written, &src_buffer, src_frames, &read);
+        lsrac_buffer_advance(&src_buffer, read);
+        lsrac_buffer_advance(&dst_buffer, written);
+        read_total += read;
+        written_total += written;
+        stuck = read == 0 && written == 0;
+    }
+
+    while (written_total < dst_total && !stuck) {
+        uint64_t dst_frames = dst_total - written_total < CHECK_DST_FRAMES ? dst_total - written_total : CHECK_DST_FRAMES;
+        uint64_t written = 0;
+        lsrac_stream_flush_buffers(&stream, &dst_buffer, dst_frames, &written);
+        lsrac_buffer_advance(&dst_buffer, written);
+        written_total += written;
+        stuck = written == 0;
+    }
+
+    lsrac_stream_uninit(&stream);
+    lsrac_plan_uninit(&plan);
+
+    res.ran = !stuck && written_total == dst_total;
+    if (s16) {
+        res.output.resize(dst_s16.size());
+        for (size_t i = 0; i < dst_s16.size(); ++i) {
+            res.output[i] = static_cast<float>(dst_s16[i]) / 32768.0f;
+        }
+    } else {
+        res.output = dst_f32;
+    }
+
+    return res;
+}
+
+// Three streams (impulse, sine and noise) in one pool. Silence follows the signals, so
+// their ends come out of the filter; the streams' outputs are stored one after the other.
+static result pool_case(size_t r)
+{
+    result res;
+    res.name = "pool " + rate_name(r);
+    res.engine = "pool";
+    res.ran = false;
+
+    lsrac_plan_t plan;
+    if (lsrac_plan_init(&plan, rates[r][0], rates[r][1], 1, nullptr) != LSRAC_RET_VAL_OK) {
+        return res;
+    }
+
+    lsrac_pool_t pool;
+    if (lsrac_pool_init(&pool, &plan, 3, CHECK_POOL_BLOCK, nullptr) != LSRAC_RET_VAL_OK) {
+        lsrac_plan_uninit(&plan);
+        return res;
+    }
+
+    std::vector<float> signals[3] = {
+        make_signal(SIGNAL_IMPULSE, CHECK_SRC_FRAMES),
+        make_signal(SIGNAL_SINE, CHECK_SRC_FRAMES),
+        make_signal(SIGNAL_NOISE, CHECK_SRC_FRAMES),
+    };
+    std::vector<float> blocks[3];
+    std::vector<float> outs[3];
+    std::vector<float> collected[3];
+    float * dst_pointers[3];
+    const float * src_pointers[3];
+
+    for (uint32_t s = 0; s < 3; ++s) {
+        uint32_t index = 0;
+        lsrac_pool_add_stream(&pool, &index);
+        blocks[s].resize(CHECK_POOL_BLOCK);
+        outs[s].resize(static_cast<size_t>(lsrac_pool_max_dst_frames(&pool)));
+        dst_pointers[index] = outs[s].data();
+        src_pointers[index] = blocks[s].data();
+    }
+
+    size_t padded = CHECK_SRC_FRAMES + 4 * CHECK_POOL_BLOCK;
+
+    for (size_t offset = 0; offset < padded; offset += CHECK_POOL_BLOCK) {
+        for (uint32_t s = 0; s < 3; ++s) {
+            for (size_t i = 0; i < CHECK_POOL_BLOCK; ++i) {
+                blocks[s][i] = offset + i < CHECK_SRC_FRAMES ? signals[s][offset + i] : 0.0f;
+            }
+        }
+
+        uint64_t written = 0;
+        lsrac_pool_process_all(&pool, dst_pointers, src_pointers, &written);
+
+        for (uint32_t s = 0; s < 3; ++s) {
+            collected[s].insert(collected[s].end(), outs[s].begin(), outs[s].begin() + static_cast<ptrdiff_t>(written));
+        }
+    }
+
+    for (uint32_t s = 0; s < 3; ++s) {
+        res.output.insert(res.output.end(), collected[s].begin(), collected[s].end());
+    }
+    res.ran = true;
+
+    lsrac_pool_uninit(&pool);
+    lsrac_plan_uninit(&plan);
+
+    return res;
+}
+
+// Two channels through a variable speed stream that glides from speed 0.5 to 2 over the
+// output, fed in the same odd chunks as the stream cases.
+static result vstream_case(size_t r)
+{
+    result res;
+    res.name = "vstream " + rate_name(r) + " glide";
+    res.engine = "vstream";
+    res.ran = false;
+
+    lsrac_plan_t plan;
+    if (lsrac_plan_init(&plan, rates[r][0], rates[r][1], 2, nullptr) != LSRAC_RET_VAL_OK) {
+        return res;
+    }
+
+    lsrac_vstream_t vstream;
+    if (lsrac_vstream_init(&vstream, &plan, 2.0f, nullptr) != LSRAC_RET_VAL_OK) {
+        lsrac_plan_uninit(&plan);
+        return res;
+    }
+
+    std::vector<float> chirp = make_signal(SIGNAL_CHIRP, CHECK_SRC_FRAMES);
+    std::vector<float> noise = make_signal(SIGNAL_NOISE, CHECK_SRC_FRAMES);
+    std::vector<float> src(2 * CHECK_SRC_FRAMES);
+    for (size_t i = 0; i < CHECK_SRC_FRAMES; ++i) {
+        src[2 * i] = chirp[i];
+        src[2 * i + 1] = noise[i];
+    }
+
+    uint64_t dst_capacity = 2 * lsrac_plan_dst_frames(&plan, CHECK_SRC_FRAMES) + 2;
+    std::vector<float> dst(2 * dst_capacity);
+
+    lsrac_vstream_set_speed(&vstream, 0.5f, 0);
+    lsrac_vstream_set_speed(&vstream, 2.0f, lsrac_plan_dst_frames(&plan, CHECK_SRC_FRAMES) / 2);
+
+    uint64_t read_total = 0;
+    uint64_t written_total = 0;
+    bool stuck = false;
+
+    while (read_total < CHECK_SRC_FRAMES && !stuck) {
+        uint64_t src_frames = CHECK_SRC_FRAMES - read_total < CHECK_CHUNK_FRAMES ? CHECK_SRC_FRAMES - read_total : CHECK_CHUNK_FRAMES;
+        uint64_t dst_frames = dst_capacity - written_total < CHECK_DST_FRAMES ? dst_capacity - written_total : CHECK_DST_FRAMES;
+        uint64_t read = 0;
+        uint64_t written = 0;
+        lsrac_vstream_process(&vstream, dst.data() + 2 * written_total, dst_frames, &written,
+                              src.data() + 2 * read_total, src_frames, &read, nullptr);
+        read_total += read;
+        written_total += written;
+        stuck = read == 0 && written == 0;
+    }
+
+    for (uint64_t flushed = 1; flushed != 0 && !stuck;) {
+        uint64_t dst_frames = dst_capacity - written_total < CHECK_DST_FRAMES ? dst_capacity - written_total : CHECK_DST_FRAMES;
+        lsrac_vstream_flush(&vstream, dst.data() + 2 * written_total, dst_frames, &flushed, nullptr);
+        written_total += flushed;
+        stuck = dst_frames == 0;
+    }
+
+    dst.resize(2 * written_total);
+    res.output = dst;
+    res.ran = !stuck;
+
+    lsrac_vstream_uninit(&vstream);
+    lsrac_plan_uninit(&plan);
+
+    return res;
+}
+
+// The stream best case, converted by CHECK_THREADS threads in ranges of uneven length.
+static result ranges_case(size_t r)
+{
+    result res;
+    res.name = "stream " + rate_name(r) + " best";
+    res.engine = "ranges";
+    res.ran = false;
+
+    lsrac_plan_t plan;
+    if (lsrac_plan_init(&plan, rates[r][0], rates[r][1], 2, nullptr) != LSRAC_RET_VAL_OK) {
+        return res;
+    }
+
+    std::vector<float> chirp = make_signal(SIGNAL_CHIRP, CHECK_SRC_FRAMES);
+    std::vector<float> noise = make_signal(SIGNAL_NOISE, CHECK_SRC_FRAMES);
+    std::vector<float> src(2 * CHECK_SRC_FRAMES);
+    for (size_t i = 0; i < CHECK_SRC_FRAMES; ++i) {
+        src[2 * i] = chirp[i];
+        src[2 * i + 1] = noise[i];
+    }
+
+    uint64_t dst_total = lsrac_plan_dst_frames(&plan, CHECK_SRC_FRAMES);
+    res.output.resize(2 * dst_total);
+
+    // Range k ends at (k + 1)^2 / CHECK_THREADS^2 of the output
+    uint64_t bounds[CHECK_THREADS + 1];
+    for (uint64_t k = 0; k <= CHECK_THREADS; ++k) {
+        bounds[k] = dst_total * k * k / (CHECK_THREADS * CHECK_THREADS);
+    }
+
+    int32_t results[CHECK_THREADS];
+    std::vector<std::thread> threads;
+
+    for (uint32_t k = 0; k < CHECK_THREADS; ++k) {
+        threads.emplace_back([&, k]() {
+            uint64_t src_first = 0;
+            uint64_t src_end = 0;
+            lsrac_plan_src_window(&plan, bounds[k], bounds[k + 1] - bounds[k], &src_first, &src_end);
+            if (src_end > CHECK_SRC_FRAMES) {
+                src_end = CHECK_SRC_FRAMES;
+            }
+            if (src_first > src_end) {
+                src_first = src_end;
+            }
+            results[k] = lsrac_plan_convert(&plan, res.output.data() + 2 * bounds[k], src.data() + 2 * src_first,
+                                            bounds[k], src_first, bounds[k + 1] - bounds[k], src_end - src_first,
+                                            CHECK_SRC_FRAMES);
+        });
+    }
+
+    res.ran = true;
+    for (uint32_t k = 0; k < CHECK_THREADS; ++k) {
+        threads[k].join();
+        res.ran = res.ran && results[k] == LSRAC_RET_VAL_OK;
+    }
+
+    lsrac_plan_uninit(&plan);
+
+    return res;
+}
+
+// The stream best cases of every rate pair as one batch of f32 wav files.
+static void batch_cases(std::vector<result> & results)
+{
+    const size_t count = ARRAY_COUNT(rates);
+
+    std::vector<float> chirp = make_signal(SIGNAL_CHIRP, CHECK_SRC_FRAMES);
+    std::vector<float> noise = make_signal(SIGNAL_NOISE, CHECK_SRC_FRAMES);
+    std::vector<float> src(2 * CHECK_SRC_FRAMES);
+    for (size_t i = 0; i < CHECK_SRC_FRAMES; ++i) {
+        src[2 * i] = chirp[i];
+        src[2 * i + 1] = noise[i];
+    }
+
+    std::vector<std::string> src_paths(count);
+    std::vector<std::string> dst_paths(count);
+    std::vector<lsrac_batch_job_t> jobs(count);
+    bool written = true;
+
+    for (size_t r = 0; r < count; ++r) {
+        src_paths[r] = "check_src_" + std::to_string(r) + ".wav";
+        dst_paths[r] = "check_dst_" + std::to_string(r) + ".wav";
+
+        FILE * file = fopen(src_paths[r].c_str(), "wb");
+        written = written &&
+                  file != nullptr &&
+                  lsrac_batch_write_wav_header(file, 2, rates[r][0], LSRAC_FORMAT_F32, CHECK_SRC_FRAMES) == LSRAC_RET_VAL_OK &&
+                  fwrite(src.data(), sizeof(float), src.size(), file) == src.size();
+        if (file != nullptr) {
+            fclose(file);
+        }
+
+        memset(&jobs[r], 0, sizeof(jobs[r]));
+        jobs[r].src_path   = src_paths[r].c_str();
+        jobs[r].dst_path   = dst_paths[r].c_str();
+        jobs[r].dst_rate   = rates[r][1];
+        jobs[r].dst_format = LSRAC_FORMAT_F32;
+        jobs[r].gain       = 1.0f;
+        jobs[r].quality    = LSRAC_QUALITY_BEST;
+    }
+
+    lsrac_batch_options_t options;
+    lsrac_batch_default_options(&options);
+    options.threads        = CHECK_THREADS;
+    options.segment_frames = 48;
+    options.chunk_frames   = 32;
+
+    bool ran = written && lsrac_batch_run(jobs.data(), jobs.size(), &options, nullptr) == LSRAC_RET_VAL_OK;
+
+    for (size_t r = 0; r < count; ++r) {
+        result res;
+        res.name = "stream " + rate_name(r) + " best";
+        res.engine = "batch";
+        res.ran = false;
+
+        drwav * wav = ran ? drwav_open_file(dst_paths[r].c_str()) : nullptr;
+        if (wav != nullptr) {
+            res.output.resize(static_cast<size_t>(wav->totalSampleCount));
+            res.ran = drwav_read_f32(wav, wav->totalSampleCount, res.output.data()) == wav->totalSampleCount;
+            drwav_close(wav);
+        }
+
+        results.push_back(res);
+
+        remove(src_paths[r].c_str());
+        remove(dst_paths[r].c_str());
+    }
+}
+
+static std::vector<result> run_corpus()
+{
+    std::vector<result> results;
+
+    for (size_t r = 0; r < ARRAY_COUNT(rates); ++r) {
+        for (int kind = 0; kind < SIGNAL_COUNT; ++kind) {
+            results.push_back(convert_case(r, static_cast<signal_kind>(kind), 1, 0, 0, LSRAC_EDGE_RENORMALIZE));
+        }
+        for (uint32_t edge = LSRAC_EDGE_ZERO; edge <= LSRAC_EDGE_CLAMP; ++edge) {
+            results.push_back(convert_case(r, SIGNAL_CHIRP, 3, 8, 5, edge));
+        }
+        results.push_back(convert_case(r, SIGNAL_STEPS, 2, 0, 3, LSRAC_EDGE_RENORMALIZE));
+    }
+
+    static const float mix_gains[4] = { 0.5f, 0.5f, 0.9f, -0.4f };
+
+    for (size_t r = 0; r < ARRAY_COUNT(rates); ++r) {
+        results.push_back(stream_case(r, LSRAC_QUALITY_BEST, nullptr, false, LSRAC_ACCUMULATE_SERIAL));
+        results.push_back(stream_case(r, LSRAC_QUALITY_FAST, nullptr, false, LSRAC_ACCUMULATE_SERIAL));
+    }
+    results.push_back(stream_case(0, LSRAC_QUALITY_BEST, mix_gains, false, LSRAC_ACCUMULATE_SERIAL));
+    results.push_back(stream_case(3, LSRAC_QUALITY_HIGH, mix_gains, false, LSRAC_ACCUMULATE_SERIAL));
+    results.push_back(stream_case(1, LSRAC_QUALITY_BEST, nullptr, true, LSRAC_ACCUMULATE_SERIAL));
+    for (uint32_t accumulation = LSRAC_ACCUMULATE_PAIRWISE; accumulation <= LSRAC_ACCUMULATE_KAHAN; ++accumulation) {
+        results.push_back(stream_case(0, LSRAC_QUALITY_BEST, nullptr, false, accumulation));
+        results.push_back(stream_case(3, LSRAC_QUALITY_MEDIUM, mix_gains, false, accumulation));
+    }
+    results.push_back(stream_case(2, LSRAC_QUALITY_PREVIEW, nullptr, false, LSRAC_ACCUMULATE_SERIAL));
+
+    for (size_t r = 0; r < ARRAY_COUNT(rates); ++r) {
+        results.push_back(pool_case(r));
+    }
+
+    for (size_t r = 0; r < ARRAY_COUNT(rates); ++r) {
+        results.push_back(vstream_case(r));
+    }
+
+    for (size_t r = 0; r < ARRAY_COUNT(rates); ++r) {
+        results.push_back(ranges_case(r));
+    }
+
+    batch_cases(results);
+
+    return results;
+}
+
+/*
+ *  Golden file: magic, case count, then per case the name length, the name, the sample
+ *  count and the samples, all little endian.
+ */
+
+typedef std::map<std::string, std::vector<float> > golden_t;
+
+static bool write_golden(const char * path, const std::vector<result> & results)
+{
+    golden_t seen;
+    std::vector<const result *> owners;
+    for (const result & res : results) {
+        if (seen.find(res.name) == seen.end()) {
+            seen[res.name] = res.output;
+            owners.push_back(&res);
+        }
+    }
+
+    FILE * file = fopen(path, "wb");
+    if (file == nullptr) {
+        return false;
+    }
+
+    uint32_t count = static_cast<uint32_t>(owners.size());
+    bool ok = fwrite(golden_magic, sizeof(golden_magic), 1, file) == 1 &&
+              fwrite(&count, sizeof(count), 1, file) == 1;
+
+    for (const result * res : owners) {
+        uint32_t name_length = static_cast<uint32_t>(res->name.size());
+        uint64_t samples = res->output.size();
+        ok = ok &&
+             fwrite(&name_length, sizeof(name_length), 1, file) == 1 &&
+             fwrite(res->name.data(), 1, name_length, file) == name_length &&
+             fwrite(&samples, sizeof(samples), 1, file) == 1 &&
+             fwrite(res->output.data(), sizeof(float), samples, file) == samples;
+    }
+
+    fclose(file);
+    return ok;
+}
+
+static bool read_golden(const char * path, golden_t & golden)
+{
+    FILE * file = fopen(path, "rb");
+    if (file == nullptr) {
+        return false;
+    }
+
+    char magic[sizeof(golden_magic)];
+    uint32_t count = 0;
+    bool ok = fread(magic, sizeof(magic), 1, file) == 1 &&
+              memcmp(magic, golden_magic, sizeof(magic)) == 0 &&
+              fread(&count, sizeof(count), 1, file) == 1;
+
+    for (uint32_t i = 0; i < count && ok; ++i) {
+        uint32_t name_length = 0;
+        uint64_t samples = 0;
+        ok = fread(&name_length, sizeof(name_length), 1, file) == 1 && name_length < 256;
+        std::string name(ok ? name_length : 0, ' ');
+        ok = ok &&
+             fread(&name[0], 1, name_length, file) == name_length &&
+             fread(&samples, sizeof(samples), 1, file) == 1 &&
+             samples < (1u << 24);
+        std::vector<float> & output = golden[name];
+        output.resize(ok ? static_cast<size_t>(samples) : 0);
+        ok = ok && fread(output.data(), sizeof(float), output.size(), file) == output.size();
+    }
+
+    fclose(file);
+    return ok;
+}
+
+static bool is_little_endian()
+{
+    volatile uint32_t i = 0x01234567;
+    return (*((uint8_t*)(&i))) == 0x67;
+}
+
+int main(int argc, char ** argv)
+{
+    const char * path = "check_golden.bin";
+    bool write = false;
+    bool verbose = false;
+    double tolerance = 0.0;
+
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "-w") == 0) {
+            write = true;
+        } else if (strcmp(argv[i], "-v") == 0) {
+            verbose = true;
+        } else if (strcmp(argv[i], "-t") == 0 && i + 1 < argc) {
+            tolerance = atof(argv[++i]);
+        } else {
+            path = argv[i];
+        }
+    }
+
+    if (!is_little_endian()) {
+        printf("check: the golden file is little endian\n");
+        return 1;
+    }
+
+#if defined(LSRAC__SSE)
+    std::string build = "sse2";
+#elif defined(LSRAC__NEON)
+    std::string build = "neon";
+#else
+    std::string build = "scalar";
+#endif
+    if (LSRAC_PHASE_TABLE_MAX_TAPS == 0) {
+        build += " untiled";
+    }
+
+    std::vector<result> results = run_corpus();
+
+    if (write && !write_golden(path, results)) {
+        printf("check: could not write %s\n", path);
+        return 1;
+    }
+
+    golden_t golden;
+    if (!read_golden(path, golden)) {
+        printf("check: could not read %s (make golden writes it)\n", path);
+        return 1;
+    }
+
+    int failures = 0;
+
+    for (const result & res : results) {
+        golden_t::const_iterator expected = golden.find(res.name);
+
+        const char * status = "ok";
+        double max_difference = 0.0;
+
+        if (!res.ran) {
+            status = "did not run";
+        } else if (expected == golden.end()) {
+            status = "no golden output (make golden)";
+        } else if (expected->second.size() != res.output.size()) {
+            status = "length differs";
+        } else if (tolerance == 0.0) {
+            if (memcmp(expected->second.data(), res.output.data(), sizeof(float) * res.output.size()) != 0) {
+                status = "not bit-identical";
+            }
+        } else {
+            for (size_t i = 0; i < res.output.size(); ++i) {
+                double difference = fabs(static_cast<double>(res.output[i]) - static_cast<double>(expected->second[i]));
+                max_difference = difference > max_difference ? difference : max_difference;
+            }
+            if (!(max_difference <= tolerance)) {
+                status = "outside tolerance";
+            }
+        }
+
+        bool ok = strcmp(status, "ok") == 0;
+        if (!ok) {
+            failures++;
+        }
+
+        if (verbose || !ok) {
+            printf("%-7s %-55s %s", res.engine.c_str(), res.name.c_str(), status);
+            if (tolerance != 0.0) {
+                printf(" (max difference %g)", max_difference);
+            }
+            printf("\n");
+        }
+    }
+
+    if (failures != 0) {
+        printf("%s build: %d of %zu outputs differ from %s\n", build.c_str(), failures, results.size(), path);
+        return 1;
+    }
+
+    printf("%s build: all %zu outputs match %s%s\n", build.c_str(), results.size(), path,
+           tolerance == 0.0 ? " bit for bit" : " within tolerance");
+    return 0;
+}
@@ -49,6 +49,18 @@
 //
 //     drwav_free(pSampleData);
 //
+// To process a file of any size in a fixed amount of memory, use the chunked variants instead. These decode into a buffer
+// you own and pass every block to a callback:
+//
+//     drwav_bool32 on_chunk(void* pUserData, const float* pSamples, drwav_uint64 sampleCount, unsigned int channels, unsigned int sampleRate)
+//     {
+//         ...
+//         return DRWAV_TRUE;  // Keep going.
+//     }
+//
+//     float buffer[4096];
+//     drwav_open_and_read_file_chunked_f32("my_song.wav", buffer, 4096, on_chunk, pMyUserData, &totalSampleCount);
+//
 // The examples above use versions of the API that convert the audio data to a consistent format (32-bit signed PCM, in
 // this case), but you can still output the audio data in it's internal format (see notes below for supported formats):
 //
@@ -74,6 +86,10 @@
 // #define DR_WAV_NO_STDIO
 //   Disables drwav_open_file().
 //
+// #define DR_WAV_NO_SIMD
+//   Disables the SSE2/SSSE3/AVX2/NEON implementations of the sample format conversion routines. Which of these are used
+//   is decided at compile time (-msse2, -mavx2, etc.), and the results are identical to the scalar code either way.
+//
 //
 //
 // QUICK NOTES
@@ -372,8 +388,24 @@ size_t drwav_read_raw(drwav* pWav, size_t bytesToRead, void* pBufferOut);
 // using a compressed format consider using drwav_read_raw() or drwav_read_s16/s32/f32/etc().
 drwav_uint64 drwav_read(drwav* pWav, drwav_uint64 samplesToRead, void* pBufferOut);
 
+// The number of samples (not frames) in each block of MS ADPCM or DVI ADPCM data, or 0 for formats that are not
+// stored in blocks of fmt.blockAlign bytes.
+drwav_uint64 drwav_samples_per_block(drwav* pWav);
+
+// Reads whole blocks of MS ADPCM or DVI ADPCM data without decoding them, for drwav_decode_blocks_s16(). Reading has
+// to be at the start of a block, which is where drwav_seek_to_sample() and drwav_read_s16() and friends leave it after
+// a multiple of drwav_samples_per_block() samples.
+//
+// Returns the number of blocks read. The read position moves past them, up to the end of the samples. When the data
+// ends within a block, the read position stays at the start of that block.
+drwav_uint64 drwav_read_raw_blocks(drwav* pWav, drwav_uint64 blockCount, void* pBufferOut);
+
 // Seeks to the given sample.
 //
+// MS ADPCM and DVI ADPCM data is stored in blocks of fmt.blockAlign bytes that each begin with the
+// predictor state, so seeking jumps straight to the block holding the sample and only decodes
+// within that block.
+//
 // Returns true if successful; false otherwise.
 drwav_bool32 drwav_seek_to_sample(drwav* pWav, drwav_uint64 sample);
 
@@ -410,6 +442,10 @@ void drwav_alaw_to_s16(drwav_int16* pOut, const drwav_uint8* pIn, size_t sampleC
 // Low-level function for converting u-law samples to signed 16-bit PCM samples.
 void drwav_mulaw_to_s16(drwav_int16* pOut, const drwav_uint8* pIn, size_t sampleCount);
 
+// Decodes blocks read with drwav_read_raw_blocks() into drwav_samples_per_block() samples each, the same samples
+// drwav_read_s16() gives. Blocks do not depend on each other, so separate blocks can be decoded on separate threads.
+void drwav_decode_blocks_s16(drwav* pWav, const void* pBlocks, drwav_uint64 blockCount, drwav_int16* pBufferOut);
+
 
 // Reads a chunk of audio data and converts it to IEEE 32-bit floating point samples.
 //
@@ -525,6 +561,38 @@ drwav_int32* drwav_open_and_read_file_s32(const char* filename, unsigned int* ch
 drwav_int16* drwav_open_and_read_memory_s16(const void* data, size_t dataSize, unsigned int* channels, unsigned int* sampleRate, drwav_uint64* totalSampleCount);
 float* drwav_open_and_read_memory_f32(const void* data, size_t dataSize, unsigned int* channels, unsigned int* sampleRate, drwav_uint64* totalSampleCount);
 drwav_int32* drwav_open_and_read_memory_s32(const void* data, size_t dataSize, unsigned int* channels, unsigned int* sampleRate, drwav_uint64* totalSampleCount);
+
+
+// Callbacks for the chunked readers below. pSamples holds sampleCount interleaved samples (always a whole number of
+// frames) and is only valid for the duration of the call. Return DRWAV_FALSE to stop reading.
+typedef drwav_bool32 (* drwav_chunk_proc_s16)(void* pUserData, const drwav_int16* pSamples, drwav_uint64 sampleCount, unsigned int channels, unsigned int sampleRate);
+typedef drwav_bool32 (* drwav_chunk_proc_f32)(void* pUserData, const float* pSamples, drwav_uint64 sampleCount, unsigned int channels, unsigned int sampleRate);
+typedef drwav_bool32 (* drwav_chunk_proc_s32)(void* pUserData, const drwav_int32* pSamples, drwav_uint64 sampleCount, unsigned int channels, unsigned int sampleRate);
+
+// Decodes the remaining samples of an initialized wav file block by block into pBuffer, which is owned by the caller and
+// holds bufferSampleCount samples, and hands every block to onChunk. Nothing is allocated, so any file size can be
+// processed in a fixed amount of memory.
+//
+// Returns the number of samples handed to onChunk, including those of the call that stopped reading.
+drwav_uint64 drwav_read_chunked_s16(drwav* pWav, drwav_int16* pBuffer, size_t bufferSampleCount, drwav_chunk_proc_s16 onChunk, void* pChunkUserData);
+drwav_uint64 drwav_read_chunked_f32(drwav* pWav, float* pBuffer, size_t bufferSampleCount, drwav_chunk_proc_f32 onChunk, void* pChunkUserData);
+drwav_uint64 drwav_read_chunked_s32(drwav* pWav, drwav_int32* pBuffer, size_t bufferSampleCount, drwav_chunk_proc_s32 onChunk, void* pChunkUserData);
+
+// Opens a wav file and passes all of its samples to onChunk in blocks of at most bufferSampleCount samples, decoded into the
+// reusable pBuffer. This is the fixed memory counterpart to drwav_open_and_read_*().
+//
+// Returns true if every sample in the file was handed to onChunk.
+drwav_bool32 drwav_open_and_read_chunked_s16(drwav_read_proc onRead, drwav_seek_proc onSeek, void* pUserData, drwav_int16* pBuffer, size_t bufferSampleCount, drwav_chunk_proc_s16 onChunk, void* pChunkUserData, drwav_uint64* totalSampleCount);
+drwav_bool32 drwav_open_and_read_chunked_f32(drwav_read_proc onRead, drwav_seek_proc onSeek, void* pUserData, float* pBuffer, size_t bufferSampleCount, drwav_chunk_proc_f32 onChunk, void* pChunkUserData, drwav_uint64* totalSampleCount);
+drwav_bool32 drwav_open_and_read_chunked_s32(drwav_read_proc onRead, drwav_seek_proc onSeek, void* pUserData, drwav_int32* pBuffer, size_t bufferSampleCount, drwav_chunk_proc_s32 onChunk, void* pChunkUserData, drwav_uint64* totalSampleCount);
+#ifndef DR_WAV_NO_STDIO
+drwav_bool32 drwav_open_and_read_file_chunked_s16(const char* filename, drwav_int16* pBuffer, size_t bufferSampleCount, drwav_chunk_proc_s16 onChunk, void* pChunkUserData, drwav_uint64* totalSampleCount);
+drwav_bool32 drwav_open_and_read_file_chunked_f32(const char* filename, float* pBuffer, size_t bufferSampleCount, drwav_chunk_proc_f32 onChunk, void* pChunkUserData, drwav_uint64* totalSampleCount);
+drwav_bool32 drwav_open_and_read_file_chunked_s32(const char* filename, drwav_int32* pBuffer, size_t bufferSampleCount, drwav_chunk_proc_s32 onChunk, void* pChunkUserData, drwav_uint64* totalSampleCount);
+#endif
+drwav_bool32 drwav_open_and_read_memory_chunked_s16(const void* data, size_t dataSize, drwav_int16* pBuffer, size_t bufferSampleCount, drwav_chunk_proc_s16 onChunk, void* pChunkUserData, drwav_uint64* totalSampleCount);
+drwav_bool32 drwav_open_and_read_memory_chunked_f32(const void* data, size_t dataSize, float* pBuffer, size_t bufferSampleCount, drwav_chunk_proc_f32 onChunk, void* pChunkUserData, drwav_uint64* totalSampleCount);
+drwav_bool32 drwav_open_and_read_memory_chunked_s32(const void* data, size_t dataSize, drwav_int32* pBuffer, size_t bufferSampleCount, drwav_chunk_proc_s32 onChunk, void* pChunkUserData, drwav_uint64* totalSampleCount);
 #endif
 
 // Frees data that was allocated internally by dr_wav.
@@ -595,6 +663,25 @@ void drwav_free(void* pDataReturnedByOpenAndRead);
 #endif
 #endif
 
+#ifndef DR_WAV_NO_SIMD
+    #if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+        #define DRWAV_SUPPORT_SSE2
+        #include <emmintrin.h>
+    #endif
+    #if defined(__SSSE3__)
+        #define DRWAV_SUPPORT_SSSE3
+        #include <tmmintrin.h>
+    #endif
+    #if defined(__AVX2__)
+        #define DRWAV_SUPPORT_AVX2
+        #include <immintrin.h>
+    #endif
+    #if defined(__ARM_NEON) || defined(__ARM_NEON__)
+        #define DRWAV_SUPPORT_NEON
+        #include <arm_neon.h>
+    #endif
+#endif
+
 // I couldn't figure out where SIZE_MAX was defined for VC6. If anybody knows, let me know.
 #if defined(_MSC_VER) && _MSC_VER <= 1200
     #if defined(_WIN64)
@@ -1294,12 +1381,91 @@ drwav_bool32 drwav_seek_to_first_sample(drwav* pWav)
 
     if (drwav__is_compressed_format_tag(pWav->translatedFormatTag)) {
         pWav->compressed.iCurrentSample = 0;
+
+        // Drop whatever was left of the block we were in.
+        pWav->msadpcm.bytesRemainingInBlock = 0;
+        pWav->msadpcm.cachedSampleCount = 0;
+        pWav->ima.bytesRemainingInBlock = 0;
+        pWav->ima.cachedSampleCount = 0;
     }
     
     pWav->bytesRemaining = pWav->dataChunkDataSize;
     return DRWAV_TRUE;
 }
 
+drwav_uint64 drwav_samples_per_block(drwav* pWav)
+{
+    if (pWav == NULL || pWav->channels == 0 || pWav->channels > 2) {
+        return 0;   // The decoders only handle mono and stereo.
+    }
+
+    drwav_uint64 blockAlign = pWav->fmt.blockAlign;
+    drwav_uint64 channels   = pWav->channels;
+
+    if (pWav->translatedFormatTag == DR_WAVE_FORMAT_ADPCM && blockAlign > 7*channels) {
+        return (blockAlign - (6*channels)) * 2;     // 2 samples per channel in the header, then two samples per byte.
+    }
+    if (pWav->translatedFormatTag == DR_WAVE_FORMAT_DVI_ADPCM && blockAlign > 4*channels && (blockAlign - (4*channels)) % (4*channels) == 0) {
+        return ((blockAlign - (4*channels)) * 2) + channels;   // The header sample, then 8 samples for every 4 bytes of each channel.
+    }
+
+    return 0;
+}
+
+drwav_uint64 drwav_read_raw_blocks(drwav* pWav, drwav_uint64 blockCount, void* pBufferOut)
+{
+    if (pWav == NULL || blockCount == 0 || pBufferOut == NULL) {
+        return 0;
+    }
+
+    drwav_uint64 samplesPerBlock = drwav_samples_per_block(pWav);
+    if (samplesPerBlock == 0 || pWav->compressed.iCurrentSample % samplesPerBlock != 0 || pWav->compressed.iCurrentSample >= pWav->totalSampleCount) {
+        return 0;
+    }
+
+    // Only the blocks that hold samples, and no more than fit in a single read.
+    drwav_uint64 samplesRemaining = pWav->totalSampleCount - pWav->compressed.iCurrentSample;
+    drwav_uint64 blocksRemaining  = (samplesRemaining + samplesPerBlock - 1) / samplesPerBlock;
+    if (blockCount > blocksRemaining) {
+        blockCount = blocksRemaining;
+    }
+    if (blockCount > SIZE_MAX / pWav->fmt.blockAlign) {
+        blockCount = SIZE_MAX / pWav->fmt.blockAlign;
+    }
+
+    size_t bytesRead = pWav->onRead(pWav->pUserData, pBufferOut, (size_t)(blockCount * pWav->fmt.blockAlign));
+    drwav_uint64 blocksRead = bytesRead / pWav->fmt.blockAlign;
+
+    // The data ends early. The bytes of the last, partial block go back to the stream so the regular decoder can
+    // decode what there is of it. If the stream can't seek back, they are lost and there is nothing more to decode.
+    size_t partialBytes = bytesRead - (size_t)(blocksRead * pWav->fmt.blockAlign);
+    if (partialBytes > 0 && !pWav->onSeek(pWav->pUserData, -(int)partialBytes, drwav_seek_origin_current)) {
+        pWav->compressed.iCurrentSample = pWav->totalSampleCount;
+        return blocksRead;
+    }
+
+    pWav->compressed.iCurrentSample += drwav_min(blocksRead * samplesPerBlock, samplesRemaining);
+
+    return blocksRead;
+}
+
+// Positions a compressed stream at the start of the given block, with nothing decoded from it yet.
+static drwav_bool32 drwav__seek_to_block(drwav* pWav, drwav_uint64 block)
+{
+    if (!drwav_seek_to_first_sample(pWav)) {
+        return DRWAV_FALSE;
+    }
+
+    drwav_uint64 offset = block * pWav->fmt.blockAlign;
+    if (offset > pWav->bytesRemaining || !drwav__seek_forward(pWav->onSeek, offset, pWav->pUserData)) {
+        return DRWAV_FALSE;
+    }
+
+    pWav->bytesRemaining -= offset;
+    pWav->compressed.iCurrentSample = block * drwav_samples_per_block(pWav);
+    return DRWAV_TRUE;
+}
+
 drwav_bool32 drwav_seek_to_sample(drwav* pWav, drwav_uint64 sample)
 {
     // Seeking should be compatible with wave files > 2GB.
@@ -1319,17 +1485,26 @@ drwav_bool32 drwav_seek_to_sample(drwav* pWav, drwav_uint64 sample)
     }
 
 
-    // For compressed formats we just use a slow generic seek. If we are seeking forward we just seek forward. If we are going backwards we need
-    // to seek back to the start.
+    // For compressed formats every block is self contained, so we seek to the start of the block holding the sample, unless we are already
+    // in that block before the sample, and decode forward from there. Formats without blocks use a slow generic seek.
     if (drwav__is_compressed_format_tag(pWav->translatedFormatTag)) {
-        // TODO: This can be optimized.
+        drwav_uint64 samplesPerBlock = drwav_samples_per_block(pWav);
+        if (samplesPerBlock > 0) {
+            drwav_uint64 block = sample / samplesPerBlock;
+            if (sample < pWav->compressed.iCurrentSample || pWav->compressed.iCurrentSample < block * samplesPerBlock) {
+                if (!drwav__seek_to_block(pWav, block)) {
+                    return DRWAV_FALSE;
+                }
+            }
+        }
+
         if (sample > pWav->compressed.iCurrentSample) {
             // Seeking forward - just move from the current position.
             drwav_uint64 offset = sample - pWav->compressed.iCurrentSample;
 
             drwav_int16 devnull[2048];
             while (offset > 0) {
-                drwav_uint64 samplesToRead = sample;
+                drwav_uint64 samplesToRead = offset;
                 if (samplesToRead > 2048) {
                     samplesToRead = 2048;
                 }
@@ -1341,7 +1516,7 @@ drwav_bool32 drwav_seek_to_sample(drwav* pWav, drwav_uint64 sample)
 
                 offset -= samplesRead;
             }
-        } else {
+        } else if (sample < pWav->compressed.iCurrentSample) {
             // Seeking backwards. Just use the fallback.
             goto fallback;
         }
@@ -1530,6 +1705,155 @@ drwav_uint64 drwav_read_s16__pcm(drwav* pWav, drwav_uint64 samplesToRead, drwav_
     return totalSamplesRead;
 }
 
+static drwav_int32 g_drwavMSADPCMAdaptationTable[16] = {
+    230, 230, 230, 230, 307, 409, 512, 614, 
+    768, 614, 512, 409, 307, 230, 230, 230 
+};
+static drwav_int32 g_drwavMSADPCMCoeff1Table[7] = { 256, 512, 0, 192, 240, 460,  392 };
+static drwav_int32 g_drwavMSADPCMCoeff2Table[7] = { 0,  -256, 0, 64,  0,  -208, -232 };
+
+static drwav_int32 g_drwavIMAIndexTable[16] = {
+    -1, -1, -1, -1, 2, 4, 6, 8,
+    -1, -1, -1, -1, 2, 4, 6, 8
+};
+
+static drwav_int32 g_drwavIMAStepTable[89] = { 
+    7,     8,     9,     10,    11,    12,    13,    14,    16,    17, 
+    19,    21,    23,    25,    28,    31,    34,    37,    41,    45, 
+    50,    55,    60,    66,    73,    80,    88,    97,    107,   118, 
+    130,   143,   157,   173,   190,   209,   230,   253,   279,   307,
+    337,   371,   408,   449,   494,   544,   598,   658,   724,   796,
+    876,   963,   1060,  1166,  1282,  1411,  1552,  1707,  1878,  2066, 
+    2272,  2499,  2749,  3024,  3327,  3660,  4026,  4428,  4871,  5358,
+    5894,  6484,  7132,  7845,  8630,  9493,  10442, 11487, 12635, 13899, 
+    15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767 
+};
+
+// Decodes one whole MS ADPCM block straight from memory. This is the same arithmetic as drwav_read_s16__msadpcm() without
+// reading a byte at a time or going through the sample cache.
+static void drwav__msadpcm_decode_block(drwav_uint32 channels, drwav_uint32 blockAlign, const drwav_uint8* pBlock, drwav_int16* pBufferOut)
+{
+    drwav_int32 predictor[2];
+    drwav_int32 delta[2];
+    drwav_int32 prevSamples[2][2];
+
+    if (channels == 1) {
+        predictor[0]      = pBlock[0];
+        delta[0]          = drwav__bytes_to_s16(pBlock + 1);
+        prevSamples[0][1] = drwav__bytes_to_s16(pBlock + 3);
+        prevSamples[0][0] = drwav__bytes_to_s16(pBlock + 5);
+    } else {
+        predictor[0]      = pBlock[0];
+        predictor[1]      = pBlock[1];
+        delta[0]          = drwav__bytes_to_s16(pBlock + 2);
+        delta[1]          = drwav__bytes_to_s16(pBlock + 4);
+        prevSamples[0][1] = drwav__bytes_to_s16(pBlock + 6);
+        prevSamples[1][1] = drwav__bytes_to_s16(pBlock + 8);
+        prevSamples[0][0] = drwav__bytes_to_s16(pBlock + 10);
+        prevSamples[1][0] = drwav__bytes_to_s16(pBlock + 12);
+    }
+
+    // The header samples come out oldest first.
+    for (drwav_uint32 iChannel = 0; iChannel < channels; ++iChannel) {
+        pBufferOut[iChannel]            = (drwav_int16)prevSamples[iChannel][0];
+        pBufferOut[channels + iChannel] = (drwav_int16)prevSamples[iChannel][1];
+    }
+    pBufferOut += 2*channels;
+
+    // The high nibble of each byte is for the first channel, the low nibble for the second (or the first again in mono).
+    const drwav_uint8* pNibbles = pBlock + 7*channels;
+    drwav_uint32 byteCount = blockAlign - 7*channels;
+    for (drwav_uint32 iByte = 0; iByte < byteCount; ++iByte) {
+        for (drwav_uint32 iNibble = 0; iNibble < 2; ++iNibble) {
+            drwav_uint32 iChannel = iNibble & (channels - 1);
+            drwav_int32  nibble   = (iNibble == 0) ? (pNibbles[iByte] >> 4) : (pNibbles[iByte] & 0x0F);
+
+            drwav_int32 newSample;
+            newSample  = ((prevSamples[iChannel][1] * g_drwavMSADPCMCoeff1Table[predictor[iChannel]]) + (prevSamples[iChannel][0] * g_drwavMSADPCMCoeff2Table[predictor[iChannel]])) >> 8;
+            newSample += (nibble - ((nibble & 0x08) << 1)) * delta[iChannel];
+            newSample  = drwav_clamp(newSample, -32768, 32767);
+
+            delta[iChannel] = (g_drwavMSADPCMAdaptationTable[nibble] * delta[iChannel]) >> 8;
+            if (delta[iChannel] < 16) {
+                delta[iChannel] = 16;
+            }
+
+            prevSamples[iChannel][0] = prevSamples[iChannel][1];
+            prevSamples[iChannel][1] = newSample;
+
+            *pBufferOut++ = (drwav_int16)newSample;
+        }
+    }
+}
+
+// Decodes one whole IMA ADPCM block straight from memory, like drwav__msadpcm_decode_block().
+static void drwav__ima_decode_block(drwav_uint32 channels, drwav_uint32 blockAlign, const drwav_uint8* pBlock, drwav_int16* pBufferOut)
+{
+    drwav_int32 predictor[2];
+    drwav_int32 stepIndex[2];
+
+    for (drwav_uint32 iChannel = 0; iChannel < channels; ++iChannel) {
+        predictor[iChannel] = drwav__bytes_to_s16(pBlock + 4*iChannel);
+        stepIndex[iChannel] = pBlock[4*iChannel + 2];
+        pBufferOut[iChannel] = (drwav_int16)predictor[iChannel];
+    }
+    pBufferOut += channels;
+
+    // Every 4 bytes hold 8 samples of one channel, low nibble first, and the channels take turns.
+    const drwav_uint8* pNibbles = pBlock + 4*channels;
+    drwav_uint32 groupCount = (blockAlign - 4*channels) / (4*channels);
+    for (drwav_uint32 iGroup = 0; iGroup < groupCount; ++iGroup) {
+        for (drwav_uint32 iChannel = 0; iChannel < channels; ++iChannel) {
+            // Unpack all 8 nibbles up front so the loop below only carries the predictor and step index.
+            drwav_uint8 nibbles[8];
+            for (drwav_uint32 iByte = 0; iByte < 4; ++iByte) {
+                nibbles[iByte*2 + 0] = pNibbles[iByte] & 0x0F;
+                nibbles[iByte*2 + 1] = pNibbles[iByte] >> 4;
+            }
+            pNibbles += 4;
+
+            drwav_int32 channelPredictor = predictor[iChannel];
+            drwav_int32 channelStepIndex = stepIndex[iChannel];
+            for (drwav_uint32 iNibble = 0; iNibble < 8; ++iNibble) {
+                drwav_int32 nibble = nibbles[iNibble];
+                drwav_int32 step   = g_drwavIMAStepTable[channelStepIndex];
+
+                drwav_int32 diff = (step >> 3) + ((nibble & 1) ? (step >> 2) : 0) + ((nibble & 2) ? (step >> 1) : 0) + ((nibble & 4) ? step : 0);
+                if (nibble & 8) {
+                    diff = -diff;
+                }
+
+                channelPredictor = drwav_clamp(channelPredictor + diff, -32768, 32767);
+                channelStepIndex = drwav_clamp(channelStepIndex + g_drwavIMAIndexTable[nibble], 0, (drwav_int32)drwav_countof(g_drwavIMAStepTable)-1);
+                pBufferOut[iNibble*channels + iChannel] = (drwav_int16)channelPredictor;
+            }
+            predictor[iChannel] = channelPredictor;
+            stepIndex[iChannel] = channelStepIndex;
+        }
+        pBufferOut += 8*channels;
+    }
+}
+
+void drwav_decode_blocks_s16(drwav* pWav, const void* pBlocks, drwav_uint64 blockCount, drwav_int16* pBufferOut)
+{
+    drwav_uint64 samplesPerBlock = drwav_samples_per_block(pWav);
+    if (samplesPerBlock == 0 || pBlocks == NULL || pBufferOut == NULL) {
+        return;
+    }
+
+    const drwav_uint8* pBlock = (const drwav_uint8*)pBlocks;
+    for (drwav_uint64 iBlock = 0; iBlock < blockCount; ++iBlock) {
+        if (pWav->translatedFormatTag == DR_WAVE_FORMAT_ADPCM) {
+            drwav__msadpcm_decode_block(pWav->channels, pWav->fmt.blockAlign, pBlock, pBufferOut);
+        } else {
+            drwav__ima_decode_block(pWav->channels, pWav->fmt.blockAlign, pBlock, pBufferOut);
+        }
+
+        pBlock     += pWav->fmt.blockAlign;
+        pBufferOut += samplesPerBlock;
+    }
+}
+
 drwav_uint64 drwav_read_s16__msadpcm(drwav* pWav, drwav_uint64 samplesToRead, drwav_int16* pBufferOut)
 {
     drwav_assert(pWav != NULL);
@@ -1615,12 +1939,9 @@ drwav_uint64 drwav_read_s16__msadpcm(drwav* pWav, drwav_uint64 samplesToRead, dr
                 drwav_int32 nibble0 = ((nibbles & 0xF0) >> 4); if ((nibbles & 0x80)) { nibble0 |= 0xFFFFFFF0UL; }
                 drwav_int32 nibble1 = ((nibbles & 0x0F) >> 0); if ((nibbles & 0x08)) { nibble1 |= 0xFFFFFFF0UL; }
 
-                static drwav_int32 adaptationTable[] = { 
-                    230, 230, 230, 230, 307, 409, 512, 614, 
-                    768, 614, 512, 409, 307, 230, 230, 230 
-                };
-                static drwav_int32 coeff1Table[] = { 256, 512, 0, 192, 240, 460,  392 };
-                static drwav_int32 coeff2Table[] = { 0,  -256, 0, 64,  0,  -208, -232 };
+                const drwav_int32* adaptationTable = g_drwavMSADPCMAdaptationTable;
+                const drwav_int32* coeff1Table     = g_drwavMSADPCMCoeff1Table;
+                const drwav_int32* coeff2Table     = g_drwavMSADPCMCoeff2Table;
 
                 if (pWav->channels == 1) {
                     // Mono.
@@ -1763,22 +2084,8 @@ drwav_uint64 drwav_read_s16__ima(drwav* pWav, drwav_uint64 samplesToRead, drwav_
             if (pWav->ima.bytesRemainingInBlock == 0) {
                 continue;
             } else {
-                static drwav_int32 indexTable[16] = {
-                    -1, -1, -1, -1, 2, 4, 6, 8,
-                    -1, -1, -1, -1, 2, 4, 6, 8
-                };
-
-                static drwav_int32 stepTable[89] = { 
-                    7,     8,     9,     10,    11,    12,    13,    14,    16,    17, 
-                    19,    21,    23,    25,    28,    31,    34,    37,    41,    45, 
-                    50,    55,    60,    66,    73,    80,    88,    97,    107,   118, 
-                    130,   143,   157,   173,   190,   209,   230,   253,   279,   307,
-                    337,   371,   408,   449,   494,   544,   598,   658,   724,   796,
-                    876,   963,   1060,  1166,  1282,  1411,  1552,  1707,  1878,  2066, 
-                    2272,  2499,  2749,  3024,  3327,  3660,  4026,  4428,  4871,  5358,
-                    5894,  6484,  7132,  7845,  8630,  9493,  10442, 11487, 12635, 13899, 
-                    15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767 
-                };
+                const drwav_int32* indexTable = g_drwavIMAIndexTable;
+                const drwav_int32* stepTable  = g_drwavIMAStepTable;
 
                 // From what I can tell with stereo streams, it looks like every 4 bytes (8 samples) is for one channel. So it goes 4 bytes for the
                 // left channel, 4 bytes for the right channel.
@@ -1786,6 +2093,7 @@ drwav_uint64 drwav_read_s16__ima(drwav* pWav, drwav_uint64 samplesToRead, drwav_
                 for (drwav_uint32 iChannel = 0; iChannel < pWav->channels; ++iChannel) {
                     drwav_uint8 nibbles[4];
                     if (pWav->onRead(pWav->pUserData, &nibbles, 4) != 4) {
+                        pWav->ima.cachedSampleCount = 0;    // The data ends within the block, don't output stale samples.
                         return totalSamplesRead;
                     }
                     pWav->ima.bytesRemainingInBlock -= 4;
@@ -1805,7 +2113,7 @@ drwav_uint64 drwav_read_s16__ima(drwav* pWav, drwav_uint64 samplesToRead, drwav_
 
                         predictor = drwav_clamp(predictor + diff, -32768, 32767);
                         pWav->ima.predictor[iChannel] = predictor;
-                        pWav->ima.stepIndex[iChannel] = drwav_clamp(pWav->ima.stepIndex[iChannel] + indexTable[nibble0], 0, (drwav_int32)drwav_countof(stepTable)-1);
+                        pWav->ima.stepIndex[iChannel] = drwav_clamp(pWav->ima.stepIndex[iChannel] + indexTable[nibble0], 0, (drwav_int32)drwav_countof(g_drwavIMAStepTable)-1);
                         pWav->ima.cachedSamples[(drwav_countof(pWav->ima.cachedSamples) - pWav->ima.cachedSampleCount) + (iByte*2+0)*pWav->channels + iChannel] = predictor;
 
 
@@ -1820,7 +2128,7 @@ drwav_uint64 drwav_read_s16__ima(drwav* pWav, drwav_uint64 samplesToRead, drwav_
 
                         predictor = drwav_clamp(predictor + diff, -32768, 32767);
                         pWav->ima.predictor[iChannel] = predictor;
-                        pWav->ima.stepIndex[iChannel] = drwav_clamp(pWav->ima.stepIndex[iChannel] + indexTable[nibble1], 0, (drwav_int32)drwav_countof(stepTable)-1);
+                        pWav->ima.stepIndex[iChannel] = drwav_clamp(pWav->ima.stepIndex[iChannel] + indexTable[nibble1], 0, (drwav_int32)drwav_countof(g_drwavIMAStepTable)-1);
                         pWav->ima.cachedSamples[(drwav_countof(pWav->ima.cachedSamples) - pWav->ima.cachedSampleCount) + (iByte*2+1)*pWav->channels + iChannel] = predictor;
                     }
                 }
@@ -1931,19 +2239,53 @@ drwav_uint64 drwav_read_s16(drwav* pWav, drwav_uint64 samplesToRead, drwav_int16
 
 void drwav_u8_to_s16(drwav_int16* pOut, const drwav_uint8* pIn, size_t sampleCount)
 {
+    size_t i = 0;
+
+#if defined(DRWAV_SUPPORT_SSE2)
+    const __m128i bias = _mm_set1_epi16(128);
+    for (; i + 16 <= sampleCount; i += 16) {
+        __m128i x  = _mm_loadu_si128((const __m128i*)(pIn + i));
+        __m128i lo = _mm_slli_epi16(_mm_sub_epi16(_mm_unpacklo_epi8(x, _mm_setzero_si128()), bias), 8);
+        __m128i hi = _mm_slli_epi16(_mm_sub_epi16(_mm_unpackhi_epi8(x, _mm_setzero_si128()), bias), 8);
+        _mm_storeu_si128((__m128i*)(pOut + i),     lo);
+        _mm_storeu_si128((__m128i*)(pOut + i + 8), hi);
+    }
+#elif defined(DRWAV_SUPPORT_NEON)
+    for (; i + 8 <= sampleCount; i += 8) {
+        int16x8_t x = vreinterpretq_s16_u16(vmovl_u8(vld1_u8(pIn + i)));
+        vst1q_s16(pOut + i, vshlq_n_s16(vsubq_s16(x, vdupq_n_s16(128)), 8));
+    }
+#endif
+
     int r;
-    for (size_t i = 0; i < sampleCount; ++i) {
+    for (; i < sampleCount; ++i) {
         int x = pIn[i];
         r = x - 128;
-        r = r << 8;
+        r = r * 256;
         pOut[i] = (short)r;
     }
 }
 
 void drwav_s24_to_s16(drwav_int16* pOut, const drwav_uint8* pIn, size_t sampleCount)
 {
+    size_t i = 0;
+
+#if defined(DRWAV_SUPPORT_SSSE3)
+    // Keep the upper two bytes of each 3 byte sample. The 16 byte load covers 5 1/3 samples, so stop early enough.
+    const __m128i shuffle = _mm_setr_epi8(1, 2, 4, 5, 7, 8, 10, 11, -1, -1, -1, -1, -1, -1, -1, -1);
+    for (; i + 6 <= sampleCount; i += 4) {
+        __m128i x = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(pIn + i*3)), shuffle);
+        _mm_storel_epi64((__m128i*)(pOut + i), x);
+    }
+#elif defined(DRWAV_SUPPORT_NEON)
+    for (; i + 8 <= sampleCount; i += 8) {
+        uint8x8x3_t x = vld3_u8(pIn + i*3);
+        vst1q_s16(pOut + i, vreinterpretq_s16_u16(vorrq_u16(vmovl_u8(x.val[1]), vshlq_n_u16(vmovl_u8(x.val[2]), 8))));
+    }
+#endif
+
     int r;
-    for (size_t i = 0; i < sampleCount; ++i) {
+    for (; i < sampleCount; ++i) {
         int x = ((int)(((unsigned int)(((unsigned char*)pIn)[i*3+0]) << 8) | ((unsigned int)(((unsigned char*)pIn)[i*3+1]) << 16) | ((unsigned int)(((unsigned char*)pIn)[i*3+2])) << 24)) >> 8;
         r = x >> 8;
         pOut[i] = (short)r;
@@ -1952,8 +2294,22 @@ void drwav_s24_to_s16(drwav_int16* pOut, const drwav_uint8* pIn, size_t sampleCo
 
 void drwav_s32_to_s16(drwav_int16* pOut, const drwav_int32* pIn, size_t sampleCount)
 {
+    size_t i = 0;
+
+#if defined(DRWAV_SUPPORT_SSE2)
+    for (; i + 8 <= sampleCount; i += 8) {
+        __m128i a = _mm_srai_epi32(_mm_loadu_si128((const __m128i*)(pIn + i)),     16);
+        __m128i b = _mm_srai_epi32(_mm_loadu_si128((const __m128i*)(pIn + i + 4)), 16);
+        _mm_storeu_si128((__m128i*)(pOut + i), _mm_packs_epi32(a, b));
+    }
+#elif defined(DRWAV_SUPPORT_NEON)
+    for (; i + 8 <= sampleCount; i += 8) {
+        vst1q_s16(pOut + i, vcombine_s16(vshrn_n_s32(vld1q_s32(pIn + i), 16), vshrn_n_s32(vld1q_s32(pIn + i + 4), 16)));
+    }
+#endif
+
     int r;
-    for (size_t i = 0; i < sampleCount; ++i) {
+    for (; i < sampleCount; ++i) {
         int x = pIn[i];
         r = x >> 16;
         pOut[i] = (short)r;
@@ -1962,8 +2318,28 @@ void drwav_s32_to_s16(drwav_int16* pOut, const drwav_int32* pIn, size_t sampleCo
 
 void drwav_f32_to_s16(drwav_int16* pOut, const float* pIn, size_t sampleCount)
 {
+    size_t i = 0;
+
+#if defined(DRWAV_SUPPORT_SSE2)
+    // Same as the scalar code below: clamp (letting NaN through), scale by 32767 or 32768 depending on the sign bit of
+    // the input, truncate and keep the low 16 bits.
+    const __m128 neg1 = _mm_set1_ps(-1.0f);
+    const __m128 pos1 = _mm_set1_ps(1.0f);
+    for (; i + 8 <= sampleCount; i += 8) {
+        __m128i r[2];
+        for (int h = 0; h < 2; ++h) {
+            __m128  x = _mm_loadu_ps(pIn + i + h*4);
+            __m128  c = _mm_min_ps(pos1, _mm_max_ps(neg1, x));
+            __m128i s = _mm_add_epi32(_mm_srli_epi32(_mm_castps_si128(x), 31), _mm_set1_epi32(32767));
+            __m128i t = _mm_cvttps_epi32(_mm_mul_ps(c, _mm_cvtepi32_ps(s)));
+            r[h] = _mm_srai_epi32(_mm_slli_epi32(t, 16), 16);
+        }
+        _mm_storeu_si128((__m128i*)(pOut + i), _mm_packs_epi32(r[0], r[1]));
+    }
+#endif
+
     int r;
-    for (size_t i = 0; i < sampleCount; ++i) {
+    for (; i < sampleCount; ++i) {
         float x = pIn[i];
         float c;
         int s;
@@ -2238,8 +2614,38 @@ void drwav_u8_to_f32(float* pOut, const drwav_uint8* pIn, size_t sampleCount)
         *pOut++ = (pIn[i] / 256.0f) * 2 - 1;
     }
 #else
-    for (size_t i = 0; i < sampleCount; ++i) {
-        *pOut++ = (pIn[i] / 255.0f) * 2 - 1;
+    size_t i = 0;
+
+#if defined(DRWAV_SUPPORT_AVX2)
+    for (; i + 8 <= sampleCount; i += 8) {
+        __m256 x = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)(pIn + i))));
+        x = _mm256_sub_ps(_mm256_mul_ps(_mm256_div_ps(x, _mm256_set1_ps(255.0f)), _mm256_set1_ps(2.0f)), _mm256_set1_ps(1.0f));
+        _mm256_storeu_ps(pOut + i, x);
+    }
+#elif defined(DRWAV_SUPPORT_SSE2)
+    for (; i + 4 <= sampleCount; i += 4) {
+        drwav_uint32 packed;
+        memcpy(&packed, pIn + i, 4);
+        __m128i b = _mm_cvtsi32_si128((int)packed);
+        b = _mm_unpacklo_epi16(_mm_unpacklo_epi8(b, _mm_setzero_si128()), _mm_setzero_si128());
+        __m128 x = _mm_cvtepi32_ps(b);
+        x = _mm_sub_ps(_mm_mul_ps(_mm_div_ps(x, _mm_set1_ps(255.0f)), _mm_set1_ps(2.0f)), _mm_set1_ps(1.0f));
+        _mm_storeu_ps(pOut + i, x);
+    }
+#elif defined(DRWAV_SUPPORT_NEON) && defined(__aarch64__)
+    for (; i + 8 <= sampleCount; i += 8) {
+        uint16x8_t w = vmovl_u8(vld1_u8(pIn + i));
+        float32x4_t lo = vcvtq_f32_u32(vmovl_u16(vget_low_u16(w)));
+        float32x4_t hi = vcvtq_f32_u32(vmovl_u16(vget_high_u16(w)));
+        lo = vsubq_f32(vmulq_n_f32(vdivq_f32(lo, vdupq_n_f32(255.0f)), 2.0f), vdupq_n_f32(1.0f));
+        hi = vsubq_f32(vmulq_n_f32(vdivq_f32(hi, vdupq_n_f32(255.0f)), 2.0f), vdupq_n_f32(1.0f));
+        vst1q_f32(pOut + i,     lo);
+        vst1q_f32(pOut + i + 4, hi);
+    }
+#endif
+
+    for (; i < sampleCount; ++i) {
+        pOut[i] = (pIn[i] / 255.0f) * 2 - 1;
     }
 #endif
 }
@@ -2250,8 +2656,36 @@ void drwav_s16_to_f32(float* pOut, const drwav_int16* pIn, size_t sampleCount)
         return;
     }
 
-    for (size_t i = 0; i < sampleCount; ++i) {
-        *pOut++ = pIn[i] / 32768.0f;
+    size_t i = 0;
+
+    // Dividing by 32768 is exact, so multiplying by its reciprocal gives the same results.
+#if defined(DRWAV_SUPPORT_AVX2)
+    const __m256 scale = _mm256_set1_ps(1.0f / 32768.0f);
+    for (; i + 16 <= sampleCount; i += 16) {
+        __m256i x0 = _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i*)(pIn + i)));
+        __m256i x1 = _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i*)(pIn + i + 8)));
+        _mm256_storeu_ps(pOut + i,     _mm256_mul_ps(_mm256_cvtepi32_ps(x0), scale));
+        _mm256_storeu_ps(pOut + i + 8, _mm256_mul_ps(_mm256_cvtepi32_ps(x1), scale));
+    }
+#elif defined(DRWAV_SUPPORT_SSE2)
+    const __m128 scale = _mm_set1_ps(1.0f / 32768.0f);
+    for (; i + 8 <= sampleCount; i += 8) {
+        __m128i x  = _mm_loadu_si128((const __m128i*)(pIn + i));
+        __m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(x, x), 16);
+        __m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(x, x), 16);
+        _mm_storeu_ps(pOut + i,     _mm_mul_ps(_mm_cvtepi32_ps(lo), scale));
+        _mm_storeu_ps(pOut + i + 4, _mm_mul_ps(_mm_cvtepi32_ps(hi), scale));
+    }
+#elif defined(DRWAV_SUPPORT_NEON)
+    for (; i + 8 <= sampleCount; i += 8) {
+        int16x8_t x = vld1q_s16(pIn + i);
+        vst1q_f32(pOut + i,     vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(x))),  1.0f / 32768.0f));
+        vst1q_f32(pOut + i + 4, vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(x))), 1.0f / 32768.0f));
+    }
+#endif
+
+    for (; i < sampleCount; ++i) {
+        pOut[i] = pIn[i] / 32768.0f;
     }
 }
 
@@ -2261,13 +2695,36 @@ void drwav_s24_to_f32(float* pOut, const drwav_uint8* pIn, size_t sampleCount)
         return;
     }
 
-    for (size_t i = 0; i < sampleCount; ++i) {
+    size_t i = 0;
+
+    // Unpack into the upper 24 bits of a 32-bit integer. Converting that to float and scaling by 2^-31 (exact) rounds the
+    // same way as the double division below.
+#if defined(DRWAV_SUPPORT_SSSE3)
+    const __m128i shuffle = _mm_setr_epi8(-1, 0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11);
+    const __m128  scale   = _mm_set1_ps(1.0f / 2147483648.0f);
+    for (; i + 6 <= sampleCount; i += 4) {
+        __m128i x = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(pIn + i*3)), shuffle);
+        _mm_storeu_ps(pOut + i, _mm_mul_ps(_mm_cvtepi32_ps(x), scale));
+    }
+#elif defined(DRWAV_SUPPORT_NEON)
+    for (; i + 8 <= sampleCount; i += 8) {
+        uint8x8x3_t x  = vld3_u8(pIn + i*3);
+        uint16x8_t  lo = vshlq_n_u16(vmovl_u8(x.val[0]), 8);
+        uint16x8_t  hi = vorrq_u16(vmovl_u8(x.val[1]), vshlq_n_u16(vmovl_u8(x.val[2]), 8));
+        int32x4_t   a  = vreinterpretq_s32_u32(vorrq_u32(vmovl_u16(vget_low_u16(lo)),  vshlq_n_u32(vmovl_u16(vget_low_u16(hi)),  16)));
+        int32x4_t   b  = vreinterpretq_s32_u32(vorrq_u32(vmovl_u16(vget_high_u16(lo)), vshlq_n_u32(vmovl_u16(vget_high_u16(hi)), 16)));
+        vst1q_f32(pOut + i,     vmulq_n_f32(vcvtq_f32_s32(a), 1.0f / 2147483648.0f));
+        vst1q_f32(pOut + i + 4, vmulq_n_f32(vcvtq_f32_s32(b), 1.0f / 2147483648.0f));
+    }
+#endif
+
+    for (; i < sampleCount; ++i) {
         unsigned int s0 = pIn[i*3 + 0];
         unsigned int s1 = pIn[i*3 + 1];
         unsigned int s2 = pIn[i*3 + 2];
 
         int sample32 = (int)((s0 << 8) | (s1 << 16) | (s2 << 24));
-        *pOut++ = (float)(sample32 / 2147483648.0);
+        pOut[i] = (float)(sample32 / 2147483648.0);
     }
 }
 
@@ -2277,8 +2734,27 @@ void drwav_s32_to_f32(float* pOut, const drwav_int32* pIn, size_t sampleCount)
         return;
     }
 
-    for (size_t i = 0; i < sampleCount; ++i) {
-        *pOut++ = (float)(pIn[i] / 2147483648.0);
+    size_t i = 0;
+
+    // int -> float rounds to nearest even just like double -> float, and scaling by 2^-31 is exact.
+#if defined(DRWAV_SUPPORT_AVX2)
+    const __m256 scale = _mm256_set1_ps(1.0f / 2147483648.0f);
+    for (; i + 8 <= sampleCount; i += 8) {
+        _mm256_storeu_ps(pOut + i, _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_loadu_si256((const __m256i*)(pIn + i))), scale));
+    }
+#elif defined(DRWAV_SUPPORT_SSE2)
+    const __m128 scale = _mm_set1_ps(1.0f / 2147483648.0f);
+    for (; i + 4 <= sampleCount; i += 4) {
+        _mm_storeu_ps(pOut + i, _mm_mul_ps(_mm_cvtepi32_ps(_mm_loadu_si128((const __m128i*)(pIn + i))), scale));
+    }
+#elif defined(DRWAV_SUPPORT_NEON)
+    for (; i + 4 <= sampleCount; i += 4) {
+        vst1q_f32(pOut + i, vmulq_n_f32(vcvtq_f32_s32(vld1q_s32(pIn + i)), 1.0f / 2147483648.0f));
+    }
+#endif
+
+    for (; i < sampleCount; ++i) {
+        pOut[i] = (float)(pIn[i] / 2147483648.0);
     }
 }
 
@@ -2299,8 +2775,18 @@ void drwav_alaw_to_f32(float* pOut, const drwav_uint8* pIn, size_t sampleCount)
         return;
     }
 
-    for (size_t i = 0; i < sampleCount; ++i) {
-        *pOut++ = drwav__alaw_to_s16(pIn[i]) / 32768.0f;
+    // Look up 256 samples at a time into a small s16 buffer and widen that with the vectorized s16 -> f32 routine.
+    drwav_int16 decoded[256];
+    while (sampleCount > 0) {
+        size_t count = drwav_min(sampleCount, drwav_countof(decoded));
+        for (size_t i = 0; i < count; ++i) {
+            decoded[i] = drwav__alaw_to_s16(pIn[i]);
+        }
+        drwav_s16_to_f32(pOut, decoded, count);
+
+        pIn += count;
+        pOut += count;
+        sampleCount -= count;
     }
 }
 
@@ -2310,8 +2796,18 @@ void drwav_mulaw_to_f32(float* pOut, const drwav_uint8* pIn, size_t sampleCount)
         return;
     }
 
-    for (size_t i = 0; i < sampleCount; ++i) {
-        *pOut++ = drwav__mulaw_to_s16(pIn[i]) / 32768.0f;
+    // Look up 256 samples at a time into a small s16 buffer and widen that with the vectorized s16 -> f32 routine.
+    drwav_int16 decoded[256];
+    while (sampleCount > 0) {
+        size_t count = drwav_min(sampleCount, drwav_countof(decoded));
+        for (size_t i = 0; i < count; ++i) {
+            decoded[i] = drwav__mulaw_to_s16(pIn[i]);
+        }
+        drwav_s16_to_f32(pOut, decoded, count);
+
+        pIn += count;
+        pOut += count;
+        sampleCount -= count;
     }
 }
 
@@ -2541,8 +3037,29 @@ void drwav_u8_to_s32(drwav_int32* pOut, const drwav_uint8* pIn, size_t sampleCou
         return;
     }
 
-    for (size_t i = 0; i < sampleCount; ++i) {
-        *pOut++ = ((int)pIn[i] - 128) << 24;
+    size_t i = 0;
+
+#if defined(DRWAV_SUPPORT_SSE2)
+    for (; i + 16 <= sampleCount; i += 16) {
+        // Flipping the top bit turns the unsigned byte into x - 128 as a signed byte.
+        __m128i x  = _mm_xor_si128(_mm_loadu_si128((const __m128i*)(pIn + i)), _mm_set1_epi8((char)0x80));
+        __m128i lo = _mm_unpacklo_epi8(_mm_setzero_si128(), x);
+        __m128i hi = _mm_unpackhi_epi8(_mm_setzero_si128(), x);
+        _mm_storeu_si128((__m128i*)(pOut + i),      _mm_unpacklo_epi16(_mm_setzero_si128(), lo));
+        _mm_storeu_si128((__m128i*)(pOut + i + 4),  _mm_unpackhi_epi16(_mm_setzero_si128(), lo));
+        _mm_storeu_si128((__m128i*)(pOut + i + 8),  _mm_unpacklo_epi16(_mm_setzero_si128(), hi));
+        _mm_storeu_si128((__m128i*)(pOut + i + 12), _mm_unpackhi_epi16(_mm_setzero_si128(), hi));
+    }
+#elif defined(DRWAV_SUPPORT_NEON)
+    for (; i + 8 <= sampleCount; i += 8) {
+        int16x8_t x = vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(vld1_u8(pIn + i))), vdupq_n_s16(128));
+        vst1q_s32(pOut + i,     vshlq_n_s32(vmovl_s16(vget_low_s16(x)),  24));
+        vst1q_s32(pOut + i + 4, vshlq_n_s32(vmovl_s16(vget_high_s16(x)), 24));
+    }
+#endif
+
+    for (; i < sampleCount; ++i) {
+        pOut[i] = ((int)pIn[i] - 128) * 16777216;
     }
 }
 
@@ -2552,8 +3069,29 @@ void drwav_s16_to_s32(drwav_int32* pOut, const drwav_int16* pIn, size_t sampleCo
         return;
     }
 
-    for (size_t i = 0; i < sampleCount; ++i) {
-        *pOut++ = pIn[i] << 16;
+    size_t i = 0;
+
+#if defined(DRWAV_SUPPORT_AVX2)
+    for (; i + 8 <= sampleCount; i += 8) {
+        __m256i x = _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i*)(pIn + i)));
+        _mm256_storeu_si256((__m256i*)(pOut + i), _mm256_slli_epi32(x, 16));
+    }
+#elif defined(DRWAV_SUPPORT_SSE2)
+    for (; i + 8 <= sampleCount; i += 8) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(pIn + i));
+        _mm_storeu_si128((__m128i*)(pOut + i),     _mm_unpacklo_epi16(_mm_setzero_si128(), x));
+        _mm_storeu_si128((__m128i*)(pOut + i + 4), _mm_unpackhi_epi16(_mm_setzero_si128(), x));
+    }
+#elif defined(DRWAV_SUPPORT_NEON)
+    for (; i + 8 <= sampleCount; i += 8) {
+        int16x8_t x = vld1q_s16(pIn + i);
+        vst1q_s32(pOut + i,     vshll_n_s16(vget_low_s16(x),  16));
+        vst1q_s32(pOut + i + 4, vshll_n_s16(vget_high_s16(x), 16));
+    }
+#endif
+
+    for (; i < sampleCount; ++i) {
+        pOut[i] = pIn[i] * 65536;
     }
 }
 
@@ -2563,13 +3101,30 @@ void drwav_s24_to_s32(drwav_int32* pOut, const drwav_uint8* pIn, size_t sampleCo
         return;
     }
 
-    for (size_t i = 0; i < sampleCount; ++i) {
+    size_t i = 0;
+
+#if defined(DRWAV_SUPPORT_SSSE3)
+    const __m128i shuffle = _mm_setr_epi8(-1, 0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11);
+    for (; i + 6 <= sampleCount; i += 4) {
+        _mm_storeu_si128((__m128i*)(pOut + i), _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(pIn + i*3)), shuffle));
+    }
+#elif defined(DRWAV_SUPPORT_NEON)
+    for (; i + 8 <= sampleCount; i += 8) {
+        uint8x8x3_t x  = vld3_u8(pIn + i*3);
+        uint16x8_t  lo = vshlq_n_u16(vmovl_u8(x.val[0]), 8);
+        uint16x8_t  hi = vorrq_u16(vmovl_u8(x.val[1]), vshlq_n_u16(vmovl_u8(x.val[2]), 8));
+        vst1q_s32(pOut + i,     vreinterpretq_s32_u32(vorrq_u32(vmovl_u16(vget_low_u16(lo)),  vshlq_n_u32(vmovl_u16(vget_low_u16(hi)),  16))));
+        vst1q_s32(pOut + i + 4, vreinterpretq_s32_u32(vorrq_u32(vmovl_u16(vget_high_u16(lo)), vshlq_n_u32(vmovl_u16(vget_high_u16(hi)), 16))));
+    }
+#endif
+
+    for (; i < sampleCount; ++i) {
         unsigned int s0 = pIn[i*3 + 0];
         unsigned int s1 = pIn[i*3 + 1];
         unsigned int s2 = pIn[i*3 + 2];
 
         drwav_int32 sample32 = (drwav_int32)((s0 << 8) | (s1 << 16) | (s2 << 24));
-        *pOut++ = sample32;
+        pOut[i] = sample32;
     }
 }
 
@@ -2579,8 +3134,23 @@ void drwav_f32_to_s32(drwav_int32* pOut, const float* pIn, size_t sampleCount)
         return;
     }
 
-    for (size_t i = 0; i < sampleCount; ++i) {
-        *pOut++ = (drwav_int32)(2147483648.0 * pIn[i]);
+    size_t i = 0;
+
+    // Scaling a float by 2^31 is exact in single precision too, so this truncates the same value as the double code.
+#if defined(DRWAV_SUPPORT_AVX2)
+    const __m256 scale = _mm256_set1_ps(2147483648.0f);
+    for (; i + 8 <= sampleCount; i += 8) {
+        _mm256_storeu_si256((__m256i*)(pOut + i), _mm256_cvttps_epi32(_mm256_mul_ps(_mm256_loadu_ps(pIn + i), scale)));
+    }
+#elif defined(DRWAV_SUPPORT_SSE2)
+    const __m128 scale = _mm_set1_ps(2147483648.0f);
+    for (; i + 4 <= sampleCount; i += 4) {
+        _mm_storeu_si128((__m128i*)(pOut + i), _mm_cvttps_epi32(_mm_mul_ps(_mm_loadu_ps(pIn + i), scale)));
+    }
+#endif
+
+    for (; i < sampleCount; ++i) {
+        pOut[i] = (drwav_int32)(2147483648.0 * pIn[i]);
     }
 }
 
@@ -2601,8 +3171,17 @@ void drwav_alaw_to_s32(drwav_int32* pOut, const drwav_uint8* pIn, size_t sampleC
         return;
     }
 
-    for (size_t i = 0; i < sampleCount; ++i) {
-        *pOut++ = ((drwav_int32)drwav__alaw_to_s16(pIn[i])) << 16;
+    drwav_int16 decoded[256];
+    while (sampleCount > 0) {
+        size_t count = drwav_min(sampleCount, drwav_countof(decoded));
+        for (size_t i = 0; i < count; ++i) {
+            decoded[i] = drwav__alaw_to_s16(pIn[i]);
+        }
+        drwav_s16_to_s32(pOut, decoded, count);
+
+        pIn += count;
+        pOut += count;
+        sampleCount -= count;
     }
 }
 
@@ -2612,8 +3191,17 @@ void drwav_mulaw_to_s32(drwav_int32* pOut, const drwav_uint8* pIn, size_t sample
         return;
     }
 
-    for (size_t i= 0; i < sampleCount; ++i) {
-        *pOut++ = ((drwav_int32)drwav__mulaw_to_s16(pIn[i])) << 16;
+    drwav_int16 decoded[256];
+    while (sampleCount > 0) {
+        size_t count = drwav_min(sampleCount, drwav_countof(decoded));
+        for (size_t i = 0; i < count; ++i) {
+            decoded[i] = drwav__mulaw_to_s16(pIn[i]);
+        }
+        drwav_s16_to_s32(pOut, decoded, count);
+
+        pIn += count;
+        pOut += count;
+        sampleCount -= count;
     }
 }
 
@@ -2840,6 +3428,243 @@ drwav_int32* drwav_open_and_read_memory_s32(const void* data, size_t dataSize, u
 
     return drwav__read_and_close_s32(&wav, channels, sampleRate, totalSampleCount);
 }
+
+
+drwav_uint64 drwav_read_chunked_s16(drwav* pWav, drwav_int16* pBuffer, size_t bufferSampleCount, drwav_chunk_proc_s16 onChunk, void* pChunkUserData)
+{
+    if (pWav == NULL || pBuffer == NULL || onChunk == NULL || pWav->channels == 0) {
+        return 0;
+    }
+
+    // Only hand out whole frames.
+    size_t samplesPerChunk = bufferSampleCount - (bufferSampleCount % pWav->channels);
+    if (samplesPerChunk == 0) {
+        return 0;
+    }
+
+    drwav_uint64 totalSamplesDelivered = 0;
+    for (;;) {
+        drwav_uint64 samplesRead = drwav_read_s16(pWav, samplesPerChunk, pBuffer);
+        if (samplesRead == 0) {
+            break;
+        }
+
+        totalSamplesDelivered += samplesRead;
+
+        if (!onChunk(pChunkUserData, pBuffer, samplesRead, pWav->channels, pWav->sampleRate)) {
+            break;
+        }
+    }
+
+    return totalSamplesDelivered;
+}
+
+static drwav_bool32 drwav__read_chunked_and_close_s16(drwav* pWav, drwav_int16* pBuffer, size_t bufferSampleCount, drwav_chunk_proc_s16 onChunk, void* pChunkUserData, drwav_uint64* totalSampleCount)
+{
+    drwav_assert(pWav != NULL);
+
+    drwav_uint64 samplesDelivered = drwav_read_chunked_s16(pWav, pBuffer, bufferSampleCount, onChunk, pChunkUserData);
+    drwav_bool32 result = samplesDelivered == pWav->totalSampleCount;
+
+    drwav_uninit(pWav);
+
+    if (totalSampleCount) *totalSampleCount = samplesDelivered;
+    return result;
+}
+
+drwav_uint64 drwav_read_chunked_f32(drwav* pWav, float* pBuffer, size_t bufferSampleCount, drwav_chunk_proc_f32 onChunk, void* pChunkUserData)
+{
+    if (pWav == NULL || pBuffer == NULL || onChunk == NULL || pWav->channels == 0) {
+        return 0;
+    }
+
+    // Only hand out whole frames.
+    size_t samplesPerChunk = bufferSampleCount - (bufferSampleCount % pWav->channels);
+    if (samplesPerChunk == 0) {
+        return 0;
+    }
+
+    drwav_uint64 totalSamplesDelivered = 0;
+    for (;;) {
+        drwav_uint64 samplesRead = drwav_read_f32(pWav, samplesPerChunk, pBuffer);
+        if (samplesRead == 0) {
+            break;
+        }
+
+        totalSamplesDelivered += samplesRead;
+
+        if (!onChunk(pChunkUserData, pBuffer, samplesRead, pWav->channels, pWav->sampleRate)) {
+            break;
+        }
+    }
+
+    return totalSamplesDelivered;
+}
+
+static drwav_bool32 drwav__read_chunked_and_close_f32(drwav* pWav, float* pBuffer, size_t bufferSampleCount, drwav_chunk_proc_f32 onChunk, void* pChunkUserData, drwav_uint64* totalSampleCount)
+{
+    drwav_assert(pWav != NULL);
+
+    drwav_uint64 samplesDelivered = drwav_read_chunked_f32(pWav, pBuffer, bufferSampleCount, onChunk, pChunkUserData);
+    drwav_bool32 result = samplesDelivered == pWav->totalSampleCount;
+
+    drwav_uninit(pWav);
+
+    if (totalSampleCount) *totalSampleCount = samplesDelivered;
+    return result;
+}
+
+drwav_uint64 drwav_read_chunked_s32(drwav* pWav, drwav_int32* pBuffer, size_t bufferSampleCount, drwav_chunk_proc_s32 onChunk, void* pChunkUserData)
+{
+    if (pWav == NULL || pBuffer == NULL || onChunk == NULL || pWav->channels == 0) {
+        return 0;
+    }
+
+    // Only hand out whole frames.
+    size_t samplesPerChunk = bufferSampleCount - (bufferSampleCount % pWav->channels);
+    if (samplesPerChunk == 0) {
+        return 0;
+    }
+
+    drwav_uint64 totalSamplesDelivered = 0;
+    for (;;) {
+        drwav_uint64 samplesRead = drwav_read_s32(pWav, samplesPerChunk, pBuffer);
+        if (samplesRead == 0) {
+            break;
+        }
+
+        totalSamplesDelivered += samplesRead;
+
+        if (!onChunk(pChunkUserData, pBuffer, samplesRead, pWav->channels, pWav->sampleRate)) {
+            break;
+        }
+    }
+
+    return totalSamplesDelivered;
+}
+
+static drwav_bool32 drwav__read_chunked_and_close_s32(drwav* pWav, drwav_int32* pBuffer, size_t bufferSampleCount, drwav_chunk_proc_s32 onChunk, void* pChunkUserData, drwav_uint64* totalSampleCount)
+{
+    drwav_assert(pWav != NULL);
+
+    drwav_uint64 samplesDelivered = drwav_read_chunked_s32(pWav, pBuffer, bufferSampleCount, onChunk, pChunkUserData);
+    drwav_bool32 result = samplesDelivered == pWav->totalSampleCount;
+
+    drwav_uninit(pWav);
+
+    if (totalSampleCount) *totalSampleCount = samplesDelivered;
+    return result;
+}
+
+drwav_bool32 drwav_open_and_read_chunked_s16(drwav_read_proc onRead, drwav_seek_proc onSeek, void* pUserData, drwav_int16* pBuffer, size_t bufferSampleCount, drwav_chunk_proc_s16 onChunk, void* pChunkUserData, drwav_uint64* totalSampleCount)
+{
+    if (totalSampleCount) *totalSampleCount = 0;
+
+    drwav wav;
+    if (!drwav_init(&wav, onRead, onSeek, pUserData)) {
+        return DRWAV_FALSE;
+    }
+
+    return drwav__read_chunked_and_close_s16(&wav, pBuffer, bufferSampleCount, onChunk, pChunkUserData, totalSampleCount);
+}
+
+drwav_bool32 drwav_open_and_read_chunked_f32(drwav_read_proc onRead, drwav_seek_proc onSeek, void* pUserData, float* pBuffer, size_t bufferSampleCount, drwav_chunk_proc_f32 onChunk, void* pChunkUserData, drwav_uint64* totalSampleCount)
+{
+    if (totalSampleCount) *totalSampleCount = 0;
+
+    drwav wav;
+    if (!drwav_init(&wav, onRead, onSeek, pUserData)) {
+        return DRWAV_FALSE;
+    }
+
+    return drwav__read_chunked_and_close_f32(&wav, pBuffer, bufferSampleCount, onChunk, pChunkUserData, totalSampleCount);
+}
+
+drwav_bool32 drwav_open_and_read_chunked_s32(drwav_read_proc onRead, drwav_seek_proc onSeek, void* pUserData, drwav_int32* pBuffer, size_t bufferSampleCount, drwav_chunk_proc_s32 onChunk, void* pChunkUserData, drwav_uint64* totalSampleCount)
+{
+    if (totalSampleCount) *totalSampleCount = 0;
+
+    drwav wav;
+    if (!drwav_init(&wav, onRead, onSeek, pUserData)) {
+        return DRWAV_FALSE;
+    }
+
+    return drwav__read_chunked_and_close_s32(&wav, pBuffer, bufferSampleCount, onChunk, pChunkUserData, totalSampleCount);
+}
+
+#ifndef DR_WAV_NO_STDIO
+drwav_bool32 drwav_open_and_read_file_chunked_s16(const char* filename, drwav_int16* pBuffer, size_t bufferSampleCount, drwav_chunk_proc_s16 onChunk, void* pChunkUserData, drwav_uint64* totalSampleCount)
+{
+    if (totalSampleCount) *totalSampleCount = 0;
+
+    drwav wav;
+    if (!drwav_init_file(&wav, filename)) {
+        return DRWAV_FALSE;
+    }
+
+    return drwav__read_chunked_and_close_s16(&wav, pBuffer, bufferSampleCount, onChunk, pChunkUserData, totalSampleCount);
+}
+
+drwav_bool32 drwav_open_and_read_file_chunked_f32(const char* filename, float* pBuffer, size_t bufferSampleCount, drwav_chunk_proc_f32 onChunk, void* pChunkUserData, drwav_uint64* totalSampleCount)
+{
+    if (totalSampleCount) *totalSampleCount = 0;
+
+    drwav wav;
+    if (!drwav_init_file(&wav, filename)) {
+        return DRWAV_FALSE;
+    }
+
+    return drwav__read_chunked_and_close_f32(&wav, pBuffer, bufferSampleCount, onChunk, pChunkUserData, totalSampleCount);
+}
+
+drwav_bool32 drwav_open_and_read_file_chunked_s32(const char* filename, drwav_int32* pBuffer, size_t bufferSampleCount, drwav_chunk_proc_s32 onChunk, void* pChunkUserData, drwav_uint64* totalSampleCount)
+{
+    if (totalSampleCount) *totalSampleCount = 0;
+
+    drwav wav;
+    if (!drwav_init_file(&wav, filename)) {
+        return DRWAV_FALSE;
+    }
+
+    return drwav__read_chunked_and_close_s32(&wav, pBuffer, bufferSampleCount, onChunk, pChunkUserData, totalSampleCount);
+}
+#endif
+
+drwav_bool32 drwav_open_and_read_memory_chunked_s16(const void* data, size_t dataSize, drwav_int16* pBuffer, size_t bufferSampleCount, drwav_chunk_proc_s16 onChunk, void* pChunkUserData, drwav_uint64* totalSampleCount)
+{
+    if (totalSampleCount) *totalSampleCount = 0;
+
+    drwav wav;
+    if (!drwav_init_memory(&wav, data, dataSize)) {
+        return DRWAV_FALSE;
+    }
+
+    return drwav__read_chunked_and_close_s16(&wav, pBuffer, bufferSampleCount, onChunk, pChunkUserData, totalSampleCount);
+}
+
+drwav_bool32 drwav_open_and_read_memory_chunked_f32(const void* data, size_t dataSize, float* pBuffer, size_t bufferSampleCount, drwav_chunk_proc_f32 onChunk, void* pChunkUserData, drwav_uint64* totalSampleCount)
+{
+    if (totalSampleCount) *totalSampleCount = 0;
+
+    drwav wav;
+    if (!drwav_init_memory(&wav, data, dataSize)) {
+        return DRWAV_FALSE;
+    }
+
+    return drwav__read_chunked_and_close_f32(&wav, pBuffer, bufferSampleCount, onChunk, pChunkUserData, totalSampleCount);
+}
+
+drwav_bool32 drwav_open_and_read_memory_chunked_s32(const void* data, size_t dataSize, drwav_int32* pBuffer, size_t bufferSampleCount, drwav_chunk_proc_s32 onChunk, void* pChunkUserData, drwav_uint64* totalSampleCount)
+{
+    if (totalSampleCount) *totalSampleCount = 0;
+
+    drwav wav;
+    if (!drwav_init_memory(&wav, data, dataSize)) {
+        return DRWAV_FALSE;
+    }
+
+    return drwav__read_chunked_and_close_s32(&wav, pBuffer, bufferSampleCount, onChunk, pChunkUserData, totalSampleCount);
+}
 #endif  //DR_WAV_NO_CONVERSION_API
 
 
@@ -0,0 +1,578 @@
+/*  lsrac - command line sample rate converter
+
+    Converts wav files (or a wav stream on stdin) with lib_simple_raw_audio_converter.
+
+    usage: lsrac [options] <input.wav | -> <output.wav | ->
+           lsrac [options] -m <manifest>
+
+    Files are converted on a work stealing pool (see lsrac_batch.h). When reading from
+    stdin or writing to stdout the conversion runs through a single stream, chunk by
+    chunk, in constant memory. With --start or --frames only that range of output frames
+    is converted, reading just the part of the input file it depends on.
+
+*/
+
+#define LSRAC_IMPLEMENTATION
+#include "simple_raw_audio_converter.h"
+
+#define DR_WAV_IMPLEMENTATION
+#include "dr_wav.h"
+
+#define LSRAC_BATCH_IMPLEMENTATION
+#include "lsrac_batch.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <string>
+#include <vector>
+
+#if defined(_WIN32)
+#include <fcntl.h>
+#include <io.h>
+#endif
+
+#define CLI_CHUNK_FRAMES 4096
+
+struct cli_options {
+    uint32_t      rate;
+    uint32_t      format;
+    uint32_t      quality;
+    uint32_t      threads;
+    uint32_t      output_flags;
+    bool          dither_set;
+    float         gain;
+    uint64_t      start;                // first output frame
+    uint64_t      frames;               // output frames, 0 = to the end
+    bool          range_set;
+    bool          verbose;
+    const char *  manifest;
+    const char *  input;
+    const char *  output;
+};
+
+static void print_usage()
+{
+    fprintf(stderr,
+        "usage: lsrac [options] <input.wav | -> <output.wav | ->\n"
+        "       lsrac [options] -m <manifest>\n"
+        "\n"
+        "  -r, --rate <hz>          output sample rate (default: the input rate)\n"
+        "  -f, --format <format>    s16, s24, s32 or f32 (default: s16)\n"
+        "  -q, --quality <preset>   best, high, medium, fast or preview (default: best)\n"
+        "  -d, --dither <mode>      none, tpdf or shaped (default: tpdf, none for f32)\n"
+        "  -g, --gain <factor>      gain applied before quantization (default: 1)\n"
+        "  -t, --threads <n>        worker threads for files (default: all cores)\n"
+        "  -s, --start <frame>      first output frame to convert (input must be a file)\n"
+        "  -n, --frames <count>     number of output frames to convert (default: to the end)\n"
+        "  -m, --manifest <file>    convert every \"input output [rate]\" line of file\n"
+        "  -v, --verbose            print throughput to stderr\n"
+        "  -h, --help\n"
+        "\n"
+        "  \"-\" reads from stdin or writes to stdout.\n");
+}
+
+static bool parse_choice(const char * value, const char * const * names, uint32_t count, uint32_t * result)
+{
+    for (uint32_t i = 0; i < count; ++i) {
+        if (strcmp(value, names[i]) == 0) {
+            *result = i;
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool parse_options(int argc, char ** argv, cli_options * options)
+{
+    static const char * const formats[]   = { "f32", "s16", "s24", "s32" };    // LSRAC_FORMAT_* order
+    static const char * const qualities[] = { "best", "high", "medium", "fast", "preview" };
+    static const char * const dithers[]   = { "none", "tpdf", "shaped" };
+
+    memset(options, 0, sizeof(*options));
+    options->format = LSRAC_FORMAT_S16;
+    options->quality = LSRAC_QUALITY_BEST;
+    options->gain = 1.0f;
+
+    std::vector<const char *> positional;
+
+    for (int i = 1; i < argc; ++i) {
+        const char * arg = argv[i];
+
+        if (strcmp(arg, "-h") == 0 || strcmp(arg, "--help") == 0) {
+            return false;
+        }
+        if (strcmp(arg, "-v") == 0 || strcmp(arg, "--verbose") == 0) {
+            options->verbose = true;
+            continue;
+        }
+        if (arg[0] != '-' || arg[1] == '\0') {
+            positional.push_back(arg);
+            continue;
+        }
+
+        if (i + 1 >= argc) {
+            fprintf(stderr, "lsrac: %s needs a value\n", arg);
+            return false;
+        }
+        const char * value = argv[++i];
+
+        bool ok = true;
+
+        if (strcmp(arg, "-r") == 0 || strcmp(arg, "--rate") == 0) {
+            options->rate = static_cast<uint32_t>(strtoul(value, nullptr, 10));
+            ok = options->rate != 0;
+        } else if (strcmp(arg, "-f") == 0 || strcmp(arg, "--format") == 0) {
+            ok = parse_choice(value, formats, ARRAY_COUNT(formats), &options->format);
+        } else if (strcmp(arg, "-q") == 0 || strcmp(arg, "--quality") == 0) {
+            ok = parse_choice(value, qualities, ARRAY_COUNT(qualities), &options->quality);
+        } else if (strcmp(arg, "-d") == 0 || strcmp(arg, "--dither") == 0) {
+            uint32_t dither = 0;
+            ok = parse_choice(value, dithers, ARRAY_COUNT(dithers), &dither);
+            options->output_flags = dither == 0 ? 0 :
+                                    dither == 1 ? LSRAC_OUTPUT_DITHER :
+                                                  LSRAC_OUTPUT_DITHER | LSRAC_OUTPUT_NOISE_SHAPING;
+            options->dither_set = true;
+        } else if (strcmp(arg, "-g") == 0 || strcmp(arg, "--gain") == 0) {
+            options->gain = strtof(value, nullptr);
+        } else if (strcmp(arg, "-t") == 0 || strcmp(arg, "--threads") == 0) {
+            options->threads = static_cast<uint32_t>(strtoul(value, nullptr, 10));
+        } else if (strcmp(arg, "-s") == 0 || strcmp(arg, "--start") == 0) {
+            options->start = strtoull(value, nullptr, 10);
+            options->range_set = true;
+        } else if (strcmp(arg, "-n") == 0 || strcmp(arg, "--frames") == 0) {
+            options->frames = strtoull(value, nullptr, 10);
+            options->range_set = true;
+            ok = options->frames != 0;
+        } else if (strcmp(arg, "-m") == 0 || strcmp(arg, "--manifest") == 0) {
+            options->manifest = value;
+        } else {
+            fprintf(stderr, "lsrac: unknown option %s\n", arg);
+            return false;
+        }
+
+        if (!ok) {
+            fprintf(stderr, "lsrac: invalid value for %s: %s\n", arg, value);
+            return false;
+        }
+    }
+
+    if (!options->dither_set && options->format != LSRAC_FORMAT_F32) {
+        options->output_flags = LSRAC_OUTPUT_DITHER;
+    }
+
+    if (options->manifest != nullptr) {
+        return positional.empty() && !options->range_set;
+    }
+    if (positional.size() != 2) {
+        return false;
+    }
+
+    options->input = positional[0];
+    options->output = positional[1];
+
+    return true;
+}
+
+
+/*
+ *  Streaming conversion, for stdin and stdout
+ */
+
+static size_t read_stdin(void * user_data, void * buffer, size_t bytes)
+{
+    (void)user_data;
+    return fread(buffer, 1, bytes, stdin);
+}
+
+// stdin can only skip forward, which is all dr_wav needs while parsing the header.
+static drwav_bool32 seek_stdin(void * user_data, int offset, drwav_seek_origin origin)
+{
+    (void)user_data;
+
+    if (origin != drwav_seek_origin_current || offset < 0) {
+        return DRWAV_FALSE;
+    }
+
+    char scratch[4096];
+    while (offset > 0) {
+        size_t bytes = offset < static_cast<int>(sizeof(scratch)) ? static_cast<size_t>(offset) : sizeof(scratch);
+        if (fread(scratch, 1, bytes, stdin) != bytes) {
+            return DRWAV_FALSE;
+        }
+        offset -= static_cast<int>(bytes);
+    }
+
+    return DRWAV_TRUE;
+}
+
+static int convert_stream(const cli_options * options)
+{
+    bool from_stdin = strcmp(options->input, "-") == 0;
+    bool to_stdout = strcmp(options->output, "-") == 0;
+
+#if defined(_WIN32)
+    if (from_stdin) {
+        _setmode(_fileno(stdin), _O_BINARY);
+    }
+    if (to_stdout) {
+        _setmode(_fileno(stdout), _O_BINARY);
+    }
+#endif
+
+    drwav * wav = from_stdin ? drwav_open(read_stdin, seek_stdin, nullptr) : drwav_open_file(options->input);
+    if (wav == nullptr) {
+        fprintf(stderr, "lsrac: could not read wav from %s\n", options->input);
+        return 1;
+    }
+
+    uint32_t channels = wav->channels;
+    uint32_t src_rate = wav->sampleRate;
+    uint32_t dst_rate = options->rate != 0 ? options->rate : src_rate;
+    uint64_t src_frames = wav->totalSampleCount / channels;
+
+    lsrac_plan_t plan;
+    if (lsrac_plan_init(&plan, src_rate, dst_rate, channels, nullptr) != LSRAC_RET_VAL_OK ||
+        lsrac_plan_set_quality(&plan, options->quality) != LSRAC_RET_VAL_OK) {
+        fprintf(stderr, "lsrac: cannot convert %u channels from %u Hz to %u Hz\n", channels, src_rate, dst_rate);
+        drwav_close(wav);
+        return 1;
+    }
+
+    lsrac_stream_t stream;
+    if (lsrac_stream_init(&stream, &plan, nullptr) != LSRAC_RET_VAL_OK) {
+        fprintf(stderr, "lsrac: out of memory\n");
+        lsrac_plan_uninit(&plan);
+        drwav_close(wav);
+        return 1;
+    }
+    lsrac_stream_set_output(&stream, options->gain, options->output_flags);
+
+    FILE * out = to_stdout ? stdout : fopen(options->output, "wb");
+
+    uint64_t dst_frames = (src_frames * plan.dst_rate + plan.src_rate - 1) / plan.src_rate;
+
+    int result = 0;
+
+    if (out == nullptr || lsrac_batch_write_wav_header(out, channels, dst_rate, options->format, dst_frames) != LSRAC_RET_VAL_OK) {
+        fprintf(stderr, "lsrac: could not write %s\n", options->output);
+        result = 1;
+    }
+
+    size_t sample_bytes = options->format == LSRAC_FORMAT_S16 ? 2 : options->format == LSRAC_FORMAT_S24 ? 3 : 4;
+    uint64_t dst_capacity = CLI_CHUNK_FRAMES * static_cast<uint64_t>(plan.dst_rate) / plan.src_rate + 2;
+
+    std::vector<float>   src_chunk(CLI_CHUNK_FRAMES * channels);
+    std::vector<uint8_t> dst_chunk(dst_capacity * channels * sample_bytes);
+
+    lsrac_buffer_t dst;
+    lsrac_buffer_interleaved(&dst, dst_chunk.data(), channels, options->format);
+
+    uint64_t total_written = 0;
+
+    while (result == 0) {
+        uint64_t frames = drwav_read_f32(wav, CLI_CHUNK_FRAMES * channels, src_chunk.data()) / channels;
+        if (frames == 0) {
+            break;
+        }
+
+        lsrac_buffer_t src;
+        lsrac_buffer_interleaved(&src, src_chunk.data(), channels, LSRAC_FORMAT_F32);
+
+        uint64_t read = 0;
+        while (read < frames && result == 0) {
+            uint64_t written = 0;
+            uint64_t consumed = 0;
+            lsrac_stream_process_buffers(&stream, &dst, dst_capacity, &written, &src, frames - read, &consumed);
+            lsrac_buffer_advance(&src, consumed);
+            read += consumed;
+
+            if (fwrite(dst_chunk.data(), channels * sample_bytes, written, out) != written) {
+                result = 1;
+            }
+            total_written += written;
+        }
+    }
+
+    while (result == 0) {
+        uint64_t written = 0;
+        lsrac_stream_flush_buffers(&stream, &dst, dst_capacity, &written);
+        if (written == 0) {
+            break;
+        }
+        if (fwrite(dst_chunk.data(), channels * sample_bytes, written, out) != written) {
+            result = 1;
+        }
+        total_written += written;
+    }
+
+    // A truncated input leaves the header promising more frames than were written
+    if (result == 0 && total_written != dst_frames) {
+        fprintf(stderr, "lsrac: input ended early (%llu of %llu frames written)\n",
+                static_cast<unsigned long long>(total_written), static_cast<unsigned long long>(dst_frames));
+        result = 1;
+    }
+
+    if (out != nullptr && !to_stdout && fclose(out) != 0) {
+        result = 1;
+    }
+    if (to_stdout && fflush(stdout) != 0) {
+        result = 1;
+    }
+
+    lsrac_stream_uninit(&stream);
+    lsrac_plan_uninit(&plan);
+    drwav_close(wav);
+
+    if (options->verbose && result == 0) {
+        fprintf(stderr, "lsrac: %llu frames at %u Hz -> %llu frames at %u Hz\n",
+                static_cast<unsigned long long>(src_frames), src_rate,
+                static_cast<unsigned long long>(total_written), dst_rate);
+    }
+
+    return result;
+}
+
+
+/*
+ *  Range conversion, for scrubbing
+ */
+
+static int convert_range(const cli_options * options)
+{
+    bool to_stdout = strcmp(options->output, "-") == 0;
+
+#if defined(_WIN32)
+    if (to_stdout) {
+        _setmode(_fileno(stdout), _O_BINARY);
+    }
+#endif
+
+    drwav * wav = drwav_open_file(options->input);
+    if (wav == nullptr) {
+        fprintf(stderr, "lsrac: could not read wav from %s\n", options->input);
+        return 1;
+    }
+
+    uint32_t channels = wav->channels;
+    uint32_t src_rate = wav->sampleRate;
+    uint32_t dst_rate = options->rate != 0 ? options->rate : src_rate;
+
+    lsrac_plan_t plan;
+    if (lsrac_plan_init(&plan, src_rate, dst_rate, channels, nullptr) != LSRAC_RET_VAL_OK ||
+        lsrac_plan_set_quality(&plan, options->quality) != LSRAC_RET_VAL_OK) {
+        fprintf(stderr, "lsrac: cannot convert %u channels from %u Hz to %u Hz\n", channels, src_rate, dst_rate);
+        drwav_close(wav);
+        return 1;
+    }
+
+    uint64_t dst_total = lsrac_plan_dst_frames(&plan, wav->totalSampleCount / channels);
+    uint64_t first = options->start < dst_total ? options->start : dst_total;
+    uint64_t frames = options->frames != 0 && options->frames < dst_total - first ? options->frames : dst_total - first;
+
+    lsrac_stream_t stream;
+    if (lsrac_stream_init(&stream, &plan, nullptr) != LSRAC_RET_VAL_OK) {
+        fprintf(stderr, "lsrac: out of memory\n");
+        lsrac_plan_uninit(&plan);
+        drwav_close(wav);
+        return 1;
+    }
+    lsrac_stream_set_output(&stream, options->gain, options->output_flags);
+
+    FILE * out = to_stdout ? stdout : fopen(options->output, "wb");
+
+    int result = 0;
+
+    if (out == nullptr || lsrac_batch_write_wav_header(out, channels, dst_rate, options->format, frames) != LSRAC_RET_VAL_OK) {
+        fprintf(stderr, "lsrac: could not write %s\n", options->output);
+        result = 1;
+    }
+
+    // The stream, seeked to the first frame of the range, converts the whole range from
+    // the source frames it depends on onwards
+    uint64_t src_first = 0;
+
+    if (lsrac_stream_seek(&stream, first, &src_first) != LSRAC_RET_VAL_OK ||
+        !drwav_seek_to_sample(wav, src_first * channels)) {
+        fprintf(stderr, "lsrac: could not seek to frame %llu\n", static_cast<unsigned long long>(first));
+        result = 1;
+    }
+
+    size_t sample_bytes = options->format == LSRAC_FORMAT_S16 ? 2 : options->format == LSRAC_FORMAT_S24 ? 3 : 4;
+    uint64_t dst_capacity = CLI_CHUNK_FRAMES * static_cast<uint64_t>(plan.dst_rate) / plan.src_rate + 2;
+
+    std::vector<float>   src_chunk(CLI_CHUNK_FRAMES * channels);
+    std::vector<uint8_t> dst_chunk(dst_capacity * channels * sample_bytes);
+
+    lsrac_buffer_t dst;
+    lsrac_buffer_interleaved(&dst, dst_chunk.data(), channels, options->format);
+
+    uint64_t done = 0;
+
+    while (done < frames && result == 0) {
+        uint64_t read = lsrac_batch_read_f32(wav, src_chunk.data(), CLI_CHUNK_FRAMES, 0);
+
+        lsrac_buffer_t src;
+        lsrac_buffer_interleaved(&src, src_chunk.data(), channels, LSRAC_FORMAT_F32);
+
+        // Past the end of the source the rest of the range comes from flushing
+        bool at_end = read == 0;
+        uint64_t consumed_total = 0;
+
+        while ((at_end || consumed_total < read) && done < frames && result == 0) {
+            uint64_t capacity = frames - done < dst_capacity ? frames - done : dst_capacity;
+            uint64_t written = 0;
+            uint64_t consumed = 0;
+
+            if (at_end) {
+                lsrac_stream_flush_buffers(&stream, &dst, capacity, &written);
+            } else {
+                lsrac_stream_process_buffers(&stream, &dst, capacity, &written, &src, read - consumed_total, &consumed);
+                lsrac_buffer_advance(&src, consumed);
+                consumed_total += consumed;
+            }
+
+            if (fwrite(dst_chunk.data(), channels * sample_bytes, written, out) != written ||
+                (at_end && written == 0)) {
+                fprintf(stderr, "lsrac: could not convert frames %llu to %llu\n",
+                        static_cast<unsigned long long>(first + done), static_cast<unsigned long long>(first + frames));
+                result = 1;
+            }
+
+            done += written;
+        }
+    }
+
+    lsrac_stream_uninit(&stream);
+
+    if (out != nullptr && !to_stdout && fclose(out) != 0) {
+        result = 1;
+    }
+    if (to_stdout && fflush(stdout) != 0) {
+        result = 1;
+    }
+
+    lsrac_plan_uninit(&plan);
+    drwav_close(wav);
+
+    if (options->verbose && result == 0) {
+        fprintf(stderr, "lsrac: output frames %llu to %llu at %u Hz\n",
+                static_cast<unsigned long long>(first), static_cast<unsigned long long>(first + frames), dst_rate);
+    }
+
+    return result;
+}
+
+
+/*
+ *  File and manifest conversion
+ */
+
+static int convert_files(const cli_options * options)
+{
+    // Keeps the paths of manifest lines alive for the jobs
+    std::vector<std::string> paths;
+    std::vector<uint32_t> rates;
+
+    if (options->manifest != nullptr) {
+        FILE * manifest = fopen(options->manifest, "r");
+        if (manifest == nullptr) {
+            fprintf(stderr, "lsrac: could not open manifest %s\n", options->manifest);
+            return 1;
+        }
+
+        char line[4096];
+        while (fgets(line, sizeof(line), manifest) != nullptr) {
+            char input[2048];
+            char output[2048];
+            unsigned int rate = options->rate;
+
+            if (line[0] == '#') {
+                continue;
+            }
+            int fields = sscanf(line, "%2047s %2047s %u", input, output, &rate);
+            if (fields <= 0) {
+                continue;
+            }
+            if (fields < 2) {
+                fprintf(stderr, "lsrac: malformed manifest line: %s", line);
+                fclose(manifest);
+                return 1;
+            }
+
+            paths.push_back(input);
+            paths.push_back(output);
+            rates.push_back(rate);
+        }
+
+        fclose(manifest);
+    } else {
+        paths.push_back(options->input);
+        paths.push_back(options->output);
+        rates.push_back(options->rate);
+    }
+
+    std::vector<lsrac_batch_job_t> jobs(rates.size());
+
+    for (size_t i = 0; i < jobs.size(); ++i) {
+        memset(&jobs[i], 0, sizeof(jobs[i]));
+        jobs[i].src_path     = paths[2 * i].c_str();
+        jobs[i].dst_path     = paths[2 * i + 1].c_str();
+        jobs[i].dst_rate     = rates[i];
+        jobs[i].dst_format   = options->format;
+        jobs[i].gain         = options->gain;
+        jobs[i].output_flags = options->output_flags;
+        jobs[i].quality      = options->quality;
+    }
+
+    lsrac_batch_options_t batch_options;
+    lsrac_batch_default_options(&batch_options);
+    batch_options.threads = options->threads;
+
+    lsrac_batch_stats_t stats;
+    int32_t result = lsrac_batch_run(jobs.data(), jobs.size(), &batch_options, &stats);
+
+    for (size_t i = 0; i < jobs.size(); ++i) {
+        if (jobs[i].result != LSRAC_RET_VAL_OK) {
+            fprintf(stderr, "lsrac: failed to convert %s\n", jobs[i].src_path);
+        } else if (options->verbose) {
+            fprintf(stderr, "lsrac: %s: %llu frames, %u segments, %.1f Mframes/s\n",
+                    jobs[i].src_path, static_cast<unsigned long long>(jobs[i].src_frames),
+                    jobs[i].segments, jobs[i].frames_per_second * 1e-6);
+        }
+    }
+
+    if (options->verbose) {
+        fprintf(stderr, "lsrac: %u files, %u failed, %.2f s, %.1f Mframes/s, %llu of %llu tasks stolen\n",
+                stats.jobs_ok + stats.jobs_failed, stats.jobs_failed, stats.seconds, stats.frames_per_second * 1e-6,
+                static_cast<unsigned long long>(stats.steals), static_cast<unsigned long long>(stats.tasks));
+    }
+
+    return result == LSRAC_RET_VAL_OK ? 0 : 1;
+}
+
+int main(int argc, char ** argv)
+{
+    cli_options options;
+
+    if (!parse_options(argc, argv, &options)) {
+        print_usage();
+        return 2;
+    }
+
+    if (options.range_set) {
+        if (strcmp(options.input, "-") == 0) {
+            fprintf(stderr, "lsrac: --start and --frames need an input file\n");
+            return 2;
+        }
+        return convert_range(&options);
+    }
+
+    if (options.manifest == nullptr &&
+        (strcmp(options.input, "-") == 0 || strcmp(options.output, "-") == 0)) {
+        return convert_stream(&options);
+    }
+
+    return convert_files(&options);
+}
@@ -0,0 +1,934 @@
+/*  lsrac_batch - batch conversion of wav files with lib_simple_raw_audio_converter
+
+    Single file header for converting large numbers of wav files on all cores.
+
+
+USAGE
+
+    Include simple_raw_audio_converter.h and dr_wav.h first (with their implementations
+    in exactly one file, as usual), then, before #including this file,
+        #define LSRAC_BATCH_IMPLEMENTATION
+    in one C++11 file. The implementation uses std::thread, so link with -pthread.
+
+    A batch is a manifest of jobs, one per file:
+
+        lsrac_batch_job_t jobs[2] = {};
+        jobs[0].src_path   = "in/a.wav";
+        jobs[0].dst_path   = "out/a.wav";
+        jobs[0].dst_rate   = 48000;
+        jobs[0].dst_format = LSRAC_FORMAT_S16;
+        jobs[0].gain       = 1.0f;
+        ...
+
+        lsrac_batch_options_t options;
+        lsrac_batch_default_options(&options);
+
+        lsrac_batch_stats_t stats;
+        lsrac_batch_run(jobs, 2, &options, &stats);
+
+    Every file is split into segments of about options.segment_frames source frames,
+    and files and segments are scheduled on a work stealing pool: each worker takes
+    work from its own queue and steals from the others when it runs dry, so a few
+    huge files do not leave cores idle at the end of a batch. Segments are converted
+    with lsrac_stream_seek(), so the output is the same as converting the file in one
+    pass (apart from dither noise, which restarts at every segment).
+
+    While a worker converts one chunk of a segment, the next chunk is read in the
+    background.
+
+    After the run every job holds its result, frame counts and throughput, and stats
+    holds the totals for the whole batch.
+
+    For scrubbing through long files, lsrac_batch_read_range() converts any range of
+    output frames of an open wav. It seeks to the source frames that range depends on
+    and reads only those, so the cost depends on the length of the range and the
+    filter, not on where the range starts:
+
+        drwav * wav = drwav_open_file("in/a.wav");
+        lsrac_plan_init(&plan, wav->sampleRate, 48000, wav->channels, NULL);
+        lsrac_batch_read_range(wav, &plan, dst, 3600 * 48000, 4800, &read);
+
+    MS ADPCM and IMA ADPCM files are decoded a whole block at a time. Blocks do not
+    depend on each other, so lsrac_batch_read_f32() decodes the blocks of a read on
+    several threads; lsrac_batch_read_range() uses all hardware threads for this, while
+    the segments of a batch each decode on their worker's reader thread, which reads the
+    next chunk while the worker converts the current one.
+
+
+OPTIONS
+
+    #define these before including this file.
+
+    #define LSRAC_BATCH_SEGMENT_FRAMES
+        Default source frames per segment (default 1 << 20).
+
+    #define LSRAC_BATCH_CHUNK_FRAMES
+        Default source frames read at a time (default 1 << 16).
+
+    #define LSRAC_BATCH_DECODE_BLOCKS
+        Fewest ADPCM blocks worth handing to another decoding thread (default 32).
+
+
+AUTHOR
+
+    Torkel Danielsson
+
+
+LICENSE
+
+    LGPL
+
+*/
+
+#ifndef INCLUDE_LSRAC_BATCH_H
+#define INCLUDE_LSRAC_BATCH_H
+
+#ifndef INCLUDE_SIMPLE_RAW_AUDIO_CONVERTER_H
+#include "simple_raw_audio_converter.h"
+#endif
+
+#ifndef dr_wav_h
+#include "dr_wav.h"
+#endif
+
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef LSRAC_BATCH_SEGMENT_FRAMES
+#define LSRAC_BATCH_SEGMENT_FRAMES    (1 << 20)
+#endif
+
+#ifndef LSRAC_BATCH_CHUNK_FRAMES
+#define LSRAC_BATCH_CHUNK_FRAMES      (1 << 16)
+#endif
+
+#ifndef LSRAC_BATCH_DECODE_BLOCKS
+#define LSRAC_BATCH_DECODE_BLOCKS     32
+#endif
+
+typedef struct lsrac_batch_job_s {
+    const char *  src_path;
+    const char *  dst_path;
+    uint32_t      dst_rate;             // 0 = same as the source
+    uint32_t      dst_format;           // LSRAC_FORMAT_*
+    float         gain;
+    uint32_t      output_flags;         // LSRAC_OUTPUT_*
+    uint32_t      quality;              // LSRAC_QUALITY_*
+
+    // Filled in by lsrac_batch_run()
+    int32_t       result;               // LSRAC_RET_VAL_*
+    uint64_t      src_frames;
+    uint64_t      dst_frames;
+    uint32_t      segments;
+    double        busy_seconds;         // time spent on the job, summed over all workers
+    double        frames_per_second;    // src_frames / busy_seconds
+} lsrac_batch_job_t;
+
+typedef struct lsrac_batch_options_s {
+    uint32_t      threads;              // 0 = one per hardware thread
+    uint64_t      segment_frames;       // source frames per segment
+    uint64_t      chunk_frames;         // source frames read at a time
+} lsrac_batch_options_t;
+
+typedef struct lsrac_batch_stats_s {
+    uint32_t      jobs_ok;
+    uint32_t      jobs_failed;
+    uint64_t      src_frames;
+    uint64_t      dst_frames;
+    uint64_t      tasks;
+    uint64_t      steals;               // tasks taken from another worker's queue
+    double        seconds;              // wall clock time of the whole batch
+    double        frames_per_second;    // src_frames / seconds
+} lsrac_batch_stats_t;
+
+void lsrac_batch_default_options(lsrac_batch_options_t * options);
+
+// Size of the header lsrac_batch_write_wav_header() writes.
+#define LSRAC_BATCH_WAV_HEADER_BYTES 44
+
+// Writes a canonical wav header for frames frames of format (LSRAC_FORMAT_*) samples.
+int32_t lsrac_batch_write_wav_header(FILE * file, uint32_t channels, uint32_t sample_rate, uint32_t format, uint64_t frames);
+
+// Converts all jobs. Returns LSRAC_RET_VAL_OK when every job succeeded, otherwise
+// LSRAC_RET_VAL_ERROR and the failed jobs have their result set. options and stats may
+// be NULL.
+int32_t lsrac_batch_run(
+        lsrac_batch_job_t *            jobs,
+        size_t                         job_count,
+        const lsrac_batch_options_t *  options,
+        lsrac_batch_stats_t *          stats);
+
+// Converts output frames [dst_first, dst_first + dst_frames) of wav with plan (made for
+// the wav's sample rate and channels) into dst_data, as interleaved floats. Seeks to and
+// reads only the source frames of lsrac_plan_src_window(), and the frames are identical to
+// the ones a conversion of the whole file gives. Frames past the end of the output are not
+// written; the number of frames written is returned in dst_frames_read. Every call
+// allocates a buffer for the source frames and a temporary stream, so converting a long
+// stretch is cheaper through one seeked stream (see lsrac_stream_seek()).
+int32_t lsrac_batch_read_range(
+        drwav *                        wav,
+        const lsrac_plan_t *           plan,
+        float *                        dst_data,
+        uint64_t                       dst_first,
+        uint64_t                       dst_frames,
+        uint64_t *                     dst_frames_read);
+
+// Reads frames frames of wav as interleaved floats, like drwav_read_f32(). The whole
+// blocks of MS ADPCM and IMA ADPCM data are read at once and decoded on up to threads
+// threads (0 = one per hardware thread). Returns the number of frames read.
+uint64_t lsrac_batch_read_f32(
+        drwav *                        wav,
+        float *                        dst_data,
+        uint64_t                       frames,
+        uint32_t                       threads);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // INCLUDE_LSRAC_BATCH_H
+
+#ifdef LSRAC_BATCH_IMPLEMENTATION
+
+#include <string.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Shared state of one job while its segments are being converted.
+typedef struct lsrac__batch_file_s {
+    lsrac_batch_job_t *    job;
+    lsrac_plan_t           plan;
+    uint32_t               channels;
+    uint64_t               src_frames;
+    uint64_t               dst_frames;
+    size_t                 frame_bytes;     // bytes per output frame
+    FILE *                 dst_file;
+    std::mutex             write_mutex;
+    std::atomic<uint32_t>  segments_left;
+    std::atomic<int32_t>   result;
+    std::atomic<uint64_t>  busy_ns;
+} lsrac__batch_file_t;
+
+// A job that still has to be opened (file == NULL), or one segment of an opened job.
+typedef struct lsrac__batch_task_s {
+    size_t                 job_index;
+    lsrac__batch_file_t *  file;
+    uint32_t               segment;
+    uint64_t               dst_first;
+    uint64_t               dst_count;
+} lsrac__batch_task_t;
+
+typedef struct lsrac__batch_queue_s {
+    std::mutex                       mutex;
+    std::deque<lsrac__batch_task_t>  tasks;
+} lsrac__batch_queue_t;
+
+// Reads ahead for one worker: the worker hands it one read at a time and collects it
+// once the chunk before has been converted.
+typedef struct lsrac__batch_reader_s {
+    std::mutex               mutex;
+    std::condition_variable  changed;
+    drwav *                  wav;
+    float *                  dst;
+    uint64_t                 frames;
+    uint64_t                 read;
+    bool                     busy;          // a read has been handed over and not finished
+    bool                     stop;
+    std::thread              thread;
+} lsrac__batch_reader_t;
+
+typedef struct lsrac__batch_s {
+    lsrac_batch_job_t *                                 jobs;
+    lsrac_batch_options_t                               options;
+    std::vector<std::unique_ptr<lsrac__batch_queue_t>>  queues;
+    std::vector<std::unique_ptr<lsrac__batch_reader_t>> readers;
+    std::vector<std::unique_ptr<lsrac__batch_file_t>>   files;
+    std::mutex                                          idle_mutex;
+    std::condition_variable                             work_changed;   // tasks were queued, or all work is done
+    std::atomic<size_t>                                 queued;         // tasks waiting in the queues
+    std::atomic<size_t>                                 pending;
+    std::atomic<uint64_t>                               tasks;
+    std::atomic<uint64_t>                               steals;
+} lsrac__batch_t;
+
+void lsrac_batch_default_options(lsrac_batch_options_t * options)
+{
+    options->threads        = 0;
+    options->segment_frames = LSRAC_BATCH_SEGMENT_FRAMES;
+    options->chunk_frames   = LSRAC_BATCH_CHUNK_FRAMES;
+}
+
+
+/*
+ *  Wav output
+ */
+
+static void lsrac__batch_put_u16(uint8_t * dst, uint32_t value)
+{
+    dst[0] = static_cast<uint8_t>(value);
+    dst[1] = static_cast<uint8_t>(value >> 8);
+}
+
+static void lsrac__batch_put_u32(uint8_t * dst, uint32_t value)
+{
+    lsrac__batch_put_u16(dst, value);
+    lsrac__batch_put_u16(dst + 2, value >> 16);
+}
+
+int32_t lsrac_batch_write_wav_header(FILE * file, uint32_t channels, uint32_t sample_rate, uint32_t format, uint64_t frames)
+{
+    uint32_t sample_bytes = format == LSRAC_FORMAT_S16 ? 2 : format == LSRAC_FORMAT_S24 ? 3 : 4;
+    uint64_t data_bytes = frames * channels * sample_bytes;
+
+    if (data_bytes > 0xFFFFFFFFull - LSRAC_BATCH_WAV_HEADER_BYTES) {
+        return LSRAC_RET_VAL_ERROR;
+    }
+
+    uint8_t header[LSRAC_BATCH_WAV_HEADER_BYTES];
+
+    memcpy(header, "RIFF", 4);
+    lsrac__batch_put_u32(header + 4, static_cast<uint32_t>(data_bytes) + LSRAC_BATCH_WAV_HEADER_BYTES - 8);
+    memcpy(header + 8, "WAVEfmt ", 8);
+    lsrac__batch_put_u32(header + 16, 16);
+    lsrac__batch_put_u16(header + 20, format == LSRAC_FORMAT_F32 ? 3 : 1);     // IEEE float or PCM
+    lsrac__batch_put_u16(header + 22, channels);
+    lsrac__batch_put_u32(header + 24, sample_rate);
+    lsrac__batch_put_u32(header + 28, sample_rate * channels * sample_bytes);
+    lsrac__batch_put_u16(header + 32, channels * sample_bytes);
+    lsrac__batch_put_u16(header + 34, 8 * sample_bytes);
+    memcpy(header + 36, "data", 4);
+    lsrac__batch_put_u32(header + 40, static_cast<uint32_t>(data_bytes));
+
+    if (fwrite(header, 1, sizeof(header), file) != sizeof(header)) {
+        return LSRAC_RET_VAL_ERROR;
+    }
+
+    return LSRAC_RET_VAL_OK;
+}
+
+
+/*
+ *  Tasks
+ */
+
+static void lsrac__batch_push(lsrac__batch_t * batch, uint32_t worker, const lsrac__batch_task_t & task)
+{
+    batch->pending.fetch_add(1);
+
+    {
+        lsrac__batch_queue_t * queue = batch->queues[worker].get();
+        std::lock_guard<std::mutex> lock(queue->mutex);
+        queue->tasks.push_back(task);
+        batch->queued.fetch_add(1);
+    }
+
+    // Taking the lock orders this with a worker about to wait
+    {
+        std::lock_guard<std::mutex> lock(batch->idle_mutex);
+    }
+    batch->work_changed.notify_one();
+}
+
+// Own work is taken from the back (most recently split off, still warm in cache), stolen
+// work from the front (the oldest and usually largest remaining work).
+static bool lsrac__batch_pop(lsrac__batch_t * batch, uint32_t worker, lsrac__batch_task_t * task)
+{
+    {
+        lsrac__batch_queue_t * queue = batch->queues[worker].get();
+        std::lock_guard<std::mutex> lock(queue->mutex);
+        if (!queue->tasks.empty()) {
+            *task = queue->tasks.back();
+            queue->tasks.pop_back();
+            batch->queued.fetch_sub(1);
+            return true;
+        }
+    }
+
+    uint32_t worker_count = static_cast<uint32_t>(batch->queues.size());
+
+    for (uint32_t i = 1; i < worker_count; ++i) {
+        lsrac__batch_queue_t * queue = batch->queues[(worker + i) % worker_count].get();
+        std::lock_guard<std::mutex> lock(queue->mutex);
+        if (!queue->tasks.empty()) {
+            *task = queue->tasks.front();
+            queue->tasks.pop_front();
+            batch->queued.fetch_sub(1);
+            batch->steals.fetch_add(1);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static void lsrac__batch_finish_segment(lsrac__batch_file_t * file)
+{
+    if (file->segments_left.fetch_sub(1) != 1) {
+        return;
+    }
+
+    // Last segment of the file
+    if (file->dst_file != nullptr && fclose(file->dst_file) != 0) {
+        file->result.store(LSRAC_RET_VAL_ERROR);
+    }
+    file->dst_file = nullptr;
+
+    lsrac_plan_uninit(&file->plan);
+
+    file->job->result = file->result.load();
+}
+
+static void lsrac__batch_open(lsrac__batch_t * batch, uint32_t worker, size_t job_index)
+{
+    lsrac_batch_job_t * job = batch->jobs + job_index;
+    lsrac__batch_file_t * file = batch->files[job_index].get();
+
+    drwav * wav = drwav_open_file(job->src_path);
+    if (wav == nullptr) {
+        job->result = LSRAC_RET_VAL_ERROR;
+        return;
+    }
+
+    file->channels   = wav->channels;
+    file->src_frames = wav->totalSampleCount / wav->channels;
+    uint32_t src_rate = wav->sampleRate;
+    uint32_t dst_rate = job->dst_rate != 0 ? job->dst_rate : src_rate;
+
+    drwav_close(wav);
+
+    if (lsrac_plan_init(&file->plan, src_rate, dst_rate, file->channels, nullptr) != LSRAC_RET_VAL_OK ||
+        lsrac_plan_set_quality(&file->plan, job->quality) != LSRAC_RET_VAL_OK ||
+        job->dst_format > LSRAC_FORMAT_S32) {
+        lsrac_plan_uninit(&file->plan);
+        job->result = LSRAC_RET_VAL_ARGUMENT_ERROR;
+        return;
+    }
+
+    const lsrac_plan_t * plan = &file->plan;
+
+    // The frame count lsrac_stream_flush() arrives at for the whole file
+    file->dst_frames  = (file->src_frames * plan->dst_rate + plan->src_rate - 1) / plan->src_rate;
+    file->frame_bytes = file->channels * (job->dst_format == LSRAC_FORMAT_S16 ? 2 : job->dst_format == LSRAC_FORMAT_S24 ? 3 : 4);
+
+    job->src_frames = file->src_frames;
+    job->dst_frames = file->dst_frames;
+
+    file->dst_file = fopen(job->dst_path, "wb");
+    if (file->dst_file == nullptr ||
+        lsrac_batch_write_wav_header(file->dst_file, file->channels, dst_rate, job->dst_format, file->dst_frames) != LSRAC_RET_VAL_OK) {
+        if (file->dst_file != nullptr) {
+            fclose(file->dst_file);
+            file->dst_file = nullptr;
+        }
+        lsrac_plan_uninit(&file->plan);
+        job->result = LSRAC_RET_VAL_ERROR;
+        return;
+    }
+
+    uint64_t segment_dst_frames = batch->options.segment_frames * plan->dst_rate / plan->src_rate;
+    if (segment_dst_frames == 0) {
+        segment_dst_frames = 1;
+    }
+
+    uint64_t segments = (file->dst_frames + segment_dst_frames - 1) / segment_dst_frames;
+    if (segments == 0) {
+        segments = 1;
+    }
+
+    job->segments = static_cast<uint32_t>(segments);
+    file->segments_left.store(static_cast<uint32_t>(segments));
+
+    // Pushed in reverse so this worker starts at the beginning of the file while thieves
+    // take segments from the end.
+    for (uint64_t s = segments; s-- > 0;) {
+        lsrac__batch_task_t task;
+        task.job_index = job_index;
+        task.file      = file;
+        task.segment   = static_cast<uint32_t>(s);
+        task.dst_first = s * segment_dst_frames;
+        task.dst_count = s + 1 < segments ? segment_dst_frames : file->dst_frames - s * segment_dst_frames;
+        lsrac__batch_push(batch, worker, task);
+    }
+}
+
+// Decodes blocks [first, end) of raw into dst, keeping only the samples before sample_end
+static void lsrac__batch_decode_blocks(drwav * wav, const uint8_t * raw, float * dst, uint64_t first, uint64_t end, uint64_t sample_end)
+{
+    uint64_t block_samples = drwav_samples_per_block(wav);
+    std::vector<drwav_int16> samples(static_cast<size_t>(block_samples));
+
+    for (uint64_t b = first; b < end; ++b) {
+        uint64_t sample = b * block_samples;
+        uint64_t count = sample_end - sample < block_samples ? sample_end - sample : block_samples;
+
+        drwav_decode_blocks_s16(wav, raw + b * wav->fmt.blockAlign, 1, samples.data());
+        drwav_s16_to_f32(dst + sample, samples.data(), static_cast<size_t>(count));
+    }
+}
+
+uint64_t lsrac_batch_read_f32(
+        drwav *                        wav,
+        float *                        dst_data,
+        uint64_t                       frames,
+        uint32_t                       threads)
+{
+    if (wav == nullptr || dst_data == nullptr || wav->channels == 0) {
+        return 0;
+    }
+
+    uint32_t channels = wav->channels;
+    uint64_t samples = frames * channels;
+    uint64_t block_samples = drwav_samples_per_block(wav);
+
+    if (block_samples == 0 || samples < 2 * block_samples) {
+        return drwav_read_f32(wav, samples, dst_data) / channels;
+    }
+
+    // Up to the start of the next block, through the decoder
+    uint64_t head = (block_samples - wav->compressed.iCurrentSample % block_samples) % block_samples;
+    uint64_t done = head != 0 ? drwav_read_f32(wav, head, dst_data) : 0;
+    if (done != head) {
+        return done / channels;
+    }
+
+    // The whole blocks, read at once and decoded in parallel
+    uint64_t first_sample = wav->compressed.iCurrentSample;
+    uint64_t blocks = (samples - done) / block_samples;
+    std::vector<uint8_t> raw(static_cast<size_t>(blocks * wav->fmt.blockAlign));
+
+    // Only the blocks that were read, a truncated last block goes through the decoder below
+    blocks = drwav_read_raw_blocks(wav, blocks, raw.data());
+    uint64_t decoded = blocks * block_samples < wav->totalSampleCount - first_sample ? blocks * block_samples : wav->totalSampleCount - first_sample;
+
+    if (threads == 0) {
+        threads = std::thread::hardware_concurrency();
+    }
+    uint64_t max_threads = blocks / LSRAC_BATCH_DECODE_BLOCKS;
+    if (threads > max_threads) {
+        threads = static_cast<uint32_t>(max_threads);
+    }
+    if (threads == 0) {
+        threads = 1;
+    }
+
+    std::vector<std::future<void>> decoders;
+    for (uint32_t t = 1; t < threads; ++t) {
+        decoders.push_back(std::async(std::launch::async, lsrac__batch_decode_blocks, wav, raw.data(), dst_data + done,
+                                      blocks * t / threads, blocks * (t + 1) / threads, decoded));
+    }
+    lsrac__batch_decode_blocks(wav, raw.data(), dst_data + done, 0, blocks / threads, decoded);
+    for (std::future<void> & decoder : decoders) {
+        decoder.get();
+    }
+
+    done += decoded;
+
+    // The rest of the last block, or a block cut short, through the decoder again
+    if (done < samples && decoded == blocks * block_samples) {
+        done += drwav_read_f32(wav, samples - done, dst_data + done);
+    }
+
+    return done / channels;
+}
+
+static void lsrac__batch_reader_main(lsrac__batch_reader_t * reader)
+{
+    std::unique_lock<std::mutex> lock(reader->mutex);
+
+    for (;;) {
+        reader->changed.wait(lock, [reader] { return reader->busy || reader->stop; });
+        if (!reader->busy) {
+            return;
+        }
+
+        lock.unlock();
+        uint64_t read = lsrac_batch_read_f32(reader->wav, reader->dst, reader->frames, 1);
+        lock.lock();
+
+        reader->read = read;
+        reader->busy = false;
+        reader->changed.notify_all();
+    }
+}
+
+static void lsrac__batch_reader_start(lsrac__batch_reader_t * reader, drwav * wav, float * dst, uint64_t frames)
+{
+    {
+        std::lock_guard<std::mutex> lock(reader->mutex);
+        reader->wav    = wav;
+        reader->dst    = dst;
+        reader->frames = frames;
+        reader->busy   = true;
+    }
+    reader->changed.notify_all();
+}
+
+// Waits for the read handed over by lsrac__batch_reader_start() and returns the frames read.
+static uint64_t lsrac__batch_reader_wait(lsrac__batch_reader_t * reader)
+{
+    std::unique_lock<std::mutex> lock(reader->mutex);
+    reader->changed.wait(lock, [reader] { return !reader->busy; });
+    return reader->read;
+}
+
+static int32_t lsrac__batch_convert_segment(lsrac__batch_t * batch, uint32_t worker, const lsrac__batch_task_t & task)
+{
+    lsrac__batch_file_t * file = task.file;
+    lsrac_batch_job_t * job = file->job;
+    const lsrac_plan_t * plan = &file->plan;
+    uint32_t channels = file->channels;
+
+    if (file->result.load() != LSRAC_RET_VAL_OK) {
+        return LSRAC_RET_VAL_ERROR;
+    }
+
+    lsrac_stream_t stream;
+    if (lsrac_stream_init(&stream, plan, nullptr) != LSRAC_RET_VAL_OK) {
+        return LSRAC_RET_VAL_OUT_OF_MEMORY;
+    }
+
+    lsrac_stream_set_output(&stream, job->gain, job->output_flags);
+    stream.output.random += 0x9e3779b9u * task.segment;
+
+    uint64_t src_first;
+    uint64_t src_end;
+    lsrac_plan_src_window(plan, task.dst_first, task.dst_count, &src_first, &src_end);
+    lsrac_stream_seek(&stream, task.dst_first, &src_first);
+
+    bool last = src_end >= file->src_frames;
+    if (last) {
+        src_end = file->src_frames;
+    }
+
+    drwav * wav = drwav_open_file(job->src_path);
+    if (wav == nullptr || !drwav_seek_to_sample(wav, src_first * channels)) {
+        drwav_close(wav);
+        lsrac_stream_uninit(&stream);
+        return LSRAC_RET_VAL_ERROR;
+    }
+
+    uint64_t chunk_frames = batch->options.chunk_frames;
+    uint64_t dst_capacity = chunk_frames * plan->dst_rate / plan->src_rate + 2;
+
+    std::vector<float>   src_chunks(2 * chunk_frames * channels);
+    std::vector<uint8_t> dst_chunk(dst_capacity * file->frame_bytes);
+
+    float * chunks[2] = { src_chunks.data(), src_chunks.data() + chunk_frames * channels };
+
+    lsrac__batch_reader_t * reader = batch->readers[worker].get();
+
+    lsrac_buffer_t dst;
+    lsrac_buffer_interleaved(&dst, dst_chunk.data(), channels, job->dst_format);
+
+    int32_t result = LSRAC_RET_VAL_OK;
+    uint64_t src_position = src_first;
+    uint64_t dst_done = 0;
+
+    // Writes the frames in dst_chunk to their place in the output file
+    auto write_out = [&](uint64_t frames) {
+        if (frames == 0) {
+            return;
+        }
+        long offset = static_cast<long>(LSRAC_BATCH_WAV_HEADER_BYTES + (task.dst_first + dst_done) * file->frame_bytes);
+        std::lock_guard<std::mutex> lock(file->write_mutex);
+        if (fseek(file->dst_file, offset, SEEK_SET) != 0 ||
+            fwrite(dst_chunk.data(), file->frame_bytes, frames, file->dst_file) != frames) {
+            result = LSRAC_RET_VAL_ERROR;
+        }
+        dst_done += frames;
+    };
+
+    uint64_t first_count = src_end - src_position < chunk_frames ? src_end - src_position : chunk_frames;
+    uint64_t chunk_count = lsrac_batch_read_f32(wav, chunks[0], first_count, 1);
+    uint32_t current = 0;
+
+    while (chunk_count != 0 && result == LSRAC_RET_VAL_OK && dst_done < task.dst_count) {
+        src_position += chunk_count;
+
+        // The worker's reader reads the next chunk while this one is converted. The other
+        // workers keep the cores busy, so ADPCM blocks are decoded on that one thread.
+        uint64_t next_count = src_end - src_position < chunk_frames ? src_end - src_position : chunk_frames;
+        if (next_count != 0) {
+            lsrac__batch_reader_start(reader, wav, chunks[current ^ 1], next_count);
+        }
+
+        lsrac_buffer_t src;
+        lsrac_buffer_interleaved(&src, chunks[current], channels, LSRAC_FORMAT_F32);
+
+        uint64_t read = 0;
+        while (read < chunk_count && result == LSRAC_RET_VAL_OK && dst_done < task.dst_count) {
+            uint64_t dst_frames = task.dst_count - dst_done < dst_capacity ? task.dst_count - dst_done : dst_capacity;
+            uint64_t written = 0;
+            uint64_t consumed = 0;
+            lsrac_stream_process_buffers(&stream, &dst, dst_frames, &written, &src, chunk_count - read, &consumed);
+            lsrac_buffer_advance(&src, consumed);
+            read += consumed;
+            write_out(written);
+        }
+
+        chunk_count = next_count != 0 ? lsrac__batch_reader_wait(reader) : 0;
+        current ^= 1;
+    }
+
+    while (last && result == LSRAC_RET_VAL_OK && dst_done < task.dst_count) {
+        uint64_t dst_frames = task.dst_count - dst_done < dst_capacity ? task.dst_count - dst_done : dst_capacity;
+        uint64_t written = 0;
+        lsrac_stream_flush_buffers(&stream, &dst, dst_frames, &written);
+        if (written == 0) {
+            break;
+        }
+        write_out(written);
+    }
+
+    if (dst_done != task.dst_count) {
+        result = LSRAC_RET_VAL_ERROR;
+    }
+
+    drwav_close(wav);
+    lsrac_stream_uninit(&stream);
+
+    return result;
+}
+
+static void lsrac__batch_worker(lsrac__batch_t * batch, uint32_t worker)
+{
+    while (batch->pending.load() != 0) {
+        lsrac__batch_task_t task;
+        if (!lsrac__batch_pop(batch, worker, &task)) {
+            // Sleeps until a task is queued somewhere or the last one has finished
+            std::unique_lock<std::mutex> lock(batch->idle_mutex);
+            batch->work_changed.wait(lock, [batch] { return batch->queued.load() != 0 || batch->pending.load() == 0; });
+            continue;
+        }
+
+        auto start = std::chrono::steady_clock::now();
+
+        if (task.file == nullptr) {
+            lsrac__batch_open(batch, worker, task.job_index);
+        } else {
+            int32_t result = lsrac__batch_convert_segment(batch, worker, task);
+            if (result != LSRAC_RET_VAL_OK) {
+                task.file->result.store(result);
+            }
+        }
+
+        auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+
+        lsrac__batch_file_t * file = batch->files[task.job_index].get();
+        file->busy_ns.fetch_add(static_cast<uint64_t>(elapsed.count()));
+
+        if (task.file != nullptr) {
+            lsrac__batch_finish_segment(task.file);
+        }
+
+        batch->tasks.fetch_add(1);
+        if (batch->pending.fetch_sub(1) == 1) {
+            {
+                std::lock_guard<std::mutex> lock(batch->idle_mutex);
+            }
+            batch->work_changed.notify_all();
+        }
+    }
+}
+
+int32_t lsrac_batch_run(
+        lsrac_batch_job_t *            jobs,
+        size_t                         job_count,
+        const lsrac_batch_options_t *  options,
+        lsrac_batch_stats_t *          stats)
+{
+    if (stats != nullptr) {
+        memset(stats, 0, sizeof(*stats));
+    }
+
+    if (jobs == nullptr && job_count != 0) {
+        return LSRAC_RET_VAL_ARGUMENT_ERROR;
+    }
+
+    lsrac__batch_t batch;
+    batch.jobs = jobs;
+    batch.queued.store(0);
+    batch.pending.store(0);
+    batch.tasks.store(0);
+    batch.steals.store(0);
+
+    lsrac_batch_default_options(&batch.options);
+    if (options != nullptr) {
+        batch.options = *options;
+    }
+    if (batch.options.threads == 0) {
+        batch.options.threads = std::thread::hardware_concurrency();
+    }
+    if (batch.options.threads == 0) {
+        batch.options.threads = 1;
+    }
+    if (batch.options.segment_frames == 0) {
+        batch.options.segment_frames = LSRAC_BATCH_SEGMENT_FRAMES;
+    }
+    if (batch.options.chunk_frames == 0) {
+        batch.options.chunk_frames = LSRAC_BATCH_CHUNK_FRAMES;
+    }
+
+    uint32_t worker_count = batch.options.threads;
+
+    for (uint32_t i = 0; i < worker_count; ++i) {
+        batch.queues.emplace_back(new lsrac__batch_queue_t);
+
+        lsrac__batch_reader_t * reader = new lsrac__batch_reader_t;
+        reader->wav    = nullptr;
+        reader->dst    = nullptr;
+        reader->frames = 0;
+        reader->read   = 0;
+        reader->busy   = false;
+        reader->stop   = false;
+        reader->thread = std::thread(lsrac__batch_reader_main, reader);
+        batch.readers.emplace_back(reader);
+    }
+
+    for (size_t i = 0; i < job_count; ++i) {
+        batch.files.emplace_back(new lsrac__batch_file_t);
+        batch.files[i]->job = jobs + i;
+        batch.files[i]->dst_file = nullptr;
+        memset(&batch.files[i]->plan, 0, sizeof(lsrac_plan_t));
+        batch.files[i]->result.store(LSRAC_RET_VAL_OK);
+        batch.files[i]->busy_ns.store(0);
+        batch.files[i]->segments_left.store(0);
+
+        jobs[i].result            = LSRAC_RET_VAL_OK;
+        jobs[i].src_frames        = 0;
+        jobs[i].dst_frames        = 0;
+        jobs[i].segments          = 0;
+        jobs[i].busy_seconds      = 0.0;
+        jobs[i].frames_per_second = 0.0;
+
+        lsrac__batch_task_t task;
+        task.job_index = i;
+        task.file      = nullptr;
+        task.segment   = 0;
+        task.dst_first = 0;
+        task.dst_count = 0;
+        lsrac__batch_push(&batch, static_cast<uint32_t>(i % worker_count), task);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+
+    std::vector<std::thread> threads;
+    for (uint32_t i = 1; i < worker_count; ++i) {
+        threads.emplace_back(lsrac__batch_worker, &batch, i);
+    }
+    lsrac__batch_worker(&batch, 0);
+    for (std::thread & thread : threads) {
+        thread.join();
+    }
+
+    for (std::unique_ptr<lsrac__batch_reader_t> & reader : batch.readers) {
+        {
+            std::lock_guard<std::mutex> lock(reader->mutex);
+            reader->stop = true;
+        }
+        reader->changed.notify_all();
+        reader->thread.join();
+    }
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    int32_t result = LSRAC_RET_VAL_OK;
+
+    lsrac_batch_stats_t totals;
+    memset(&totals, 0, sizeof(totals));
+
+    for (size_t i = 0; i < job_count; ++i) {
+        jobs[i].busy_seconds      = static_cast<double>(batch.files[i]->busy_ns.load()) * 1e-9;
+        jobs[i].frames_per_second = jobs[i].busy_seconds > 0.0 ? static_cast<double>(jobs[i].src_frames) / jobs[i].busy_seconds : 0.0;
+
+        if (jobs[i].result == LSRAC_RET_VAL_OK) {
+            totals.jobs_ok += 1;
+            totals.src_frames += jobs[i].src_frames;
+            totals.dst_frames += jobs[i].dst_frames;
+        } else {
+            totals.jobs_failed += 1;
+            result = LSRAC_RET_VAL_ERROR;
+        }
+    }
+
+    totals.tasks             = batch.tasks.load();
+    totals.steals            = batch.steals.load();
+    totals.seconds           = seconds;
+    totals.frames_per_second = seconds > 0.0 ? static_cast<double>(totals.src_frames) / seconds : 0.0;
+
+    if (stats != nullptr) {
+        *stats = totals;
+    }
+
+    return result;
+}
+
+int32_t lsrac_batch_read_range(
+        drwav *                        wav,
+        const lsrac_plan_t *           plan,
+        float *                        dst_data,
+        uint64_t                       dst_first,
+        uint64_t                       dst_frames,
+        uint64_t *                     dst_frames_read)
+{
+    if (dst_frames_read != nullptr) {
+        *dst_frames_read = 0;
+    }
+
+    if (wav == nullptr ||
+        plan == nullptr ||
+        wav->channels != plan->channels ||
+        (dst_frames != 0 && dst_data == nullptr)) {
+        return LSRAC_RET_VAL_ARGUMENT_ERROR;
+    }
+
+    uint32_t channels = wav->channels;
+    uint64_t src_total = wav->totalSampleCount / channels;
+    uint64_t dst_total = lsrac_plan_dst_frames(plan, src_total);
+
+    if (dst_first >= dst_total) {
+        return LSRAC_RET_VAL_OK;
+    }
+    if (dst_frames > dst_total - dst_first) {
+        dst_frames = dst_total - dst_first;
+    }
+
+    uint64_t src_first;
+    uint64_t src_end;
+    lsrac_plan_src_window(plan, dst_first, dst_frames, &src_first, &src_end);
+
+    if (src_end > src_total) {
+        src_end = src_total;
+    }
+    if (src_first > src_end) {
+        src_first = src_end;
+    }
+
+    std::vector<float> src((src_end - src_first) * channels);
+
+    if (!drwav_seek_to_sample(wav, src_first * channels) ||
+        lsrac_batch_read_f32(wav, src.data(), src_end - src_first, 0) != src_end - src_first) {
+        return LSRAC_RET_VAL_ERROR;
+    }
+
+    int32_t result = lsrac_plan_convert(plan, dst_data, src.data(), dst_first, src_first, dst_frames, src_end - src_first, src_total);
+
+    if (result == LSRAC_RET_VAL_OK && dst_frames_read != nullptr) {
+        *dst_frames_read = dst_frames;
+    }
+
+    return result;
+}
+
+#endif // LSRAC_BATCH_IMPLEMENTATION
@@ -0,0 +1,50 @@
+/*  lsrac_daemon - serves sample rate conversions over a Unix domain socket
+
+    usage: lsrac_daemon <socket path> [threads]
+
+    Runs until SIGINT or SIGTERM. See lsrac_service.h for the client library.
+
+*/
+
+#define LSRAC_IMPLEMENTATION
+#include "simple_raw_audio_converter.h"
+
+#define LSRAC_SERVICE_IMPLEMENTATION
+#include "lsrac_service.h"
+
+#include <pthread.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+int main(int argc, char ** argv)
+{
+    if (argc < 2 || argc > 3) {
+        fprintf(stderr, "usage: lsrac_daemon <socket path> [threads]\n");
+        return 2;
+    }
+
+    uint32_t threads = argc == 3 ? static_cast<uint32_t>(strtoul(argv[2], nullptr, 10)) : 0;
+
+    // Block the signals before any thread starts, so only sigwait() below sees them
+    sigset_t signals;
+    sigemptyset(&signals);
+    sigaddset(&signals, SIGINT);
+    sigaddset(&signals, SIGTERM);
+    pthread_sigmask(SIG_BLOCK, &signals, nullptr);
+
+    lsrac_service_t service;
+    if (lsrac_service_start(&service, argv[1], threads) != LSRAC_RET_VAL_OK) {
+        fprintf(stderr, "lsrac_daemon: could not listen on %s\n", argv[1]);
+        return 1;
+    }
+
+    int signal_number = 0;
+    sigwait(&signals, &signal_number);
+
+    lsrac_service_stop(&service);
+    unlink(argv[1]);
+
+    return 0;
+}
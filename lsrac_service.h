@@ -0,0 +1,807 @@
+/*  lsrac_service - sample rate conversion as a local service
+
+    Single file header with a resampling server and its client library, for Linux.
+
+
+USAGE
+
+    Include simple_raw_audio_converter.h first (with its implementation in exactly one
+    file, as usual), then, before #including this file,
+        #define LSRAC_SERVICE_IMPLEMENTATION
+    in one C++11 file. The implementation uses std::thread, so link with -pthread.
+
+    The server listens on a Unix domain socket. It keeps a cache of warm plans and one
+    pool of worker threads shared by all clients:
+
+        lsrac_service_t service;
+        lsrac_service_start(&service, "/run/lsrac.sock", 0);
+        ...
+        lsrac_service_stop(&service);
+
+    lsrac_daemon.cpp wraps this in a standalone daemon.
+
+    Audio never travels through the socket. Every client owns a memfd that it shares
+    with the server once (its descriptor is passed with SCM_RIGHTS), and requests only
+    carry offsets into it. The server reads the input from and writes the output to
+    that shared memory directly:
+
+        lsrac_client_t client;
+        lsrac_client_connect(&client, "/run/lsrac.sock");
+
+        float * src;
+        float * dst;
+        lsrac_client_reserve(&client, src_frames, dst_capacity, channels, &src, &dst);
+        // ... fill src ...
+        lsrac_client_convert_reserved(&client, 44100, 48000, channels, LSRAC_QUALITY_BEST,
+                                      src_frames, dst_capacity, &dst_frames);
+
+        lsrac_client_disconnect(&client);
+
+    lsrac_client_convert() does the same for data that lives in the caller's buffers,
+    at the cost of copying it into and out of the shared memory.
+
+
+OPTIONS
+
+    #define these before including this file.
+
+    #define LSRAC_SERVICE_PLAN_CACHE
+        Number of plans the server keeps warm (default 64).
+
+
+AUTHOR
+
+    Torkel Danielsson
+
+
+LICENSE
+
+    LGPL
+
+*/
+
+#ifndef INCLUDE_LSRAC_SERVICE_H
+#define INCLUDE_LSRAC_SERVICE_H
+
+#ifndef INCLUDE_SIMPLE_RAW_AUDIO_CONVERTER_H
+#include "simple_raw_audio_converter.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef LSRAC_SERVICE_PLAN_CACHE
+#define LSRAC_SERVICE_PLAN_CACHE      64
+#endif
+
+typedef struct lsrac_service_s {
+    void *  internal;
+} lsrac_service_t;
+
+// Starts serving on socket_path (an existing socket file is replaced). threads = 0 uses
+// one worker per hardware thread.
+int32_t lsrac_service_start(lsrac_service_t * service, const char * socket_path, uint32_t threads);
+void lsrac_service_stop(lsrac_service_t * service);
+
+typedef struct lsrac_client_s {
+    int         socket;
+    int         memory_fd;
+    uint8_t *   memory;
+    size_t      memory_size;
+    int32_t     memory_shared;      // the server has the current memory_fd
+    size_t      dst_offset;         // of the area handed out by lsrac_client_reserve()
+} lsrac_client_t;
+
+int32_t lsrac_client_connect(lsrac_client_t * client, const char * socket_path);
+void lsrac_client_disconnect(lsrac_client_t * client);
+
+// Makes room in the shared memory for src_frames and dst_frames frames of channels float
+// samples and returns where they are. The pointers stay valid until the next reserve.
+int32_t lsrac_client_reserve(
+        lsrac_client_t *  client,
+        uint64_t          src_frames,
+        uint64_t          dst_frames,
+        uint32_t          channels,
+        float **          src,
+        float **          dst);
+
+// Converts the src_frames interleaved frames in the reserved source area into the
+// reserved destination area, which has room for dst_capacity frames. Conversions whose
+// output does not fit are refused with LSRAC_RET_VAL_ARGUMENT_ERROR.
+int32_t lsrac_client_convert_reserved(
+        lsrac_client_t *  client,
+        uint32_t          src_rate,
+        uint32_t          dst_rate,
+        uint32_t          channels,
+        uint32_t          quality,
+        uint64_t          src_frames,
+        uint64_t          dst_capacity,
+        uint64_t *        dst_frames);
+
+// Copies src into the shared memory, converts it and copies the result to dst.
+int32_t lsrac_client_convert(
+        lsrac_client_t *  client,
+        uint32_t          src_rate,
+        uint32_t          dst_rate,
+        uint32_t          channels,
+        uint32_t          quality,
+        const float *     src,
+        uint64_t          src_frames,
+        float *           dst,
+        uint64_t          dst_capacity,
+        uint64_t *        dst_frames);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // INCLUDE_LSRAC_SERVICE_H
+
+#ifdef LSRAC_SERVICE_IMPLEMENTATION
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#define LSRAC__SERVICE_MAGIC 0x6c737263u   // "lsrc"
+
+// Messages are sent as single SOCK_SEQPACKET packets.
+typedef struct lsrac__service_request_s {
+    uint32_t  magic;
+    uint32_t  new_memory;       // a memfd is attached, replacing the previous one
+    uint64_t  memory_size;
+    uint32_t  src_rate;
+    uint32_t  dst_rate;
+    uint32_t  channels;
+    uint32_t  quality;
+    uint64_t  src_offset;       // bytes into the shared memory
+    uint64_t  src_frames;
+    uint64_t  dst_offset;
+    uint64_t  dst_capacity;
+} lsrac__service_request_t;
+
+typedef struct lsrac__service_reply_s {
+    uint32_t  magic;
+    int32_t   result;
+    uint64_t  dst_frames;
+} lsrac__service_reply_t;
+
+static size_t lsrac__service_align(size_t size)
+{
+    return (size + LSRAC_DEFAULT_ALIGNMENT - 1) / LSRAC_DEFAULT_ALIGNMENT * LSRAC_DEFAULT_ALIGNMENT;
+}
+
+
+/*
+ *  Server
+ */
+
+typedef std::tuple<uint32_t, uint32_t, uint32_t, uint32_t> lsrac__service_plan_key_t;     // rates, channels, quality
+
+typedef struct lsrac__service_plan_s {
+    lsrac_plan_t  plan;
+    uint64_t      last_used;
+
+    ~lsrac__service_plan_s() { lsrac_plan_uninit(&plan); }
+} lsrac__service_plan_t;
+
+typedef struct lsrac__service_server_s {
+    int                                         listen_socket;
+    std::thread                                 accept_thread;
+    std::atomic<bool>                           stopping;
+
+    // Worker pool shared by all connections
+    std::vector<std::thread>                    workers;
+    std::mutex                                  work_mutex;
+    std::condition_variable                     work_available;
+    std::deque<std::function<void()>>           work;
+
+    // Warm plans, shared by all requests with the same parameters
+    std::mutex                                  plan_mutex;
+    std::map<lsrac__service_plan_key_t, std::shared_ptr<lsrac__service_plan_t>> plans;
+    uint64_t                                    plan_clock;
+
+    // Connection threads are detached and remove themselves when their client leaves
+    std::mutex                                  connection_mutex;
+    std::condition_variable                     connection_closed;
+    std::vector<int>                            connection_sockets;
+} lsrac__service_server_t;
+
+static std::shared_ptr<lsrac__service_plan_t> lsrac__service_plan(lsrac__service_server_t * server, const lsrac__service_request_t & request)
+{
+    lsrac__service_plan_key_t key(request.src_rate, request.dst_rate, request.channels, request.quality);
+
+    std::lock_guard<std::mutex> lock(server->plan_mutex);
+
+    server->plan_clock += 1;
+
+    auto found = server->plans.find(key);
+    if (found != server->plans.end()) {
+        found->second->last_used = server->plan_clock;
+        return found->second;
+    }
+
+    std::shared_ptr<lsrac__service_plan_t> entry(new lsrac__service_plan_t);
+    memset(&entry->plan, 0, sizeof(entry->plan));
+    entry->last_used = server->plan_clock;
+
+    if (lsrac_plan_init(&entry->plan, request.src_rate, request.dst_rate, request.channels, nullptr) != LSRAC_RET_VAL_OK ||
+        lsrac_plan_set_quality(&entry->plan, request.quality) != LSRAC_RET_VAL_OK) {
+        return nullptr;
+    }
+
+    // Requests still using an evicted plan keep it alive through their shared_ptr
+    if (server->plans.size() >= LSRAC_SERVICE_PLAN_CACHE) {
+        auto oldest = server->plans.begin();
+        for (auto it = server->plans.begin(); it != server->plans.end(); ++it) {
+            if (it->second->last_used < oldest->second->last_used) {
+                oldest = it;
+            }
+        }
+        server->plans.erase(oldest);
+    }
+
+    server->plans[key] = entry;
+
+    return entry;
+}
+
+static int32_t lsrac__service_convert(
+        lsrac__service_server_t *         server,
+        const lsrac__service_request_t &  request,
+        uint8_t *                         memory,
+        uint64_t *                        dst_frames)
+{
+    std::shared_ptr<lsrac__service_plan_t> entry = lsrac__service_plan(server, request);
+    if (!entry) {
+        return LSRAC_RET_VAL_ARGUMENT_ERROR;
+    }
+
+    // Refused rather than cut off, the client would not know the output is incomplete
+    if (request.dst_capacity < lsrac_plan_dst_frames(&entry->plan, request.src_frames)) {
+        return LSRAC_RET_VAL_ARGUMENT_ERROR;
+    }
+
+    lsrac_stream_t stream;
+    if (lsrac_stream_init(&stream, &entry->plan, nullptr) != LSRAC_RET_VAL_OK) {
+        return LSRAC_RET_VAL_OUT_OF_MEMORY;
+    }
+
+    float * src = reinterpret_cast<float *>(memory + request.src_offset);
+    float * dst = reinterpret_cast<float *>(memory + request.dst_offset);
+
+    uint64_t written = 0;
+    uint64_t flushed = 0;
+    lsrac_stream_process(&stream, dst, request.dst_capacity, &written, src, request.src_frames, nullptr);
+    lsrac_stream_flush(&stream, dst + written * request.channels, request.dst_capacity - written, &flushed);
+
+    lsrac_stream_uninit(&stream);
+
+    *dst_frames = written + flushed;
+
+    return LSRAC_RET_VAL_OK;
+}
+
+static void lsrac__service_worker(lsrac__service_server_t * server)
+{
+    for (;;) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(server->work_mutex);
+            server->work_available.wait(lock, [server] { return server->stopping.load() || !server->work.empty(); });
+            if (server->work.empty()) {
+                return;
+            }
+            task = std::move(server->work.front());
+            server->work.pop_front();
+        }
+        task();
+    }
+}
+
+static bool lsrac__service_request_valid(const lsrac__service_request_t & request, size_t memory_size)
+{
+    if (request.magic != LSRAC__SERVICE_MAGIC ||
+        request.channels == 0 ||
+        request.channels > LSRAC_MAX_CHANNELS ||
+        request.src_offset % sizeof(float) != 0 ||
+        request.dst_offset % sizeof(float) != 0) {
+        return false;
+    }
+
+    uint64_t frame_bytes = request.channels * sizeof(float);
+
+    return request.src_offset <= memory_size && request.src_frames <= (memory_size - request.src_offset) / frame_bytes &&
+           request.dst_offset <= memory_size && request.dst_capacity <= (memory_size - request.dst_offset) / frame_bytes;
+}
+
+// Maps a client's memfd. The client must have sealed it against shrinking, otherwise it
+// could truncate the memory under a running conversion. Files that cannot be sealed at all
+// fail F_GET_SEALS.
+static uint8_t * lsrac__service_map(int fd, uint64_t size)
+{
+    struct stat info;
+
+    int seals = fcntl(fd, F_GET_SEALS);
+
+    if (seals < 0 ||
+        (seals & F_SEAL_SHRINK) == 0 ||
+        fstat(fd, &info) != 0 ||
+        static_cast<uint64_t>(info.st_size) < size ||
+        size == 0) {
+        return nullptr;
+    }
+
+    void * mapped = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+
+    return mapped != MAP_FAILED ? static_cast<uint8_t *>(mapped) : nullptr;
+}
+
+static void lsrac__service_connection(lsrac__service_server_t * server, int connection)
+{
+    uint8_t * memory = nullptr;
+    size_t memory_size = 0;
+
+    for (;;) {
+        lsrac__service_request_t request;
+
+        union {
+            struct cmsghdr header;
+            char           buffer[CMSG_SPACE(sizeof(int))];
+        } control;
+
+        struct iovec io;
+        io.iov_base = &request;
+        io.iov_len  = sizeof(request);
+
+        struct msghdr message;
+        memset(&message, 0, sizeof(message));
+        message.msg_iov        = &io;
+        message.msg_iovlen     = 1;
+        message.msg_control    = control.buffer;
+        message.msg_controllen = sizeof(control.buffer);
+
+        ssize_t received = recvmsg(connection, &message, MSG_CMSG_CLOEXEC);
+        if (received != static_cast<ssize_t>(sizeof(request))) {
+            break;
+        }
+
+        int fd = -1;
+        for (struct cmsghdr * cmsg = CMSG_FIRSTHDR(&message); cmsg != nullptr; cmsg = CMSG_NXTHDR(&message, cmsg)) {
+            if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SCM_RIGHTS) {
+                memcpy(&fd, CMSG_DATA(cmsg), sizeof(int));
+            }
+        }
+
+        lsrac__service_reply_t reply;
+        reply.magic      = LSRAC__SERVICE_MAGIC;
+        reply.result     = LSRAC_RET_VAL_OK;
+        reply.dst_frames = 0;
+
+        if (request.new_memory) {
+            if (memory != nullptr) {
+                munmap(memory, memory_size);
+                memory = nullptr;
+                memory_size = 0;
+            }
+            if (fd >= 0) {
+                memory = lsrac__service_map(fd, request.memory_size);
+                memory_size = memory != nullptr ? request.memory_size : 0;
+            }
+        }
+        if (fd >= 0) {
+            close(fd);
+        }
+
+        if (memory == nullptr || !lsrac__service_request_valid(request, memory_size)) {
+            reply.result = LSRAC_RET_VAL_ARGUMENT_ERROR;
+        } else {
+            std::packaged_task<int32_t()> task([server, &request, memory, &reply] {
+                return lsrac__service_convert(server, request, memory, &reply.dst_frames);
+            });
+            std::future<int32_t> done = task.get_future();
+            {
+                std::lock_guard<std::mutex> lock(server->work_mutex);
+                server->work.emplace_back([&task] { task(); });
+            }
+            server->work_available.notify_one();
+            reply.result = done.get();
+        }
+
+        if (send(connection, &reply, sizeof(reply), MSG_NOSIGNAL) != static_cast<ssize_t>(sizeof(reply))) {
+            break;
+        }
+    }
+
+    if (memory != nullptr) {
+        munmap(memory, memory_size);
+    }
+
+    std::lock_guard<std::mutex> lock(server->connection_mutex);
+    for (size_t i = 0; i < server->connection_sockets.size(); ++i) {
+        if (server->connection_sockets[i] == connection) {
+            server->connection_sockets.erase(server->connection_sockets.begin() + i);
+            break;
+        }
+    }
+    close(connection);
+    server->connection_closed.notify_all();
+}
+
+static void lsrac__service_accept(lsrac__service_server_t * server)
+{
+    for (;;) {
+        int connection = accept4(server->listen_socket, nullptr, nullptr, SOCK_CLOEXEC);
+        if (connection < 0) {
+            if (errno == EINTR || errno == ECONNABORTED) {
+                continue;
+            }
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(server->connection_mutex);
+        if (server->stopping.load()) {
+            close(connection);
+            return;
+        }
+        server->connection_sockets.push_back(connection);
+        std::thread(lsrac__service_connection, server, connection).detach();
+    }
+}
+
+static int lsrac__service_socket_address(struct sockaddr_un * address, const char * socket_path)
+{
+    memset(address, 0, sizeof(*address));
+    address->sun_family = AF_UNIX;
+
+    if (strlen(socket_path) >= sizeof(address->sun_path)) {
+        return 0;
+    }
+    strcpy(address->sun_path, socket_path);
+
+    return 1;
+}
+
+int32_t lsrac_service_start(lsrac_service_t * service, const char * socket_path, uint32_t threads)
+{
+    if (service == nullptr || socket_path == nullptr) {
+        return LSRAC_RET_VAL_ARGUMENT_ERROR;
+    }
+
+    service->internal = nullptr;
+
+    struct sockaddr_un address;
+    if (!lsrac__service_socket_address(&address, socket_path)) {
+        return LSRAC_RET_VAL_ARGUMENT_ERROR;
+    }
+
+    int listen_socket = socket(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0);
+    if (listen_socket < 0) {
+        return LSRAC_RET_VAL_ERROR;
+    }
+
+    unlink(socket_path);
+
+    if (bind(listen_socket, reinterpret_cast<struct sockaddr *>(&address), sizeof(address)) != 0 ||
+        listen(listen_socket, 64) != 0) {
+        close(listen_socket);
+        return LSRAC_RET_VAL_ERROR;
+    }
+
+    lsrac__service_server_t * server = new lsrac__service_server_t;
+    server->listen_socket = listen_socket;
+    server->stopping.store(false);
+    server->plan_clock = 0;
+
+    if (threads == 0) {
+        threads = std::thread::hardware_concurrency();
+    }
+    if (threads == 0) {
+        threads = 1;
+    }
+
+    for (uint32_t i = 0; i < threads; ++i) {
+        server->workers.emplace_back(lsrac__service_worker, server);
+    }
+    server->accept_thread = std::thread(lsrac__service_accept, server);
+
+    service->internal = server;
+
+    return LSRAC_RET_VAL_OK;
+}
+
+void lsrac_service_stop(lsrac_service_t * service)
+{
+    if (service == nullptr || service->internal == nullptr) {
+        return;
+    }
+
+    lsrac__service_server_t * server = static_cast<lsrac__service_server_t *>(service->internal);
+
+    {
+        std::lock_guard<std::mutex> lock(server->connection_mutex);
+        server->stopping.store(true);
+    }
+
+    // Wakes up accept() and every connection blocked in recvmsg()
+    shutdown(server->listen_socket, SHUT_RDWR);
+    server->accept_thread.join();
+    close(server->listen_socket);
+
+    {
+        std::unique_lock<std::mutex> lock(server->connection_mutex);
+        for (int connection : server->connection_sockets) {
+            shutdown(connection, SHUT_RDWR);
+        }
+        server->connection_closed.wait(lock, [server] { return server->connection_sockets.empty(); });
+    }
+
+    server->work_available.notify_all();
+    for (std::thread & thread : server->workers) {
+        thread.join();
+    }
+
+    delete server;
+    service->internal = nullptr;
+}
+
+
+/*
+ *  Client
+ */
+
+int32_t lsrac_client_connect(lsrac_client_t * client, const char * socket_path)
+{
+    if (client == nullptr || socket_path == nullptr) {
+        return LSRAC_RET_VAL_ARGUMENT_ERROR;
+    }
+
+    memset(client, 0, sizeof(*client));
+    client->socket = -1;
+    client->memory_fd = -1;
+
+    struct sockaddr_un address;
+    if (!lsrac__service_socket_address(&address, socket_path)) {
+        return LSRAC_RET_VAL_ARGUMENT_ERROR;
+    }
+
+    client->socket = socket(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0);
+    if (client->socket < 0) {
+        return LSRAC_RET_VAL_ERROR;
+    }
+
+    if (connect(client->socket, reinterpret_cast<struct sockaddr *>(&address), sizeof(address)) != 0) {
+        close(client->socket);
+        client->socket = -1;
+        return LSRAC_RET_VAL_ERROR;
+    }
+
+    return LSRAC_RET_VAL_OK;
+}
+
+void lsrac_client_disconnect(lsrac_client_t * client)
+{
+    if (client == nullptr) {
+        return;
+    }
+
+    if (client->memory != nullptr) {
+        munmap(client->memory, client->memory_size);
+    }
+    if (client->memory_fd >= 0) {
+        close(client->memory_fd);
+    }
+    if (client->socket >= 0) {
+        close(client->socket);
+    }
+
+    memset(client, 0, sizeof(*client));
+    client->socket = -1;
+    client->memory_fd = -1;
+}
+
+int32_t lsrac_client_reserve(
+        lsrac_client_t *  client,
+        uint64_t          src_frames,
+        uint64_t          dst_frames,
+        uint32_t          channels,
+        float **          src,
+        float **          dst)
+{
+    if (client == nullptr || client->socket < 0 || channels == 0) {
+        return LSRAC_RET_VAL_ARGUMENT_ERROR;
+    }
+
+    size_t dst_offset = lsrac__service_align(src_frames * channels * sizeof(float));
+    size_t needed = dst_offset + lsrac__service_align(dst_frames * channels * sizeof(float));
+    if (needed == 0) {
+        needed = LSRAC_DEFAULT_ALIGNMENT;
+    }
+
+    if (needed > client->memory_size) {
+        // Grows in powers of two, so a client converting similar sizes rarely remaps
+        size_t size = 1 << 16;
+        while (size < needed) {
+            size *= 2;
+        }
+
+        if (client->memory != nullptr) {
+            munmap(client->memory, client->memory_size);
+            client->memory = nullptr;
+            client->memory_size = 0;
+        }
+        if (client->memory_fd >= 0) {
+            close(client->memory_fd);
+        }
+
+        client->memory_fd = memfd_create("lsrac", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+        if (client->memory_fd < 0) {
+            return LSRAC_RET_VAL_OUT_OF_MEMORY;
+        }
+        if (ftruncate(client->memory_fd, static_cast<off_t>(size)) != 0 ||
+            fcntl(client->memory_fd, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW) != 0) {
+            close(client->memory_fd);
+            client->memory_fd = -1;
+            return LSRAC_RET_VAL_OUT_OF_MEMORY;
+        }
+
+        void * mapped = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, client->memory_fd, 0);
+        if (mapped == MAP_FAILED) {
+            close(client->memory_fd);
+            client->memory_fd = -1;
+            return LSRAC_RET_VAL_OUT_OF_MEMORY;
+        }
+
+        client->memory        = static_cast<uint8_t *>(mapped);
+        client->memory_size   = size;
+        client->memory_shared = 0;
+    }
+
+    client->dst_offset = dst_offset;
+
+    if (src != nullptr) {
+        *src = reinterpret_cast<float *>(client->memory);
+    }
+    if (dst != nullptr) {
+        *dst = reinterpret_cast<float *>(client->memory + dst_offset);
+    }
+
+    return LSRAC_RET_VAL_OK;
+}
+
+int32_t lsrac_client_convert_reserved(
+        lsrac_client_t *  client,
+        uint32_t          src_rate,
+        uint32_t          dst_rate,
+        uint32_t          channels,
+        uint32_t          quality,
+        uint64_t          src_frames,
+        uint64_t          dst_capacity,
+        uint64_t *        dst_frames)
+{
+    if (dst_frames != nullptr) {
+        *dst_frames = 0;
+    }
+
+    if (client == nullptr || client->socket < 0 || client->memory == nullptr) {
+        return LSRAC_RET_VAL_ARGUMENT_ERROR;
+    }
+
+    lsrac__service_request_t request;
+    memset(&request, 0, sizeof(request));
+    request.magic        = LSRAC__SERVICE_MAGIC;
+    request.new_memory   = client->memory_shared ? 0 : 1;
+    request.memory_size  = client->memory_size;
+    request.src_rate     = src_rate;
+    request.dst_rate     = dst_rate;
+    request.channels     = channels;
+    request.quality      = quality;
+    request.src_offset   = 0;
+    request.src_frames   = src_frames;
+    request.dst_offset   = client->dst_offset;
+    request.dst_capacity = dst_capacity;
+
+    union {
+        struct cmsghdr header;
+        char           buffer[CMSG_SPACE(sizeof(int))];
+    } control;
+    memset(&control, 0, sizeof(control));
+
+    struct iovec io;
+    io.iov_base = &request;
+    io.iov_len  = sizeof(request);
+
+    struct msghdr message;
+    memset(&message, 0, sizeof(message));
+    message.msg_iov    = &io;
+    message.msg_iovlen = 1;
+
+    if (request.new_memory) {
+        message.msg_control    = control.buffer;
+        message.msg_controllen = sizeof(control.buffer);
+
+        struct cmsghdr * cmsg = CMSG_FIRSTHDR(&message);
+        cmsg->cmsg_level = SOL_SOCKET;
+        cmsg->cmsg_type  = SCM_RIGHTS;
+        cmsg->cmsg_len   = CMSG_LEN(sizeof(int));
+        memcpy(CMSG_DATA(cmsg), &client->memory_fd, sizeof(int));
+    }
+
+    if (sendmsg(client->socket, &message, MSG_NOSIGNAL) != static_cast<ssize_t>(sizeof(request))) {
+        return LSRAC_RET_VAL_ERROR;
+    }
+    client->memory_shared = 1;
+
+    lsrac__service_reply_t reply;
+    if (recv(client->socket, &reply, sizeof(reply), 0) != static_cast<ssize_t>(sizeof(reply)) ||
+        reply.magic != LSRAC__SERVICE_MAGIC) {
+        return LSRAC_RET_VAL_ERROR;
+    }
+
+    if (dst_frames != nullptr) {
+        *dst_frames = reply.dst_frames;
+    }
+
+    return reply.result;
+}
+
+int32_t lsrac_client_convert(
+        lsrac_client_t *  client,
+        uint32_t          src_rate,
+        uint32_t          dst_rate,
+        uint32_t          channels,
+        uint32_t          quality,
+        const float *     src,
+        uint64_t          src_frames,
+        float *           dst,
+        uint64_t          dst_capacity,
+        uint64_t *        dst_frames)
+{
+    if (dst_frames != nullptr) {
+        *dst_frames = 0;
+    }
+
+    float * shared_src;
+    float * shared_dst;
+
+    int32_t result = lsrac_client_reserve(client, src_frames, dst_capacity, channels, &shared_src, &shared_dst);
+    if (result != LSRAC_RET_VAL_OK) {
+        return result;
+    }
+
+    memcpy(shared_src, src, src_frames * channels * sizeof(float));
+
+    uint64_t written = 0;
+    result = lsrac_client_convert_reserved(client, src_rate, dst_rate, channels, quality, src_frames, dst_capacity, &written);
+    if (result != LSRAC_RET_VAL_OK) {
+        return result;
+    }
+
+    memcpy(dst, shared_dst, written * channels * sizeof(float));
+
+    if (dst_frames != nullptr) {
+        *dst_frames = written;
+    }
+
+    return LSRAC_RET_VAL_OK;
+}
+
+#endif // LSRAC_SERVICE_IMPLEMENTATION
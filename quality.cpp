@@ -0,0 +1,505 @@
+/*  lsrac quality measurements
+
+    usage: quality [-v]
+
+    Runs test signals through every engine (lsrac_convert_audio, streams at every quality
+    preset, stream pools, the double precision path) at a set of common rate pairs and
+    measures:
+
+        SNR        a tone against the ideal output at the exact output positions
+        THD+N      everything but the tone, below the lower Nyquist frequency
+        ripple     spread of the gains of a multi-tone signal over the passband
+        stopband   rejection of aliases (downsampling) or images (upsampling) over a
+                   stepped sweep, the worst tone counts (for close rates the sweep
+                   starts right above the output Nyquist frequency)
+        impulse    the response to an impulse peaks where it should and has unity DC gain
+
+    Prints one line per engine and rate pair and exits with 1 if any measurement is
+    worse than the threshold of its engine.
+
+*/
+
+#define LSRAC_IMPLEMENTATION
+#include "simple_raw_audio_converter.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <complex>
+#include <vector>
+
+#define QUALITY_FFT_SIZE      8192      // output frames analyzed
+#define QUALITY_MARGIN        1024      // output frames skipped before and after them
+#define QUALITY_POOL_BLOCK    480
+#define QUALITY_PASSBAND      0.6       // ripple is measured up to this fraction of Nyquist
+#define QUALITY_STOPBAND      1.1       // aliases are measured from this fraction of Nyquist on
+#define QUALITY_STOPBAND_NEAR  1.01      // or from this one when the source ends before the above
+#define QUALITY_TONE_BINS     6         // bins around a windowed tone that belong to it
+#define QUALITY_TONES         24
+#define QUALITY_SWEEP_STEPS   16
+
+static const double pi = 3.14159265358979323846;
+
+typedef bool (* engine_proc)(uint32_t src_rate, uint32_t dst_rate, uint32_t quality,
+                             const std::vector<float> & src, std::vector<float> & dst);
+
+// Worst acceptable results
+struct thresholds {
+    double  snr_db;
+    double  thd_n_db;
+    double  ripple_db;
+    double  stopband_db;
+};
+
+struct engine {
+    const char *  name;
+    engine_proc   convert;
+    uint32_t      quality;
+    thresholds    limit;
+};
+
+/*
+ *  Engines. Output frame n is expected at source position (n + 0.5) * src_rate / dst_rate - 0.5.
+ */
+
+static bool convert_audio_engine(uint32_t src_rate, uint32_t dst_rate, uint32_t quality,
+                                 const std::vector<float> & src, std::vector<float> & dst)
+{
+    (void)quality;
+
+    // The source length is a whole number of reduced src_rate periods, so the ratio of the
+    // sample counts is exactly the ratio of the rates
+    dst.resize(static_cast<size_t>(static_cast<uint64_t>(src.size()) * dst_rate / src_rate));
+
+    return lsrac_convert_audio(dst.data(), const_cast<float *>(src.data()),
+                               dst.size(), src.size(), sizeof(float), sizeof(float), 0, 0) == LSRAC_RET_VAL_OK;
+}
+
+static bool stream_engine(uint32_t src_rate, uint32_t dst_rate, uint32_t quality,
+                          const std::vector<float> & src, std::vector<float> & dst)
+{
+    lsrac_plan_t plan;
+    if (lsrac_plan_init(&plan, src_rate, dst_rate, 1, nullptr) != LSRAC_RET_VAL_OK ||
+        lsrac_plan_set_quality(&plan, quality) != LSRAC_RET_VAL_OK) {
+        return false;
+    }
+
+    lsrac_stream_t stream;
+    lsrac_stream_init(&stream, &plan, nullptr);
+
+    dst.resize(static_cast<size_t>(lsrac_plan_dst_frames(&plan, src.size())));
+
+    uint64_t written = 0;
+    uint64_t flushed = 0;
+    lsrac_stream_process(&stream, dst.data(), dst.size(), &written, src.data(), src.size(), nullptr);
+    lsrac_stream_flush(&stream, dst.data() + written, dst.size() - written, &flushed);
+
+    lsrac_stream_uninit(&stream);
+    lsrac_plan_uninit(&plan);
+
+    return written + flushed == dst.size();
+}
+
+static bool f64_engine(uint32_t src_rate, uint32_t dst_rate, uint32_t quality,
+                       const std::vector<float> & src, std::vector<float> & dst)
+{
+    lsrac_plan_t plan;
+    if (lsrac_plan_init(&plan, src_rate, dst_rate, 1, nullptr) != LSRAC_RET_VAL_OK ||
+        lsrac_plan_set_quality(&plan, quality) != LSRAC_RET_VAL_OK) {
+        return false;
+    }
+
+    std::vector<double> src64(src.begin(), src.end());
+    std::vector<double> dst64(static_cast<size_t>(lsrac_plan_dst_frames(&plan, src.size())));
+
+    bool ok = lsrac_plan_convert_f64(&plan, dst64.data(), src64.data(), 0, 0, dst64.size(), src64.size(), src64.size()) == LSRAC_RET_VAL_OK;
+
+    dst.assign(dst64.begin(), dst64.end());
+
+    lsrac_plan_uninit(&plan);
+
+    return ok;
+}
+
+static bool pool_engine(uint32_t src_rate, uint32_t dst_rate, uint32_t quality,
+                        const std::vector<float> & src, std::vector<float> & dst)
+{
+    lsrac_plan_t plan;
+    if (lsrac_plan_init(&plan, src_rate, dst_rate, 1, nullptr) != LSRAC_RET_VAL_OK ||
+        lsrac_plan_set_quality(&plan, quality) != LSRAC_RET_VAL_OK) {
+        return false;
+    }
+
+    lsrac_pool_t pool;
+    uint32_t index = 0;
+    if (lsrac_pool_init(&pool, &plan, 1, QUALITY_POOL_BLOCK, nullptr) != LSRAC_RET_VAL_OK ||
+        lsrac_pool_add_stream(&pool, &index) != LSRAC_RET_VAL_OK) {
+        lsrac_plan_uninit(&plan);
+        return false;
+    }
+
+    dst.clear();
+
+    std::vector<float> block(QUALITY_POOL_BLOCK);
+    std::vector<float> out(static_cast<size_t>(lsrac_pool_max_dst_frames(&pool)));
+
+    // Pools have no flush, the last frames of the source only produce output once more
+    // blocks follow, so silence is fed after the source
+    size_t padded = src.size() + 4 * QUALITY_POOL_BLOCK;
+
+    for (size_t offset = 0; offset < padded; offset += QUALITY_POOL_BLOCK) {
+        for (size_t i = 0; i < QUALITY_POOL_BLOCK; ++i) {
+            block[i] = offset + i < src.size() ? src[offset + i] : 0.0f;
+        }
+
+        float * dst_pointer = out.data();
+        const float * src_pointer = block.data();
+        uint64_t written = 0;
+        lsrac_pool_process_all(&pool, &dst_pointer, &src_pointer, &written);
+
+        dst.insert(dst.end(), out.begin(), out.begin() + static_cast<ptrdiff_t>(written));
+    }
+
+    lsrac_pool_uninit(&pool);
+    lsrac_plan_uninit(&plan);
+
+    return true;
+}
+
+/*
+ *  Analysis
+ */
+
+// In place radix 2 FFT, size a power of two.
+static void fft(std::vector<std::complex<double> > & x)
+{
+    size_t n = x.size();
+
+    for (size_t i = 1, j = 0; i < n; ++i) {
+        size_t bit = n >> 1;
+        for (; j & bit; bit >>= 1) {
+            j ^= bit;
+        }
+        j ^= bit;
+        if (i < j) {
+            std::swap(x[i], x[j]);
+        }
+    }
+
+    for (size_t length = 2; length <= n; length <<= 1) {
+        std::complex<double> step = std::polar(1.0, -2.0 * pi / static_cast<double>(length));
+        for (size_t i = 0; i < n; i += length) {
+            std::complex<double> w(1.0, 0.0);
+            for (size_t k = 0; k < length / 2; ++k) {
+                std::complex<double> a = x[i + k];
+                std::complex<double> b = x[i + k + length / 2] * w;
+                x[i + k] = a + b;
+                x[i + k + length / 2] = a - b;
+                w *= step;
+            }
+        }
+    }
+}
+
+// Amplitude spectrum of the analyzed frames. With window set, a 4 term Blackman-Harris
+// window is applied and amplitudes are corrected for its gain.
+static std::vector<double> spectrum(const std::vector<float> & dst, bool window)
+{
+    std::vector<std::complex<double> > x(QUALITY_FFT_SIZE);
+    double window_sum = 0.0;
+
+    for (size_t i = 0; i < QUALITY_FFT_SIZE; ++i) {
+        double w = 1.0;
+        if (window) {
+            double t = 2.0 * pi * static_cast<double>(i) / static_cast<double>(QUALITY_FFT_SIZE);
+            w = 0.35875 - 0.48829 * cos(t) + 0.14128 * cos(2.0 * t) - 0.01168 * cos(3.0 * t);
+        }
+        window_sum += w;
+        x[i] = std::complex<double>(w * dst[QUALITY_MARGIN + i], 0.0);
+    }
+
+    fft(x);
+
+    std::vector<double> amplitude(QUALITY_FFT_SIZE / 2);
+    for (size_t k = 0; k < amplitude.size(); ++k) {
+        amplitude[k] = 2.0 * std::abs(x[k]) / window_sum;
+    }
+    return amplitude;
+}
+
+static double to_db(double ratio)
+{
+    return 20.0 * log10(ratio > 1e-30 ? ratio : 1e-30);
+}
+
+// Frequency of FFT bin k of the output, in Hz.
+static double bin_hz(uint32_t dst_rate, size_t k)
+{
+    return static_cast<double>(k) * dst_rate / QUALITY_FFT_SIZE;
+}
+
+struct test_signal {
+    uint32_t             src_rate;
+    uint32_t             dst_rate;
+    std::vector<float>   src;
+    std::vector<double>  hz;
+    std::vector<double>  amplitude;
+    std::vector<double>  phase;
+
+    // Sum of the tones at source position
+    double at(double position) const
+    {
+        double value = 0.0;
+        for (size_t t = 0; t < hz.size(); ++t) {
+            value += amplitude[t] * sin(2.0 * pi * hz[t] * position / src_rate + phase[t]);
+        }
+        return value;
+    }
+
+    void generate()
+    {
+        // Enough source for the analyzed output frames and margins, in whole periods of
+        // the reduced rate ratio
+        uint32_t gcd = src_rate;
+        for (uint32_t b = dst_rate; b != 0;) {
+            uint32_t t = gcd % b;
+            gcd = b;
+            b = t;
+        }
+        uint64_t period = src_rate / gcd;
+        uint64_t needed = static_cast<uint64_t>(QUALITY_FFT_SIZE + 2 * QUALITY_MARGIN) * src_rate / dst_rate + 1;
+        uint64_t frames = (needed + period - 1) / period * period;
+
+        src.resize(static_cast<size_t>(frames));
+        for (size_t i = 0; i < src.size(); ++i) {
+            src[i] = static_cast<float>(at(static_cast<double>(i)));
+        }
+    }
+
+    void add_tone(double tone_hz, double tone_amplitude)
+    {
+        hz.push_back(tone_hz);
+        amplitude.push_back(tone_amplitude);
+        phase.push_back(static_cast<double>(hz.size() * 7 % 13) * 0.5);
+    }
+};
+
+struct results {
+    double  snr_db;
+    double  thd_n_db;
+    double  ripple_db;
+    double  stopband_db;
+    bool    stopband_measured;
+    bool    impulse_ok;
+    bool    ran;
+};
+
+static results measure(const engine & e, uint32_t src_rate, uint32_t dst_rate)
+{
+    results r;
+    memset(&r, 0, sizeof(r));
+
+    double nyquist = 0.5 * (src_rate < dst_rate ? src_rate : dst_rate);
+    size_t nyquist_bin = static_cast<size_t>(nyquist * QUALITY_FFT_SIZE / dst_rate);
+
+    std::vector<float> dst;
+
+    {
+        // One tone near a tenth of the Nyquist frequency, centered on an FFT bin
+        size_t bin = static_cast<size_t>(0.1 * nyquist * QUALITY_FFT_SIZE / dst_rate);
+
+        test_signal tone = { src_rate, dst_rate, {}, {}, {}, {} };
+        tone.add_tone(bin_hz(dst_rate, bin), 0.5);
+        tone.generate();
+
+        if (!e.convert(src_rate, dst_rate, e.quality, tone.src, dst) || dst.size() < QUALITY_FFT_SIZE + 2 * QUALITY_MARGIN) {
+            return r;
+        }
+
+        double signal = 0.0;
+        double noise = 0.0;
+        for (size_t n = QUALITY_MARGIN; n < QUALITY_MARGIN + QUALITY_FFT_SIZE; ++n) {
+            double ideal = tone.at((static_cast<double>(n) + 0.5) * src_rate / dst_rate - 0.5);
+            signal += ideal * ideal;
+            noise += (dst[n] - ideal) * (dst[n] - ideal);
+        }
+        r.snr_db = 10.0 * log10(signal / (noise > 1e-30 ? noise : 1e-30));
+
+        std::vector<double> amplitude = spectrum(dst, false);
+        double rest = 0.0;
+        for (size_t k = 1; k < nyquist_bin; ++k) {
+            if (k != bin) {
+                rest += amplitude[k] * amplitude[k];
+            }
+        }
+        r.thd_n_db = 10.0 * log10((rest > 1e-30 ? rest : 1e-30) / (amplitude[bin] * amplitude[bin]));
+    }
+
+    {
+        // Tones spread logarithmically over the passband, each on its own bin
+        test_signal tones = { src_rate, dst_rate, {}, {}, {}, {} };
+        std::vector<size_t> bins;
+
+        for (int t = 0; t < QUALITY_TONES; ++t) {
+            double fraction = 0.01 * pow(QUALITY_PASSBAND / 0.01, static_cast<double>(t) / (QUALITY_TONES - 1));
+            size_t bin = static_cast<size_t>(fraction * nyquist * QUALITY_FFT_SIZE / dst_rate);
+            if (!bins.empty() && bin <= bins.back()) {
+                bin = bins.back() + 1;
+            }
+            bins.push_back(bin);
+            tones.add_tone(bin_hz(dst_rate, bin), 0.5 / QUALITY_TONES);
+        }
+        tones.generate();
+
+        e.convert(src_rate, dst_rate, e.quality, tones.src, dst);
+
+        std::vector<double> amplitude = spectrum(dst, false);
+        double lowest = 1e30;
+        double highest = -1e30;
+        for (size_t t = 0; t < bins.size(); ++t) {
+            double gain = to_db(amplitude[bins[t]] / tones.amplitude[t]);
+            lowest = gain < lowest ? gain : lowest;
+            highest = gain > highest ? gain : highest;
+        }
+        r.ripple_db = highest - lowest;
+    }
+
+    {
+        // Stepped sweep: from above the output Nyquist frequency to the source Nyquist
+        // frequency when downsampling, where anything in the output is an alias. Through the
+        // passband when upsampling, where anything in the output but the tone is an image.
+        // Close rates (48000>44100) leave little room above the output Nyquist frequency, the
+        // sweep then starts right above it.
+        bool downsampling = dst_rate < src_rate;
+        double low = downsampling ? QUALITY_STOPBAND * 0.5 * dst_rate : 0.05 * 0.5 * src_rate;
+        double high = downsampling ? 0.95 * 0.5 * src_rate : QUALITY_PASSBAND * 0.5 * src_rate;
+        double worst = 0.0;
+
+        if (downsampling && low >= high) {
+            low = QUALITY_STOPBAND_NEAR * 0.5 * dst_rate;
+        }
+
+        for (int step = 0; step < QUALITY_SWEEP_STEPS && low < high; ++step) {
+            double hz = low + (high - low) * static_cast<double>(step) / (QUALITY_SWEEP_STEPS - 1);
+
+            test_signal tone = { src_rate, dst_rate, {}, {}, {}, {} };
+            tone.add_tone(hz, 0.5);
+            tone.generate();
+
+            e.convert(src_rate, dst_rate, e.quality, tone.src, dst);
+
+            std::vector<double> amplitude = spectrum(dst, true);
+            double tone_bin = hz * QUALITY_FFT_SIZE / dst_rate;
+
+            for (size_t k = 1; k < amplitude.size(); ++k) {
+                if (!downsampling && fabs(static_cast<double>(k) - tone_bin) <= QUALITY_TONE_BINS) {
+                    continue;
+                }
+                double level = amplitude[k] / 0.5;
+                worst = level > worst ? level : worst;
+            }
+
+            r.stopband_db = -to_db(worst);
+            r.stopband_measured = true;
+        }
+    }
+
+    {
+        // An impulse in the middle of the source
+        test_signal silence = { src_rate, dst_rate, {}, {}, {}, {} };
+        silence.generate();
+
+        size_t impulse = silence.src.size() / 2;
+        silence.src[impulse] = 1.0f;
+
+        e.convert(src_rate, dst_rate, e.quality, silence.src, dst);
+
+        size_t peak = 0;
+        double sum = 0.0;
+        for (size_t n = 0; n < dst.size(); ++n) {
+            peak = fabsf(dst[n]) > fabsf(dst[peak]) ? n : peak;
+            sum += dst[n];
+        }
+
+        double expected = (static_cast<double>(impulse) + 0.5) * dst_rate / src_rate - 0.5;
+        double dc_gain = sum * src_rate / dst_rate;
+
+        r.impulse_ok = fabs(static_cast<double>(peak) - expected) <= 1.0 && fabs(dc_gain - 1.0) < 0.01;
+    }
+
+    r.ran = true;
+    return r;
+}
+
+int main(int argc, char ** argv)
+{
+    bool verbose = argc > 1 && strcmp(argv[1], "-v") == 0;
+
+    static const engine engines[] = {
+        // Thresholds are a few dB below what the engines measured when they were set. The
+        // float positions of lsrac_convert_audio() limit its SNR. The preview kernel rolls
+        // off slowly, right above the Nyquist frequency of 48000>44100 it rejects little.
+        //                                                              SNR    THD+N  ripple stopband
+        { "convert_audio",  convert_audio_engine, LSRAC_QUALITY_BEST,   { 58.0, -58.0, 0.1,  48.0 } },
+        { "stream best",    stream_engine,        LSRAC_QUALITY_BEST,   { 98.0, -98.0, 0.01, 88.0 } },
+        { "stream high",    stream_engine,        LSRAC_QUALITY_HIGH,   { 80.0, -95.0, 0.02, 66.0 } },
+        { "stream medium",  stream_engine,        LSRAC_QUALITY_MEDIUM, { 50.0, -50.0, 0.3,  30.0 } },
+        { "stream fast",    stream_engine,        LSRAC_QUALITY_FAST,   { 28.0, -30.0, 1.2,  20.0 } },
+        { "stream preview", stream_engine,        LSRAC_QUALITY_PREVIEW, { 45.0, -45.0, 0.3, 5.0 } },
+        { "pool best",      pool_engine,          LSRAC_QUALITY_BEST,   { 98.0, -98.0, 0.01, 88.0 } },
+        { "f64 best",       f64_engine,           LSRAC_QUALITY_BEST,   { 98.0, -98.0, 0.01, 88.0 } },
+        { "f64 medium",     f64_engine,           LSRAC_QUALITY_MEDIUM, { 50.0, -50.0, 0.3,  30.0 } },
+    };
+
+    static const uint32_t rates[][2] = {
+        { 44100, 48000 },
+        { 48000, 44100 },
+        { 48000, 16000 },
+        { 16000, 48000 },
+        { 96000, 44100 },
+        { 8000,  44100 },
+    };
+
+    int failures = 0;
+
+    printf("%-15s %13s %9s %9s %9s %9s %8s\n", "engine", "rates", "SNR", "THD+N", "ripple", "stopband", "impulse");
+
+    for (size_t e = 0; e < ARRAY_COUNT(engines); ++e) {
+        const thresholds & limit = engines[e].limit;
+
+        for (size_t k = 0; k < ARRAY_COUNT(rates); ++k) {
+            results r = measure(engines[e], rates[k][0], rates[k][1]);
+
+            bool ok = r.ran &&
+                      r.snr_db >= limit.snr_db &&
+                      r.thd_n_db <= limit.thd_n_db &&
+                      r.ripple_db <= limit.ripple_db &&
+                      (!r.stopband_measured || r.stopband_db >= limit.stopband_db) &&
+                      r.impulse_ok;
+
+            if (!ok) {
+                failures++;
+            }
+
+            if (verbose || !ok) {
+                char stopband[32] = "      n/a";
+                if (r.stopband_measured) {
+                    snprintf(stopband, sizeof(stopband), "%6.1f dB", r.stopband_db);
+                }
+                printf("%-15s %6u>%-6u %6.1f dB %6.1f dB %6.3f dB %s %8s%s\n",
+                       engines[e].name, rates[k][0], rates[k][1],
+                       r.snr_db, r.thd_n_db, r.ripple_db, stopband,
+                       r.impulse_ok ? "ok" : "FAIL", ok ? "" : "  <- below threshold");
+            }
+        }
+    }
+
+    if (failures != 0) {
+        printf("%d measurement(s) below threshold\n", failures);
+        return 1;
+    }
+
+    printf("all measurements within thresholds\n");
+    return 0;
+}
@@ -9,8 +9,8 @@ USAGE
         #define LSRAC_IMPLEMENTATION
     in the file that you want to have the implementation - just like STB.
 
-    lsrac_convert_audio(..) is the only function, it will convert one stream of samples from
-    one sample rate to another.
+    lsrac_convert_audio(..) will convert one stream of samples from one sample rate
+    to another.
 
     Note:
     dst_data must be allocated by user and large enough.
@@ -22,11 +22,164 @@ USAGE
     Conversions are only for one channel at a time. Use the stride parameters to
     support interleaved formats.
 
+    For continuous audio, set up an lsrac_plan_t once for a pair of sample rates and
+    a channel count, and feed interleaved frames in chunks of any size through one
+    lsrac_stream_t per audio stream:
 
-POSSIBLE IMPROVEMENTS
+        lsrac_plan_t plan;
+        lsrac_plan_init(&plan, 44100, 48000, 2, NULL);
 
-    The filters should probably be applied outside in, to be better from a numerical
-    float perspective (small numbers first, then large).
+        lsrac_stream_t stream;
+        lsrac_stream_init(&stream, &plan, NULL);
+
+        lsrac_stream_process(&stream, dst, dst_frames, &written, src, src_frames, &read);
+        ...
+        lsrac_stream_flush(&stream, dst, dst_frames, &written);
+
+        lsrac_stream_uninit(&stream);
+        lsrac_plan_uninit(&plan);
+
+    The stream keeps the source history it needs between calls, so the output does
+    not depend on how the input is chunked.
+
+    Shorter filters trade quality for speed. Pick a preset before initializing any
+    streams:
+
+        lsrac_plan_set_quality(&plan, LSRAC_QUALITY_MEDIUM);
+
+    LSRAC_QUALITY_PREVIEW swaps the sinc filter for a Lanczos kernel of 3 lobes, 6 taps
+    per output frame, for previews and scrubbing where cost matters more than aliasing.
+
+    Upsampling by an integer factor L (8 kHz to 48 kHz, say) is polyphase: every source
+    frame makes L output frames, one per phase with its own short filter, and streams
+    with serial accumulation filter all L phases of a source frame in one pass.
+
+    By default the filter adds up its products in one running sum, one tap after the
+    other. LSRAC_ACCUMULATE_PAIRWISE spreads them over four independent partial sums,
+    which both rounds less and lets the CPU overlap the additions (streams with a phase
+    table filter about twice as fast), and LSRAC_ACCUMULATE_KAHAN also compensates each
+    partial sum for its rounding error:
+
+        lsrac_plan_set_accumulation(&plan, LSRAC_ACCUMULATE_PAIRWISE);
+
+    Pools always add up serially: their SIMD lanes already are one chain per stream.
+
+    Streams can write integer samples directly. Describe the output with an
+    lsrac_buffer_t of format LSRAC_FORMAT_S16 (or S24/S32) and the stream's output
+    stage applies gain, rounds, clips and optionally adds TPDF dither with noise
+    shaping while it writes each sample:
+
+        lsrac_stream_set_output(&stream, 0.5f, LSRAC_OUTPUT_DITHER | LSRAC_OUTPUT_NOISE_SHAPING);
+        lsrac_buffer_interleaved(&dst, s16_data, 2, LSRAC_FORMAT_S16);
+        lsrac_stream_process_buffers(&stream, &dst, dst_frames, &written, &src, src_frames, &read);
+
+    The same stage is available on its own as lsrac_output_stage_t for converting
+    float buffers that did not come out of a stream.
+
+    To remix channels while resampling (5.1 to stereo, say), give the plan a gain
+    matrix before initializing any streams:
+
+        lsrac_plan_init(&plan, 44100, 48000, 6, NULL);
+        lsrac_plan_set_mix(&plan, 2, downmix_gains);   // 2 rows of 6 gains
+
+    Streams then read 6 channel frames and write 2 channel frames. Depending on the
+    rates the plan either mixes each source frame before filtering or filters the
+    source channels and mixes each output frame, whichever takes fewer operations.
+
+
+MEMORY
+
+    All memory is requested through an lsrac_allocator_t given to the plan and stream
+    init functions. Passing NULL uses LSRAC_MALLOC/LSRAC_FREE, which default to
+    malloc/free and can be #defined before including, just like DRWAV_MALLOC.
+
+    For code that must not touch the system allocator at all, carve the memory out
+    of a caller provided workspace:
+
+        static uint8_t workspace[1 << 16];
+        lsrac_arena_t arena;
+        lsrac_arena_init(&arena, workspace, sizeof(workspace));
+        lsrac_allocator_t allocator = lsrac_arena_allocator(&arena);
+        lsrac_stream_init(&stream, &plan, &allocator);
+
+    lsrac_stream_workspace_size() returns how large the workspace has to be. Memory is
+    only ever allocated in the init functions, never while processing. The one-call
+    range conversions (lsrac_plan_convert(..), lsrac_convert_rates(..)) set up a
+    temporary stream each time; lsrac_stream_convert(..) converts ranges with a stream
+    that is kept around instead.
+
+
+MANY STREAMS
+
+    Thousands of low rate streams that all use the same conversion (VoIP participants,
+    say) are cheaper to run through an lsrac_pool_t than through one stream each. All
+    streams in a pool share one mono plan and one clock, and their histories are kept
+    side by side, so every output frame computes its filter coefficients once and then
+    applies them to all streams with SIMD. Every stream starts from silence, so the plan's
+    edge policy must be LSRAC_EDGE_RENORMALIZE or LSRAC_EDGE_ZERO:
+
+        lsrac_pool_init(&pool, &plan, 4096, 320, NULL);   // 20 ms blocks at 16 kHz
+        lsrac_pool_add_stream(&pool, &index);
+        ...
+        lsrac_pool_process_all(&pool, dst_pointers, src_pointers, &written);
+
+
+VARIABLE SPEED
+
+    Playback speed changes (0.5x to 2x, say) go through an lsrac_vstream_t. It runs a
+    plan's conversion at a speed that can change at every output frame, without any
+    setup while processing, and the source position carries over from one frame to the
+    next, so speed changes do not click. Above speed 1 (when more source frames than
+    output frames go by) the filter cutoff follows the speed down:
+
+        lsrac_vstream_init(&vstream, &plan, 2.0f, NULL);   // speeds up to 2x
+        lsrac_vstream_set_speed(&vstream, 1.5f, 4800);     // glide there over 4800 frames
+        lsrac_vstream_process(&vstream, dst, dst_frames, &written, src, src_frames, &read, NULL);
+
+    Pass an array of per output frame speeds as the last argument to follow a curve.
+
+
+DOUBLE PRECISION
+
+    For mastering, where the conversion should add as little as possible on top of
+    what the source already has, lsrac_plan_convert_f64(..) converts double samples
+    with double coefficients and double accumulators. It uses the plan's clock, quality
+    preset, edge policy and mix, so it converts any range of output frames just like
+    lsrac_plan_convert(..):
+
+        lsrac_plan_prepare_f64(&plan);
+        lsrac_plan_convert_f64(&plan, dst, src, 0, 0, dst_frames, src_frames, src_frames);
+
+    lsrac_plan_prepare_f64(..) builds the double precision filter and phase table once;
+    without it every call builds them in temporary memory.
+
+    lsrac_convert_rates_f64(..) does the same without a plan. The filter is the float
+    filter at double precision (lsrac_filter_f64), so the gain over the float path is
+    the rounding noise of the float arithmetic, not a different response.
+
+
+OPTIONS
+
+    #define these before including this file.
+
+    #define LSRAC_MALLOC(sz) / LSRAC_FREE(p)
+        Replaces malloc/free for the default allocator.
+
+    #define LSRAC_NO_SIMD
+        Disables the SSE2/NEON code paths.
+
+    #define LSRAC_STREAM_BLOCK_FRAMES
+        Source frames a stream buffers on top of its filter history (default 1024).
+
+    #define LSRAC_PHASE_TABLE_MAX_TAPS
+        Largest phase table (in filter coefficients) a plan precomputes (default 262144).
+
+    #define LSRAC_TILE_CACHE_BYTES
+        Cache size streams block their work for (default 32768, a typical L1 data cache).
+
+    #define LSRAC_ENABLE_STATS
+        Collects per thread counters and timings of the hot paths, see lsrac_stats_get().
+        Costs two timer reads per output frame. Without it the hooks compile to nothing.
 
 
 INSPIRATION
@@ -56,12 +209,61 @@ LICENSE
 extern "C" {
 #endif
 
+#include <stddef.h>
 #include <stdint.h>
 
+#define LSRAC_RET_VAL_OUT_OF_MEMORY   -3
 #define LSRAC_RET_VAL_ARGUMENT_ERROR  -2
 #define LSRAC_RET_VAL_ERROR           -1
 #define LSRAC_RET_VAL_OK               1
 
+#define LSRAC_MAX_CHANNELS            64
+
+// Sample formats
+#define LSRAC_FORMAT_F32               0
+#define LSRAC_FORMAT_S16               1
+#define LSRAC_FORMAT_S24               2    // packed little endian, 3 bytes per sample
+#define LSRAC_FORMAT_S32               3
+
+// Filter quality presets
+#define LSRAC_QUALITY_BEST             0    // the full filter
+#define LSRAC_QUALITY_HIGH             1    // half the filter length
+#define LSRAC_QUALITY_MEDIUM           2    // a quarter of the filter length
+#define LSRAC_QUALITY_FAST             3    // an eighth of the filter length
+#define LSRAC_QUALITY_PREVIEW          4    // a Lanczos kernel of 3 lobes, for previews
+
+// Edge policies: what the filter sees before the first and after the last source frame
+#define LSRAC_EDGE_RENORMALIZE         0    // drops the missing taps and rescales the rest (default)
+#define LSRAC_EDGE_ZERO                1    // silence
+#define LSRAC_EDGE_REFLECT             2    // the source mirrored around its first and last frame
+#define LSRAC_EDGE_CLAMP               3    // the first and last frame repeated
+
+// How the filter adds up its products: tap k of either side goes to partial sum k % 4
+// except in serial mode, and the partial sums are added pairwise at the end
+#define LSRAC_ACCUMULATE_SERIAL        0    // one running sum, tap after tap (default)
+#define LSRAC_ACCUMULATE_PAIRWISE      1    // four independent partial sums
+#define LSRAC_ACCUMULATE_KAHAN         2    // four partial sums with Kahan compensation
+
+// Output stage flags, for integer formats
+#define LSRAC_OUTPUT_DITHER            1    // triangular (TPDF) dither of +-1 LSB
+#define LSRAC_OUTPUT_NOISE_SHAPING     2    // second order error feedback, moves noise up in frequency
+
+#ifndef LSRAC_DEFAULT_ALIGNMENT
+#define LSRAC_DEFAULT_ALIGNMENT       64
+#endif
+
+#ifndef LSRAC_STREAM_BLOCK_FRAMES
+#define LSRAC_STREAM_BLOCK_FRAMES     1024
+#endif
+
+#ifndef LSRAC_PHASE_TABLE_MAX_TAPS
+#define LSRAC_PHASE_TABLE_MAX_TAPS    262144
+#endif
+
+#ifndef LSRAC_TILE_CACHE_BYTES
+#define LSRAC_TILE_CACHE_BYTES        32768
+#endif
+
 int32_t lsrac_convert_audio(
         float *   dst_data,         float *   src_data,
         uint64_t  dst_samples,      uint64_t  src_samples,
@@ -69,6 +271,398 @@ int32_t lsrac_convert_audio(
                                     int32_t   src_extra_samples_before,
                                     int32_t   src_extra_samples_after);
 
+// lsrac_convert_audio() with an LSRAC_EDGE_* policy for the filter taps that reach past
+// the src_extra_samples the caller provides on either side.
+int32_t lsrac_convert_audio_edge(
+        float *   dst_data,         float *   src_data,
+        uint64_t  dst_samples,      uint64_t  src_samples,
+        uint64_t  dst_stride_bytes, uint64_t  src_stride_bytes,
+                                    int32_t   src_extra_samples_before,
+                                    int32_t   src_extra_samples_after,
+        uint32_t  edge);
+
+// Converts output frames [dst_first, dst_first + dst_frames) of a source of src_total
+// interleaved frames at src_rate, resampled to dst_rate (both in Hz). src_data holds source
+// frames [src_first, src_first + src_frames), which must cover the frames the output
+// depends on (see lsrac_plan_src_window()). Positions are exact, so ranges converted
+// separately, in any order or in parallel, line up with a single pass sample for sample.
+// Sets up a plan on every call; use lsrac_plan_convert() to keep one.
+int32_t lsrac_convert_rates(
+        float *        dst_data,    const float *  src_data,
+        uint32_t       dst_rate,    uint32_t       src_rate,
+        uint64_t       dst_first,   uint64_t       src_first,
+        uint64_t       dst_frames,  uint64_t       src_frames,
+                                    uint64_t       src_total,
+        uint32_t       channels);
+
+// Allocation callbacks. alloc must return memory aligned to at least the requested
+// alignment (always a power of two), or NULL on failure.
+typedef void * (* lsrac_alloc_proc)(void * user_data, size_t size, size_t alignment);
+typedef void   (* lsrac_free_proc)(void * user_data, void * ptr);
+
+typedef struct lsrac_allocator_s {
+    lsrac_alloc_proc  alloc;
+    lsrac_free_proc   free;
+    size_t            alignment;    // minimum alignment of every allocation, 0 = LSRAC_DEFAULT_ALIGNMENT
+    void *            user_data;
+} lsrac_allocator_t;
+
+// Bump allocator over caller owned memory. Freeing is a no-op, the memory is reclaimed
+// by the caller when everything allocated from it has been uninitialized.
+typedef struct lsrac_arena_s {
+    uint8_t *  memory;
+    size_t     size;
+    size_t     used;
+} lsrac_arena_t;
+
+void lsrac_arena_init(lsrac_arena_t * arena, void * memory, size_t size);
+lsrac_allocator_t lsrac_arena_allocator(lsrac_arena_t * arena);
+
+// Output frame n uses the same source offset and filter taps as output frame n + dst_rate,
+// so for short periods a plan precomputes them once per phase n % dst_rate.
+typedef struct lsrac_phase_s {
+    uint32_t  advance;                      // source frames to the next output frame
+    uint32_t  left_fx;                      // filter position of the first left tap
+    uint32_t  left_taps;
+    uint32_t  right_taps;
+    float     normalization;                // sum of all the taps
+} lsrac_phase_t;
+
+// Everything that can be computed once for a pair of sample rates and a channel count.
+// A plan is read only after init and can be shared by any number of streams and threads.
+typedef struct lsrac_plan_s {
+    uint32_t           src_rate;            // reduced by the greatest common divisor
+    uint32_t           dst_rate;            // reduced by the greatest common divisor
+    uint32_t           channels;            // source channels
+    uint32_t           dst_channels;        // equals channels unless a mix is set
+    float *            mix;                 // dst_channels rows of channels gains, or NULL
+    int32_t            mix_first;           // mix source frames before filtering
+    uint32_t           quality;             // LSRAC_QUALITY_*
+    uint32_t           edge;                // LSRAC_EDGE_*, applies at the start and after flush
+    uint32_t           accumulation;        // LSRAC_ACCUMULATE_*
+    const float *      coefficients;        // right half of the (symmetric) filter
+    uint32_t           coefficient_count;
+    uint64_t           filter_step_fx;      // filter positions per source frame, fixed point
+    uint64_t           filter_limit_fx;     // first filter position that is outside the filter
+    int32_t            half_width;          // source frames the filter reaches on either side
+    lsrac_phase_t *    phases;              // dst_rate entries, or NULL if the table is too large
+    float *            phase_taps;          // left then right taps, phase_stride per phase
+    uint32_t           phase_stride;
+    float *            period_taps;         // integer factor upsampling: the phase table by tap, or NULL
+    uint32_t           period_lanes;        // dst_rate rounded up to a multiple of 4 lanes
+    uint32_t           period_left;         // rows of left taps in period_taps, then
+    uint32_t           period_right;        // rows of right taps and a row of normalizations
+    const double *     coefficients_f64;    // lsrac_plan_prepare_f64(): the filter in double, or NULL
+    double *           phase_taps_f64;      // the phase table in double, then dst_rate normalizations, or NULL
+    uint32_t           tile_frames;         // output frames streams filter per tile
+    uint32_t           tile_channels;       // channels filtered together within a tile
+    lsrac_allocator_t  allocator;
+} lsrac_plan_t;
+
+// Turns float samples into output samples: applies gain and, for integer formats, dither
+// and noise shaping, then rounds and clips to the format's range.
+typedef struct lsrac_output_stage_s {
+    float     gain;
+    uint32_t  flags;                            // LSRAC_OUTPUT_*
+    uint32_t  random;                           // dither noise generator state
+    float     error[LSRAC_MAX_CHANNELS][2];     // last two quantization errors per channel
+} lsrac_output_stage_t;
+
+void lsrac_output_stage_init(lsrac_output_stage_t * stage, float gain, uint32_t flags);
+
+// Converts frames interleaved frames of channels float samples in src to format in dst.
+int32_t lsrac_output_stage_process(
+        lsrac_output_stage_t * stage,
+        void *                 dst,
+        uint32_t               format,
+        const float *          src,
+        uint64_t               frames,
+        uint32_t               channels);
+
+// Resampling state for one (possibly multichannel) stream of interleaved frames.
+typedef struct lsrac_stream_s {
+    const lsrac_plan_t * plan;
+    lsrac_allocator_t    allocator;
+    float *              history;           // planar, history_capacity frames per channel
+    float *              tile;              // filtered frames of the current tile, interleaved
+    uint32_t             history_capacity;
+    uint32_t             history_frames;
+    int64_t              history_first;     // source frame index of the first frame in history
+    uint64_t             src_frames_total;  // source frames received so far
+    uint64_t             dst_position;      // index of the next output frame
+    uint64_t             dst_total;         // number of output frames, known after flush
+    int64_t              src_pos_int;       // source position of the next output frame,
+    uint64_t             src_pos_frac;      // integer part and numerator over 2*dst_rate
+    uint32_t             phase;             // dst_position % plan->dst_rate
+    int32_t              flushed;
+    lsrac_output_stage_t output;            // applied to every sample written
+} lsrac_stream_t;
+
+// Sets up a plan for converting channels interleaved channels from src_rate to dst_rate (Hz).
+// allocator may be NULL. It is also used by streams that are initialized without one.
+// When the reduced dst_rate is small the plan also tabulates the source offset and filter
+// taps of every output frame in the period (see LSRAC_PHASE_TABLE_MAX_TAPS).
+int32_t lsrac_plan_init(
+        lsrac_plan_t *             plan,
+        uint32_t                   src_rate,
+        uint32_t                   dst_rate,
+        uint32_t                   channels,
+        const lsrac_allocator_t *  allocator);
+void lsrac_plan_uninit(lsrac_plan_t * plan);
+
+// Sets the channel mix: output channel d is the sum over source channels s of
+// gains[d * plan->channels + s] times source channel s. gains may be NULL to go back to
+// passing channels through unmixed (dst_channels must then equal plan->channels). Must be
+// called before any stream or pool is initialized with the plan.
+int32_t lsrac_plan_set_mix(lsrac_plan_t * plan, uint32_t dst_channels, const float * gains);
+
+// Shortens the filter to one of the LSRAC_QUALITY_* presets. The shortened filter is
+// tapered to zero at its end. Must be called before any stream or pool is initialized
+// with the plan.
+int32_t lsrac_plan_set_quality(lsrac_plan_t * plan, uint32_t quality);
+
+// Sets how streams filter the frames before the start of the source and, once flushed,
+// after its end. Input a stream received before a seek is history, not an edge.
+int32_t lsrac_plan_set_edge(lsrac_plan_t * plan, uint32_t edge);
+
+// Sets how streams and variable speed streams add up the filter's products, see
+// LSRAC_ACCUMULATE_*. Must be called before any stream is initialized with the plan.
+int32_t lsrac_plan_set_accumulation(lsrac_plan_t * plan, uint32_t accumulation);
+
+// Number of bytes of arena memory lsrac_stream_init() needs for a stream using plan.
+size_t lsrac_stream_workspace_size(const lsrac_plan_t * plan);
+
+// The plan must outlive the stream. allocator may be NULL to use the plan's allocator.
+int32_t lsrac_stream_init(lsrac_stream_t * stream, const lsrac_plan_t * plan, const lsrac_allocator_t * allocator);
+void lsrac_stream_uninit(lsrac_stream_t * stream);
+
+// Forgets all history and starts over at source frame 0.
+void lsrac_stream_reset(lsrac_stream_t * stream);
+
+// Source frames [*src_first, *src_end) are all the input that output frames
+// [dst_first, dst_first + dst_count) depend on. src_end may lie past the end of the source.
+void lsrac_plan_src_window(
+        const lsrac_plan_t * plan,
+        uint64_t             dst_first,
+        uint64_t             dst_count,
+        uint64_t *           src_first,
+        uint64_t *           src_end);
+
+// Starts the stream over at output frame dst_frame. Input must continue at source frame
+// *src_frame (the src_first of lsrac_plan_src_window()). The frames written are identical
+// to the ones a stream that started at frame 0 writes, apart from dither noise.
+int32_t lsrac_stream_seek(lsrac_stream_t * stream, uint64_t dst_frame, uint64_t * src_frame);
+
+// Sets up the output stage: gain 1 and no flags after init. Reset keeps these settings
+// and clears the stage's state.
+void lsrac_stream_set_output(lsrac_stream_t * stream, float gain, uint32_t flags);
+
+// Consumes up to src_frames interleaved frames and writes up to dst_frames interleaved
+// frames. Returns when either all input is consumed or the output is full; the number of
+// frames actually read and written is returned through the (optional) out parameters.
+int32_t lsrac_stream_process(
+        lsrac_stream_t * stream,
+        float *          dst_data,  uint64_t   dst_frames, uint64_t * dst_frames_written,
+        const float *    src_data,  uint64_t   src_frames, uint64_t * src_frames_read);
+
+// Marks the end of the input and writes the remaining output frames. Call repeatedly
+// until fewer than dst_frames frames are written.
+int32_t lsrac_stream_flush(
+        lsrac_stream_t * stream,
+        float *          dst_data,  uint64_t   dst_frames, uint64_t * dst_frames_written);
+
+// Number of output frames a source of src_frames frames converts to.
+uint64_t lsrac_plan_dst_frames(const lsrac_plan_t * plan, uint64_t src_frames);
+
+// lsrac_convert_rates() with the rates and channels of plan. The output frames are the
+// ones a stream over the whole source writes. Every call allocates a temporary stream
+// from the plan's allocator; use lsrac_stream_convert() to convert ranges one after
+// another without allocating.
+int32_t lsrac_plan_convert(
+        const lsrac_plan_t * plan,
+        float *        dst_data,    const float *  src_data,
+        uint64_t       dst_first,   uint64_t       src_first,
+        uint64_t       dst_frames,  uint64_t       src_frames,
+                                    uint64_t       src_total);
+
+// lsrac_plan_convert() with a stream the caller initialized with the plan. The stream is
+// seeked to dst_first and its output stage applies; nothing is allocated.
+int32_t lsrac_stream_convert(
+        lsrac_stream_t * stream,
+        float *        dst_data,    const float *  src_data,
+        uint64_t       dst_first,   uint64_t       src_first,
+        uint64_t       dst_frames,  uint64_t       src_frames,
+                                    uint64_t       src_total);
+
+// Builds the plan's filter and phase table in double precision, for lsrac_plan_convert_f64().
+// Changing the quality afterwards rebuilds them.
+int32_t lsrac_plan_prepare_f64(lsrac_plan_t * plan);
+
+// lsrac_plan_convert() in double precision: double samples in and out, and the filter
+// coefficients and sums held in double. Uses the plan's quality, edge policy and mix.
+// Nothing is allocated once lsrac_plan_prepare_f64() has been called, otherwise every call
+// builds temporary tables from the plan's allocator.
+int32_t lsrac_plan_convert_f64(
+        const lsrac_plan_t * plan,
+        double *       dst_data,    const double * src_data,
+        uint64_t       dst_first,   uint64_t       src_first,
+        uint64_t       dst_frames,  uint64_t       src_frames,
+                                    uint64_t       src_total);
+
+// lsrac_convert_rates() in double precision, see lsrac_plan_convert_f64().
+int32_t lsrac_convert_rates_f64(
+        double *       dst_data,    const double * src_data,
+        uint32_t       dst_rate,    uint32_t       src_rate,
+        uint64_t       dst_first,   uint64_t       src_first,
+        uint64_t       dst_frames,  uint64_t       src_frames,
+                                    uint64_t       src_total,
+        uint32_t       channels);
+
+// Where the samples of a multichannel buffer live: sample i of channel c is sample
+// i * stride[c] of channel_data[c], with stride counted in samples of the buffer's format.
+// Interleaved, planar and per-channel strided buffers are all described this way, and the
+// layout change happens while the stream reads its input and writes its output.
+typedef struct lsrac_buffer_s {
+    void *    channel_data[LSRAC_MAX_CHANNELS];
+    uint64_t  stride[LSRAC_MAX_CHANNELS];
+    uint32_t  channels;
+    uint32_t  format;                           // LSRAC_FORMAT_*, stream input must be F32
+} lsrac_buffer_t;
+
+// channels samples per frame, one after the other.
+void lsrac_buffer_interleaved(lsrac_buffer_t * buffer, void * data, uint32_t channels, uint32_t format);
+// One contiguous array per channel.
+void lsrac_buffer_planar(lsrac_buffer_t * buffer, void * const * channel_data, uint32_t channels, uint32_t format);
+// Moves every channel pointer forward by frames frames.
+void lsrac_buffer_advance(lsrac_buffer_t * buffer, uint64_t frames);
+
+// lsrac_stream_process() and lsrac_stream_flush() for arbitrary layouts. Input and output
+// may use different layouts; src must have plan->channels channels and dst
+// plan->dst_channels channels.
+int32_t lsrac_stream_process_buffers(
+        lsrac_stream_t *        stream,
+        const lsrac_buffer_t *  dst,  uint64_t   dst_frames, uint64_t * dst_frames_written,
+        const lsrac_buffer_t *  src,  uint64_t   src_frames, uint64_t * src_frames_read);
+int32_t lsrac_stream_flush_buffers(
+        lsrac_stream_t *        stream,
+        const lsrac_buffer_t *  dst,  uint64_t   dst_frames, uint64_t * dst_frames_written);
+
+// A stream whose speed can change at every output frame. Output frame n covers source
+// time [t(n), t(n + 1)), where t advances by the plan's src_rate / dst_rate times the
+// speed of frame n, so at speed 1 the output lines up with an lsrac_stream_t's.
+typedef struct lsrac_vstream_s {
+    lsrac_stream_t  stream;             // history and output stage
+    lsrac_plan_t    kernel;             // copy of the plan, its filter step follows the speed
+    double          nominal_ratio;      // source frames per output frame at speed 1
+    double          max_speed;
+    double          speed;              // speed of the next output frame
+    double          target_speed;
+    uint64_t        ramp_frames;        // output frames until speed reaches target_speed
+    double          src_time;           // source time at the start of the next output frame
+    double          step_ratio;         // ratio kernel.filter_step_fx was computed for
+    uint64_t        full_step_fx;       // filter step without a lowered cutoff
+    float *         taps;               // left then right taps of the current output frame
+} lsrac_vstream_t;
+
+// plan must stay alive while the stream is used. max_speed bounds every speed the stream
+// is given and sets how much history it keeps.
+int32_t lsrac_vstream_init(lsrac_vstream_t * vstream, const lsrac_plan_t * plan, float max_speed, const lsrac_allocator_t * allocator);
+void lsrac_vstream_uninit(lsrac_vstream_t * vstream);
+
+// Starts over at source frame 0 at the target speed; the speed and output settings are kept.
+void lsrac_vstream_reset(lsrac_vstream_t * vstream);
+
+// Changes the speed linearly over the next ramp_frames output frames, or from the next
+// output frame on when ramp_frames is 0. speed must lie in (0, max_speed].
+int32_t lsrac_vstream_set_speed(lsrac_vstream_t * vstream, float speed, uint64_t ramp_frames);
+
+// lsrac_stream_process() at the current speed. If speeds is not NULL, speeds[i] is the
+// speed of the i-th output frame written by this call (dst_frames entries, clamped to
+// (0, max_speed]) and the last one used becomes the current speed.
+int32_t lsrac_vstream_process(
+        lsrac_vstream_t * vstream,
+        float *           dst_data,  uint64_t   dst_frames, uint64_t * dst_frames_written,
+        const float *     src_data,  uint64_t   src_frames, uint64_t * src_frames_read,
+        const float *     speeds);
+int32_t lsrac_vstream_flush(
+        lsrac_vstream_t * vstream,
+        float *           dst_data,  uint64_t   dst_frames, uint64_t * dst_frames_written,
+        const float *     speeds);
+
+// A pool of mono streams that share one plan and one clock. Stream histories are stored
+// frame by frame with all streams side by side, so every output frame is one pass of the
+// filter over all streams at once.
+typedef struct lsrac_pool_s {
+    const lsrac_plan_t * plan;
+    lsrac_allocator_t    allocator;
+    uint32_t             capacity;          // maximum number of streams
+    uint32_t             lane_stride;       // capacity rounded up to a whole SIMD register
+    uint32_t             block_frames;      // source frames per stream and lsrac_pool_process_all() call
+    uint8_t *            active;            // capacity flags
+    float *              history;           // history_capacity rows of lane_stride samples
+    float *              accumulators;      // lane_stride samples
+    float *              taps;              // 2 * plan->half_width filter coefficients
+    uint32_t             history_capacity;
+    uint32_t             history_frames;
+    int64_t              history_first;
+    int64_t              src_pos_int;
+    uint64_t             src_pos_frac;
+    uint32_t             phase;
+    uint32_t             active_count;
+} lsrac_pool_t;
+
+// Number of bytes of arena memory lsrac_pool_init() needs.
+size_t lsrac_pool_workspace_size(const lsrac_plan_t * plan, uint32_t capacity, uint32_t block_frames);
+
+// plan must be a mono plan without a mix. Streams start from silence, so plans with
+// LSRAC_EDGE_REFLECT or LSRAC_EDGE_CLAMP are refused. Every call to lsrac_pool_process_all()
+// consumes exactly block_frames source frames per stream.
+int32_t lsrac_pool_init(
+        lsrac_pool_t *             pool,
+        const lsrac_plan_t *       plan,
+        uint32_t                   capacity,
+        uint32_t                   block_frames,
+        const lsrac_allocator_t *  allocator);
+void lsrac_pool_uninit(lsrac_pool_t * pool);
+
+// Claims a free stream slot. The stream joins at the pool's current position with silent
+// history, its first output frame is written by the next lsrac_pool_process_all().
+int32_t lsrac_pool_add_stream(lsrac_pool_t * pool, uint32_t * stream_index);
+int32_t lsrac_pool_remove_stream(lsrac_pool_t * pool, uint32_t stream_index);
+
+// Upper bound for the number of output frames a single lsrac_pool_process_all() writes.
+uint64_t lsrac_pool_max_dst_frames(const lsrac_pool_t * pool);
+
+// Runs one block for every active stream. src_data[i] holds block_frames frames for stream i
+// (NULL is silence) and dst_data[i] receives the output frames for stream i. Entries for
+// inactive streams are ignored. The number of frames written, which is the same for every
+// stream, is returned in dst_frames_written.
+int32_t lsrac_pool_process_all(
+        lsrac_pool_t *         pool,
+        float * const *        dst_data,
+        const float * const *  src_data,
+        uint64_t *             dst_frames_written);
+
+// Counters of the calling thread, collected when the implementation is compiled with
+// LSRAC_ENABLE_STATS (all zero otherwise). Ticks are CPU cycles (rdtsc) on x86 and
+// nanoseconds elsewhere.
+typedef struct lsrac_stats_s {
+    uint64_t  calls;                // conversion, process and flush calls
+    uint64_t  src_frames;           // frames read
+    uint64_t  dst_frames;           // frames written, per stream for pools
+    uint64_t  interior_taps;        // multiply-adds on source frames inside the source
+    uint64_t  edge_taps;            // taps past the ends of the source
+    uint64_t  setup_ticks;          // plan and stream initialization
+    uint64_t  input_ticks;          // reading the source into stream history
+    uint64_t  interior_ticks;       // filtering output frames that lie inside the source
+    uint64_t  edge_ticks;           // filtering output frames that reach past its ends
+    uint64_t  output_ticks;         // mixing, gain, dither and format conversion
+    int32_t   ticks_are_cycles;
+} lsrac_stats_t;
+
+void lsrac_stats_get(lsrac_stats_t * stats);
+void lsrac_stats_reset(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -78,15 +672,61 @@ int32_t lsrac_convert_audio(
 #ifdef LSRAC_IMPLEMENTATION
 
 #include <stdlib.h>
+#include <string.h>
 #include <math.h>
 #include <limits.h>
 
+#ifndef LSRAC_MALLOC
+#define LSRAC_MALLOC(sz) malloc((sz))
+#endif
+#ifndef LSRAC_FREE
+#define LSRAC_FREE(p) free((p))
+#endif
+
+#if !defined(LSRAC_NO_SIMD)
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define LSRAC__SSE
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define LSRAC__NEON
+#include <arm_neon.h>
+#endif
+#endif
+
+#if defined(LSRAC_ENABLE_STATS)
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define LSRAC__STATS_CYCLES 1
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#else
+#define LSRAC__STATS_CYCLES 0
+#include <chrono>
+#endif
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
 #define ARRAY_COUNT(arr) (sizeof(arr) / sizeof((arr)[0]))
 
+#define LSRAC__FX_BITS 16
+#define LSRAC__FX_ONE  (static_cast<uint64_t>(1) << LSRAC__FX_BITS)
+#define LSRAC__FX_MASK (LSRAC__FX_ONE - 1)
+
+#define LSRAC__TILE_MAX_FRAMES 64
+
+#define LSRAC__PREVIEW_LOBES 3
+
+// Largest upsampling factor plans keep a period table for
+#define LSRAC__PERIOD_MAX_FACTOR 16
+
+// Taps the double precision filter computes at a time without a phase table, a multiple of 4
+#define LSRAC__F64_TAP_BLOCK 64
+
 typedef struct lsrac_filter_s {
     const int32_t increment;
     const float coefficients[4624];
@@ -94,31 +734,274 @@ typedef struct lsrac_filter_s {
 
 extern const lsrac_filter_t lsrac_filter;
 
+// The same coefficients in double precision, for lsrac_plan_convert_f64().
+typedef struct lsrac_filter_f64_s {
+    const int32_t increment;
+    const double coefficients[4624];
+} lsrac_filter_f64_t;
+
+extern const lsrac_filter_f64_t lsrac_filter_f64;
+
+/*
+ *  Instrumentation
+ */
+
+#if defined(LSRAC_ENABLE_STATS)
+
+static thread_local lsrac_stats_t lsrac__stats;
+
+static inline uint64_t lsrac__stats_now(void)
+{
+#if LSRAC__STATS_CYCLES
+    return __rdtsc();
+#else
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+}
+
+#define LSRAC__STATS_ADD(field, count)          (lsrac__stats.field += static_cast<uint64_t>(count))
+#define LSRAC__STATS_START(name)                uint64_t name = lsrac__stats_now()
+#define LSRAC__STATS_SINCE(field, start)        (lsrac__stats.field += lsrac__stats_now() - (start))
+#define LSRAC__STATS_FILTERED(at_edge, start)   (*((at_edge) ? &lsrac__stats.edge_ticks : &lsrac__stats.interior_ticks) += lsrac__stats_now() - (start))
+
+#else
+
+#define LSRAC__STATS_ADD(field, count)          ((void)0)
+#define LSRAC__STATS_START(name)                ((void)0)
+#define LSRAC__STATS_SINCE(field, start)        ((void)0)
+#define LSRAC__STATS_FILTERED(at_edge, start)   ((void)(at_edge))
+
+#endif
+
+void lsrac_stats_get(lsrac_stats_t * stats)
+{
+#if defined(LSRAC_ENABLE_STATS)
+    *stats = lsrac__stats;
+    stats->ticks_are_cycles = LSRAC__STATS_CYCLES;
+#else
+    memset(stats, 0, sizeof(*stats));
+#endif
+}
+
+void lsrac_stats_reset(void)
+{
+#if defined(LSRAC_ENABLE_STATS)
+    memset(&lsrac__stats, 0, sizeof(lsrac__stats));
+#endif
+}
+
 static inline float clamp(float x, float val)
 {
     return fminf(fmaxf(x, -val), val);
 }
 
+// dst[dst_stride * i] = src[src_stride * i] for count samples. Only the samples at those
+// positions are read or written, so other channels of interleaved buffers are left alone.
+static void lsrac__copy_samples(float * dst, uint64_t dst_stride, const float * src, uint64_t src_stride, uint64_t count)
+{
+    if (count == 0 || (dst == src && dst_stride == src_stride)) {
+        return;
+    }
+
+    if (dst_stride == 1 && src_stride == 1) {
+        memcpy(dst, src, sizeof(float) * count);
+        return;
+    }
+
+    uint64_t i = 0;
+
+    if (dst_stride == 1) {
+        // Deinterleave. The vector loads may read past the sample that is needed, but never past
+        // the last sample of the source.
+#if defined(LSRAC__SSE)
+        if (src_stride == 2) {
+            for (; i + 5 <= count; i += 4) {
+                __m128 a = _mm_loadu_ps(src + 2 * i);
+                __m128 b = _mm_loadu_ps(src + 2 * i + 4);
+                _mm_storeu_ps(dst + i, _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0)));
+            }
+        } else {
+            for (; (i + 3) * src_stride + 3 <= (count - 1) * src_stride; i += 4) {
+                __m128 a = _mm_loadu_ps(src + src_stride * i);
+                __m128 b = _mm_loadu_ps(src + src_stride * (i + 1));
+                __m128 c = _mm_loadu_ps(src + src_stride * (i + 2));
+                __m128 d = _mm_loadu_ps(src + src_stride * (i + 3));
+                _mm_storeu_ps(dst + i, _mm_movelh_ps(_mm_unpacklo_ps(a, b), _mm_unpacklo_ps(c, d)));
+            }
+        }
+#elif defined(LSRAC__NEON)
+        if (src_stride == 2) {
+            for (; i + 5 <= count; i += 4) {
+                vst1q_f32(dst + i, vld2q_f32(src + 2 * i).val[0]);
+            }
+        } else if (src_stride == 4) {
+            for (; i + 5 <= count; i += 4) {
+                vst1q_f32(dst + i, vld4q_f32(src + 4 * i).val[0]);
+            }
+        }
+#endif
+        for (; i < count; ++i) {
+            dst[i] = src[src_stride * i];
+        }
+        return;
+    }
+
+    if (src_stride == 1) {
+        // Reinterleave. Stores have to stay scalar so the other channels are never touched (and
+        // can be written by other threads at the same time), but the constant strides let the
+        // compiler unroll the common channel counts.
+        switch (dst_stride) {
+        case 2: for (; i < count; ++i) { dst[2 * i] = src[i]; } return;
+        case 4: for (; i < count; ++i) { dst[4 * i] = src[i]; } return;
+        case 6: for (; i < count; ++i) { dst[6 * i] = src[i]; } return;
+        case 8: for (; i < count; ++i) { dst[8 * i] = src[i]; } return;
+        default: break;
+        }
+    }
+
+    for (; i < count; ++i) {
+        dst[dst_stride * i] = src[src_stride * i];
+    }
+}
+
+// Moves index, which lies outside [first_valid, end_valid), to the source frame the edge
+// policy puts there. Returns 0 if the frame is silent.
+static inline int32_t lsrac__edge_index(int64_t * index, int64_t first_valid, int64_t end_valid, uint32_t edge)
+{
+    int64_t length = end_valid - first_valid;
+
+    if (edge == LSRAC_EDGE_ZERO || length <= 0) {
+        return 0;
+    }
+
+    if (edge == LSRAC_EDGE_CLAMP || length == 1) {
+        *index = *index < first_valid ? first_valid : end_valid - 1;
+        return 1;
+    }
+
+    // Mirrored around the first and last frame, which repeats every 2 * (length - 1) frames
+    int64_t period = 2 * (length - 1);
+    int64_t offset = (*index - first_valid) % period;
+    if (offset < 0) {
+        offset += period;
+    }
+    if (offset >= length) {
+        offset = period - offset;
+    }
+
+    *index = first_valid + offset;
+    return 1;
+}
+
+// Adds the taps of one side of the filter to value and normalization_value, going from
+// sample (counted from base) in direction -1 or 1. Samples [0, valid) are read without
+// bounds checks, the taps past them are dropped or follow the edge policy. Returns 1 if
+// the filter reached past the valid samples.
+static int32_t lsrac__convert_taps(
+        const float * base,
+        uint64_t      stride,
+        int64_t       sample,
+        int64_t       direction,
+        int64_t       valid,
+        size_t        filter_pos,
+        size_t        filter_pos_increment,
+        uint32_t      edge,
+        float *       value,
+        float *       normalization_value)
+{
+    const size_t coefficient_count = ARRAY_COUNT(lsrac_filter.coefficients);
+
+    if (filter_pos >= coefficient_count) {
+        return 0;
+    }
+
+    int64_t inside = direction < 0 ? sample + 1 : valid - sample;
+    if (inside < 0) {
+        inside = 0;
+    }
+
+    int64_t taps = inside;
+    if (filter_pos_increment != 0) {
+        taps = static_cast<int64_t>((coefficient_count - 1 - filter_pos) / filter_pos_increment) + 1;
+    }
+
+    int64_t interior = taps < inside ? taps : inside;
+
+    float v = *value;
+    float n = *normalization_value;
+
+    for (int64_t k = 0; k < interior; ++k) {
+        float c = lsrac_filter.coefficients[filter_pos];
+        v += c * base[static_cast<size_t>(sample + direction * k) * stride];
+        n += c;
+        filter_pos += filter_pos_increment;
+    }
+
+    if (edge != LSRAC_EDGE_RENORMALIZE) {
+        for (int64_t k = interior; k < taps; ++k) {
+            float c = lsrac_filter.coefficients[filter_pos];
+            int64_t index = sample + direction * k;
+            if (lsrac__edge_index(&index, 0, valid, edge)) {
+                v += c * base[static_cast<size_t>(index) * stride];
+            }
+            n += c;
+            filter_pos += filter_pos_increment;
+        }
+    }
+
+    *value = v;
+    *normalization_value = n;
+
+    LSRAC__STATS_ADD(interior_taps, interior);
+    LSRAC__STATS_ADD(edge_taps, edge != LSRAC_EDGE_RENORMALIZE ? taps - interior : 0);
+
+    return taps > inside;
+}
+
 int32_t lsrac_convert_audio(
         float *   dst_data,         float *   src_data,
         uint64_t  dst_samples,      uint64_t  src_samples,
         uint64_t  dst_stride_bytes, uint64_t  src_stride_bytes,
                                     int32_t   src_extra_samples_before,
                                     int32_t   src_extra_samples_after)
+{
+    return lsrac_convert_audio_edge(dst_data,         src_data,
+                                    dst_samples,      src_samples,
+                                    dst_stride_bytes, src_stride_bytes,
+                                    src_extra_samples_before,
+                                    src_extra_samples_after,
+                                    LSRAC_EDGE_RENORMALIZE);
+}
+
+int32_t lsrac_convert_audio_edge(
+        float *   dst_data,         float *   src_data,
+        uint64_t  dst_samples,      uint64_t  src_samples,
+        uint64_t  dst_stride_bytes, uint64_t  src_stride_bytes,
+                                    int32_t   src_extra_samples_before,
+                                    int32_t   src_extra_samples_after,
+        uint32_t  edge)
 {
     uint64_t dst_stride = dst_stride_bytes / sizeof(float);
     uint64_t src_stride = src_stride_bytes / sizeof(float);
 
     if (dst_data == nullptr ||
-        src_data == nullptr) {
+        src_data == nullptr ||
+        edge > LSRAC_EDGE_CLAMP) {
         return LSRAC_RET_VAL_ARGUMENT_ERROR;
     }
 
+    // Source samples that can be read, counted from actual_src_data
+    float * actual_src_data = src_data - src_stride * (uint64_t)src_extra_samples_before;
+    int64_t valid_samples = static_cast<int64_t>(src_samples) + src_extra_samples_before + src_extra_samples_after;
+
+    LSRAC__STATS_ADD(calls, 1);
+    LSRAC__STATS_ADD(src_frames, src_samples);
+    LSRAC__STATS_ADD(dst_frames, dst_samples);
+
     if (src_samples == dst_samples) {
 
-        for (size_t i = 0; i < static_cast<size_t>(src_samples); ++i) {
-            dst_data[dst_stride * i] = src_data[src_stride * i];
-        }
+        lsrac__copy_samples(dst_data, dst_stride, src_data, src_stride, src_samples);
 
         return LSRAC_RET_VAL_OK;
     }
@@ -143,10 +1026,13 @@ int32_t lsrac_convert_audio(
 
         while (current_dst_sample < dst_samples) {
 
+            LSRAC__STATS_START(sample_start);
+
             float current_time_ticks = static_cast<float>(current_dst_sample) * dst_ticks_per_sample + dst_half_sample_offset_ticks;
 
             float value = 0.0f;
             float normalization_value = 0.0f;
+            int32_t at_edge = 0;
 
             {
                 // Left part of sinc filter
@@ -154,19 +1040,10 @@ int32_t lsrac_convert_audio(
                 float dst_pos_to_src_pos_ticks = current_time_ticks - src_half_sample_offset_ticks - static_cast<float>(current_src_sample) * src_ticks_per_sample;
                 size_t current_filter_pos = static_cast<size_t>(dst_pos_to_src_pos_ticks / ticks_per_filter_step);
 
-                float * actual_src_data = src_data - src_stride * (uint64_t)src_extra_samples_before;
                 current_src_sample += src_extra_samples_before;
-                current_src_sample *= src_stride;
-
-                while (current_src_sample >= 0 &&
-                       current_filter_pos < ARRAY_COUNT(lsrac_filter.coefficients)) {
-
-                    value += lsrac_filter.coefficients[current_filter_pos] * actual_src_data[static_cast<size_t>(current_src_sample)];
-                    normalization_value += lsrac_filter.coefficients[current_filter_pos];
 
-                    current_src_sample -= src_stride;
-                    current_filter_pos += filter_pos_increment;
-                }
+                at_edge |= lsrac__convert_taps(actual_src_data, src_stride, current_src_sample, -1, valid_samples,
+                                               current_filter_pos, filter_pos_increment, edge, &value, &normalization_value);
             }
 
             {
@@ -175,21 +1052,16 @@ int32_t lsrac_convert_audio(
                 float dst_pos_to_src_pos_ticks = static_cast<float>(current_src_sample) * src_ticks_per_sample + src_half_sample_offset_ticks - current_time_ticks;
                 size_t current_filter_pos = static_cast<size_t>(dst_pos_to_src_pos_ticks / ticks_per_filter_step);
 
-                current_src_sample *= src_stride;
-
-                while (current_src_sample < static_cast<int64_t>(src_stride*(src_samples + (uint64_t)src_extra_samples_after)) &&
-                       current_filter_pos < ARRAY_COUNT(lsrac_filter.coefficients)) {
-
-                    value += lsrac_filter.coefficients[current_filter_pos] * src_data[static_cast<size_t>(current_src_sample)];
-                    normalization_value += lsrac_filter.coefficients[current_filter_pos];
+                current_src_sample += src_extra_samples_before;
 
-                    current_src_sample += src_stride;
-                    current_filter_pos += filter_pos_increment;
-                }
+                at_edge |= lsrac__convert_taps(actual_src_data, src_stride, current_src_sample, 1, valid_samples,
+                                               current_filter_pos, filter_pos_increment, edge, &value, &normalization_value);
             }
 
             dst_data[dst_stride * current_dst_sample] = value / normalization_value;
 
+            LSRAC__STATS_FILTERED(at_edge, sample_start);
+
             current_dst_sample += 1;
         }
 
@@ -198,7 +1070,8 @@ int32_t lsrac_convert_audio(
 
     if (ratio > 1.0f) {
         // Upsample
-        // Maybe this should use Lanczos coefficients rather than the (longer) sinc?
+        // Plans have a Lanczos preset (LSRAC_QUALITY_PREVIEW) and filter integer factors
+        // a period at a time, this path keeps its output as it was.
 
         float ticks_per_filter_step = src_ticks_per_sample / static_cast<float>(lsrac_filter.increment);
         size_t filter_pos_increment = static_cast<size_t>(lsrac_filter.increment);
@@ -207,10 +1080,13 @@ int32_t lsrac_convert_audio(
 
         while (current_dst_sample < dst_samples) {
 
+            LSRAC__STATS_START(sample_start);
+
             float current_time_ticks = static_cast<float>(current_dst_sample) * dst_ticks_per_sample + dst_half_sample_offset_ticks;
 
             float value = 0.0f;
             float normalization_value = 0.0f;
+            int32_t at_edge = 0;
 
             {
                 // Left part of sinc filter
@@ -218,19 +1094,10 @@ int32_t lsrac_convert_audio(
                 float dst_pos_to_src_pos_ticks = current_time_ticks - src_half_sample_offset_ticks - static_cast<float>(current_src_sample) * src_ticks_per_sample;
                 size_t current_filter_pos = static_cast<size_t>(dst_pos_to_src_pos_ticks / ticks_per_filter_step);
 
-                float * actual_src_data = src_data - src_stride * (uint64_t)src_extra_samples_before;
                 current_src_sample += src_extra_samples_before;
-                current_src_sample *= src_stride;
-
-                while (current_src_sample >= 0 &&
-                       current_filter_pos < ARRAY_COUNT(lsrac_filter.coefficients)) {
 
-                    value += lsrac_filter.coefficients[current_filter_pos] * actual_src_data[static_cast<size_t>(current_src_sample)];
-                    normalization_value += lsrac_filter.coefficients[current_filter_pos];
-
-                    current_src_sample -= src_stride;
-                    current_filter_pos += filter_pos_increment;
-                }
+                at_edge |= lsrac__convert_taps(actual_src_data, src_stride, current_src_sample, -1, valid_samples,
+                                               current_filter_pos, filter_pos_increment, edge, &value, &normalization_value);
             }
 
             {
@@ -239,21 +1106,16 @@ int32_t lsrac_convert_audio(
                 float dst_pos_to_src_pos_ticks = static_cast<float>(current_src_sample) * src_ticks_per_sample + src_half_sample_offset_ticks - current_time_ticks;
                 size_t current_filter_pos = static_cast<size_t>(dst_pos_to_src_pos_ticks / ticks_per_filter_step);
 
-                current_src_sample *= src_stride;
-
-                while (current_src_sample < static_cast<int64_t>(src_stride*(src_samples + (uint64_t)src_extra_samples_after)) &&
-                       current_filter_pos < ARRAY_COUNT(lsrac_filter.coefficients)) {
-
-                    value += lsrac_filter.coefficients[current_filter_pos] * src_data[static_cast<size_t>(current_src_sample)];
-                    normalization_value += lsrac_filter.coefficients[current_filter_pos];
+                current_src_sample += src_extra_samples_before;
 
-                    current_src_sample += src_stride;
-                    current_filter_pos += filter_pos_increment;
-                }
+                at_edge |= lsrac__convert_taps(actual_src_data, src_stride, current_src_sample, 1, valid_samples,
+                                               current_filter_pos, filter_pos_increment, edge, &value, &normalization_value);
             }
 
             dst_data[dst_stride * current_dst_sample] = value / normalization_value;
 
+            LSRAC__STATS_FILTERED(at_edge, sample_start);
+
             current_dst_sample += 1;
         }
 
@@ -263,2472 +1125,5348 @@ int32_t lsrac_convert_audio(
     return LSRAC_RET_VAL_ERROR;
 }
 
-const lsrac_filter_t lsrac_filter = {
+/*
+ *  Memory
+ */
+
+static void * lsrac__default_alloc(void * user_data, size_t size, size_t alignment)
+{
+    (void)user_data;
+
+    // Over-allocate and keep the pointer returned by LSRAC_MALLOC just before the aligned block.
+    uint8_t * raw = static_cast<uint8_t *>(LSRAC_MALLOC(size + alignment + sizeof(void *)));
+    if (raw == nullptr) {
+        return nullptr;
+    }
+
+    uintptr_t aligned = (reinterpret_cast<uintptr_t>(raw) + sizeof(void *) + alignment - 1) & ~static_cast<uintptr_t>(alignment - 1);
+    reinterpret_cast<void **>(aligned)[-1] = raw;
+
+    return reinterpret_cast<void *>(aligned);
+}
+
+static void lsrac__default_free(void * user_data, void * ptr)
+{
+    (void)user_data;
+
+    if (ptr != nullptr) {
+        LSRAC_FREE(reinterpret_cast<void **>(ptr)[-1]);
+    }
+}
+
+static void * lsrac__arena_alloc(void * user_data, size_t size, size_t alignment)
+{
+    lsrac_arena_t * arena = static_cast<lsrac_arena_t *>(user_data);
+
+    uintptr_t base  = reinterpret_cast<uintptr_t>(arena->memory);
+    uintptr_t start = (base + arena->used + alignment - 1) & ~static_cast<uintptr_t>(alignment - 1);
+
+    if (start + size > base + arena->size) {
+        return nullptr;
+    }
+
+    arena->used = static_cast<size_t>(start + size - base);
+
+    return reinterpret_cast<void *>(start);
+}
+
+static void lsrac__arena_free(void * user_data, void * ptr)
+{
+    (void)user_data;
+    (void)ptr;
+}
+
+void lsrac_arena_init(lsrac_arena_t * arena, void * memory, size_t size)
+{
+    arena->memory = static_cast<uint8_t *>(memory);
+    arena->size   = memory != nullptr ? size : 0;
+    arena->used   = 0;
+}
+
+lsrac_allocator_t lsrac_arena_allocator(lsrac_arena_t * arena)
+{
+    lsrac_allocator_t allocator;
+    allocator.alloc     = lsrac__arena_alloc;
+    allocator.free      = lsrac__arena_free;
+    allocator.alignment = LSRAC_DEFAULT_ALIGNMENT;
+    allocator.user_data = arena;
+    return allocator;
+}
+
+static lsrac_allocator_t lsrac__resolve_allocator(const lsrac_allocator_t * allocator)
+{
+    lsrac_allocator_t resolved;
+
+    if (allocator == nullptr || allocator->alloc == nullptr || allocator->free == nullptr) {
+        resolved.alloc     = lsrac__default_alloc;
+        resolved.free      = lsrac__default_free;
+        resolved.alignment = allocator != nullptr ? allocator->alignment : 0;
+        resolved.user_data = nullptr;
+    } else {
+        resolved = *allocator;
+    }
+
+    if (resolved.alignment < LSRAC_DEFAULT_ALIGNMENT) {
+        resolved.alignment = LSRAC_DEFAULT_ALIGNMENT;
+    }
+
+    return resolved;
+}
+
+static void * lsrac__alloc(const lsrac_allocator_t * allocator, size_t size)
+{
+    return allocator->alloc(allocator->user_data, size, allocator->alignment);
+}
+
+static void lsrac__free(const lsrac_allocator_t * allocator, void * ptr)
+{
+    if (ptr != nullptr) {
+        allocator->free(allocator->user_data, ptr);
+    }
+}
+
+// Size an allocation of size bytes takes up in an arena, including worst case alignment padding.
+static size_t lsrac__workspace_bytes(size_t size)
+{
+    return size + LSRAC_DEFAULT_ALIGNMENT;
+}
+
+
+/*
+ *  Filter kernel
+ */
+
+static inline float lsrac__filter_tap(const float * coefficients, uint64_t pos_fx)
+{
+    size_t index = static_cast<size_t>(pos_fx >> LSRAC__FX_BITS);
+    float  frac  = static_cast<float>(pos_fx & LSRAC__FX_MASK) * (1.0f / static_cast<float>(LSRAC__FX_ONE));
+
+    return coefficients[index] + frac * (coefficients[index + 1] - coefficients[index]);
+}
+
+// Number of taps, starting at filter position start_fx, that fall inside the filter.
+static inline int64_t lsrac__taps_in_filter(const lsrac_plan_t * plan, uint64_t start_fx)
+{
+    if (start_fx >= plan->filter_limit_fx) {
+        return 0;
+    }
+    return static_cast<int64_t>((plan->filter_limit_fx - start_fx - 1) / plan->filter_step_fx) + 1;
+}
+
+// Partial sums of the LSRAC_ACCUMULATE_* modes. Serial mode only uses sum[0].
+typedef struct lsrac__accumulator_s {
+    float  sum[4];
+    float  compensation[4];                 // Kahan mode: what each sum lost to rounding
+} lsrac__accumulator_t;
+
+static inline void lsrac__accumulator_clear(lsrac__accumulator_t * acc)
+{
+    memset(acc, 0, sizeof(*acc));
+}
+
+// Adds x as tap k of a side of the filter.
+static inline void lsrac__accumulate(lsrac__accumulator_t * acc, uint32_t accumulation, int64_t k, float x)
+{
+    if (accumulation == LSRAC_ACCUMULATE_SERIAL) {
+        acc->sum[0] += x;
+        return;
+    }
+
+    size_t lane = static_cast<size_t>(k) & 3;
+
+    if (accumulation == LSRAC_ACCUMULATE_KAHAN) {
+        float y = x - acc->compensation[lane];
+        float t = acc->sum[lane] + y;
+        acc->compensation[lane] = (t - acc->sum[lane]) - y;
+        acc->sum[lane] = t;
+    } else {
+        acc->sum[lane] += x;
+    }
+}
+
+static inline float lsrac__accumulator_total(const lsrac__accumulator_t * acc, uint32_t accumulation)
+{
+    if (accumulation == LSRAC_ACCUMULATE_SERIAL) {
+        return acc->sum[0];
+    }
+    if (accumulation == LSRAC_ACCUMULATE_KAHAN) {
+        return ((acc->sum[0] - acc->compensation[0]) + (acc->sum[1] - acc->compensation[1])) +
+               ((acc->sum[2] - acc->compensation[2]) + (acc->sum[3] - acc->compensation[3]));
+    }
+    return (acc->sum[0] + acc->sum[1]) + (acc->sum[2] + acc->sum[3]);
+}
+
+// Adds taps[k] * src[direction * k] as taps 0 to count - 1 of a side of the filter, four
+// lanes at a time. Gives the same sums as lsrac__accumulate() on every product. Not for
+// serial mode.
+static inline void lsrac__accumulate_run(
+        lsrac__accumulator_t * acc,
+        uint32_t               accumulation,
+        const float *          taps,
+        const float *          src,
+        int64_t                direction,
+        int64_t                count)
+{
+    int64_t k = 0;
+
+#if defined(LSRAC__SSE)
+    int64_t vector_end = count & ~static_cast<int64_t>(3);
+
+    __m128 sum = _mm_loadu_ps(acc->sum);
+    __m128 compensation = _mm_loadu_ps(acc->compensation);
+
+    for (; k < vector_end; k += 4) {
+        __m128 s;
+        if (direction > 0) {
+            s = _mm_loadu_ps(src + k);
+        } else {
+            s = _mm_loadu_ps(src - k - 3);
+            s = _mm_shuffle_ps(s, s, _MM_SHUFFLE(0, 1, 2, 3));
+        }
+        __m128 x = _mm_mul_ps(_mm_loadu_ps(taps + k), s);
+
+        if (accumulation == LSRAC_ACCUMULATE_KAHAN) {
+            __m128 y = _mm_sub_ps(x, compensation);
+            __m128 t = _mm_add_ps(sum, y);
+            compensation = _mm_sub_ps(_mm_sub_ps(t, sum), y);
+            sum = t;
+        } else {
+            sum = _mm_add_ps(sum, x);
+        }
+    }
+
+    _mm_storeu_ps(acc->sum, sum);
+    _mm_storeu_ps(acc->compensation, compensation);
+#elif defined(LSRAC__NEON)
+    int64_t vector_end = count & ~static_cast<int64_t>(3);
+
+    float32x4_t sum = vld1q_f32(acc->sum);
+    float32x4_t compensation = vld1q_f32(acc->compensation);
+
+    for (; k < vector_end; k += 4) {
+        float32x4_t s;
+        if (direction > 0) {
+            s = vld1q_f32(src + k);
+        } else {
+            s = vrev64q_f32(vld1q_f32(src - k - 3));
+            s = vcombine_f32(vget_high_f32(s), vget_low_f32(s));
+        }
+        float32x4_t x = vmulq_f32(vld1q_f32(taps + k), s);
+
+        if (accumulation == LSRAC_ACCUMULATE_KAHAN) {
+            float32x4_t y = vsubq_f32(x, compensation);
+            float32x4_t t = vaddq_f32(sum, y);
+            compensation = vsubq_f32(vsubq_f32(t, sum), y);
+            sum = t;
+        } else {
+            sum = vaddq_f32(sum, x);
+        }
+    }
+
+    vst1q_f32(acc->sum, sum);
+    vst1q_f32(acc->compensation, compensation);
+#endif
+
+    for (; k < count; ++k) {
+        lsrac__accumulate(acc, accumulation, k, taps[k] * src[direction * k]);
+    }
+}
+
+// Sum of the left_taps taps of the left side and then the right_taps taps of the right
+// side, added up the way the plan's filter adds up its products.
+static float lsrac__taps_sum(uint32_t accumulation, const float * taps, int64_t left_taps, int64_t right_taps)
+{
+    if (accumulation == LSRAC_ACCUMULATE_SERIAL) {
+        float normalization_value = 0.0f;
+        for (int64_t k = 0; k < left_taps + right_taps; ++k) {
+            normalization_value += taps[k];
+        }
+        return normalization_value;
+    }
+
+    lsrac__accumulator_t normalization;
+    lsrac__accumulator_clear(&normalization);
+
+    for (int64_t k = 0; k < left_taps; ++k) {
+        lsrac__accumulate(&normalization, accumulation, k, taps[k]);
+    }
+    for (int64_t k = 0; k < right_taps; ++k) {
+        lsrac__accumulate(&normalization, accumulation, k, taps[left_taps + k]);
+    }
+
+    return lsrac__accumulator_total(&normalization, accumulation);
+}
+
+// Writes the left_taps taps of the left side of the filter, starting at left_fx, and then
+// the right_taps taps of the right side to taps. Returns their sum, added up in the same
+// order as lsrac__filter_sample() does.
+static float lsrac__compute_taps(const lsrac_plan_t * plan, uint64_t left_fx, float * taps, int64_t left_taps, int64_t right_taps)
+{
+    uint64_t right_fx = plan->filter_step_fx - left_fx;
+
+    for (int64_t k = 0; k < left_taps; ++k) {
+        taps[k] = lsrac__filter_tap(plan->coefficients, left_fx + static_cast<uint64_t>(k) * plan->filter_step_fx);
+    }
+    for (int64_t k = 0; k < right_taps; ++k) {
+        taps[left_taps + k] = lsrac__filter_tap(plan->coefficients, right_fx + static_cast<uint64_t>(k) * plan->filter_step_fx);
+    }
+
+    return lsrac__taps_sum(plan->accumulation, taps, left_taps, right_taps);
+}
+
+// Adds up left[k] * src[-k] and right[k] * src[k + 1], the products of precomputed taps.
+static inline float lsrac__apply_taps(
+        uint32_t       accumulation,
+        const float *  left,
+        int64_t        left_taps,
+        const float *  right,
+        int64_t        right_taps,
+        const float *  src)
+{
+    if (accumulation == LSRAC_ACCUMULATE_SERIAL) {
+        float value = 0.0f;
+        for (int64_t k = 0; k < left_taps; ++k) {
+            value += left[k] * src[-k];
+        }
+        for (int64_t k = 0; k < right_taps; ++k) {
+            value += right[k] * src[k + 1];
+        }
+        return value;
+    }
+
+    lsrac__accumulator_t value;
+    lsrac__accumulator_clear(&value);
+
+    lsrac__accumulate_run(&value, accumulation, left, src, -1, left_taps);
+    lsrac__accumulate_run(&value, accumulation, right, src + 1, 1, right_taps);
+
+    return lsrac__accumulator_total(&value, accumulation);
+}
+
+// Taps of both sides of the filter, for the statistics.
+static inline int64_t lsrac__frame_taps(const lsrac_plan_t * plan, uint64_t left_fx)
+{
+    return lsrac__taps_in_filter(plan, left_fx) + lsrac__taps_in_filter(plan, plan->filter_step_fx - left_fx);
+}
+
+// Filters one channel around source frame pos_int (at src[0]) with a fractional offset of
+// left_fx filter positions. Source frames outside [first_valid, end_valid) are skipped and
+// the result is normalized by the coefficients actually used.
+static float lsrac__filter_sample(
+        const lsrac_plan_t * plan,
+        const float *        src,
+        int64_t              pos_int,
+        uint64_t             left_fx,
+        int64_t              first_valid,
+        int64_t              end_valid)
+{
+    const float * coefficients = plan->coefficients;
+    uint64_t right_fx = plan->filter_step_fx - left_fx;
+
+    // Left part of sinc filter, taps [left_first, left_end). The last output frames of a
+    // flushed stream can lie past the last source frame, their taps start at the first
+    // frame that is there.
+    int64_t left_end = lsrac__taps_in_filter(plan, left_fx);
+    if (left_end > pos_int - first_valid + 1) {
+        left_end = pos_int - first_valid + 1;
+    }
+
+    int64_t left_first = pos_int >= end_valid ? pos_int - end_valid + 1 : 0;
+
+    // Right part of sinc filter, taps [0, right_end)
+    int64_t right_end = lsrac__taps_in_filter(plan, right_fx);
+    if (right_end > end_valid - pos_int - 1) {
+        right_end = end_valid - pos_int - 1;
+    }
+
+    float value = 0.0f;
+    float normalization_value = 0.0f;
+
+    if (plan->accumulation == LSRAC_ACCUMULATE_SERIAL) {
+        uint64_t pos_fx = left_fx + static_cast<uint64_t>(left_first) * plan->filter_step_fx;
+        for (int64_t k = left_first; k < left_end; ++k) {
+            float c = lsrac__filter_tap(coefficients, pos_fx);
+            value += c * src[-k];
+            normalization_value += c;
+            pos_fx += plan->filter_step_fx;
+        }
+
+        pos_fx = right_fx;
+        for (int64_t k = 0; k < right_end; ++k) {
+            float c = lsrac__filter_tap(coefficients, pos_fx);
+            value += c * src[k + 1];
+            normalization_value += c;
+            pos_fx += plan->filter_step_fx;
+        }
+    } else {
+        lsrac__accumulator_t value_sums;
+        lsrac__accumulator_t normalization_sums;
+        lsrac__accumulator_clear(&value_sums);
+        lsrac__accumulator_clear(&normalization_sums);
+
+        uint64_t pos_fx = left_fx + static_cast<uint64_t>(left_first) * plan->filter_step_fx;
+        for (int64_t k = left_first; k < left_end; ++k) {
+            float c = lsrac__filter_tap(coefficients, pos_fx);
+            lsrac__accumulate(&value_sums, plan->accumulation, k, c * src[-k]);
+            lsrac__accumulate(&normalization_sums, plan->accumulation, k, c);
+            pos_fx += plan->filter_step_fx;
+        }
+
+        pos_fx = right_fx;
+        for (int64_t k = 0; k < right_end; ++k) {
+            float c = lsrac__filter_tap(coefficients, pos_fx);
+            lsrac__accumulate(&value_sums, plan->accumulation, k, c * src[k + 1]);
+            lsrac__accumulate(&normalization_sums, plan->accumulation, k, c);
+            pos_fx += plan->filter_step_fx;
+        }
+
+        value = lsrac__accumulator_total(&value_sums, plan->accumulation);
+        normalization_value = lsrac__accumulator_total(&normalization_sums, plan->accumulation);
+    }
+
+    if (normalization_value == 0.0f) {
+        return 0.0f;
+    }
+
+    return value / normalization_value;
+}
+
+// lsrac__filter_sample() with the taps and their sum read from the plan's phase table,
+// for output frames whose filter lies entirely inside the source. Gives bit identical
+// results.
+static float lsrac__filter_sample_phase(
+        const lsrac_plan_t * plan,
+        uint32_t             phase,
+        const float *        src)
+{
+    const lsrac_phase_t * entry = plan->phases + phase;
+    const float * left = plan->phase_taps + static_cast<size_t>(phase) * plan->phase_stride;
+    const float * right = left + entry->left_taps;
+
+    float value = lsrac__apply_taps(plan->accumulation, left, entry->left_taps, right, entry->right_taps, src);
+
+    return value / entry->normalization;
+}
+
+// lsrac__filter_sample_phase() for all dst_rate phases of an integer factor period, whose
+// source frame m is at src[0], into out[j * out_stride]. Each lane steps through the taps
+// of its phase in the same order, so the results are bit identical.
+static void lsrac__filter_period(const lsrac_plan_t * plan, const float * src, float * out, size_t out_stride)
+{
+    uint32_t lanes = plan->period_lanes;
+    uint32_t shifted = plan->dst_rate / 2;
+
+    const float * normalization = plan->period_taps + static_cast<size_t>(plan->period_left + plan->period_right) * lanes;
+
+    float values[LSRAC__PERIOD_MAX_FACTOR];
+
+#if defined(LSRAC__SSE) || defined(LSRAC__NEON)
+    for (uint32_t block = 0; block < lanes; block += 4) {
+        const float * row = plan->period_taps + block;
+
+#if defined(LSRAC__SSE)
+        // Lanes centered on m - 1 read one frame further left
+        __m128i lane = _mm_add_epi32(_mm_set1_epi32(static_cast<int32_t>(block)), _mm_set_epi32(3, 2, 1, 0));
+        __m128 shift = _mm_castsi128_ps(_mm_cmplt_epi32(lane, _mm_set1_epi32(static_cast<int32_t>(shifted))));
+
+        __m128 value = _mm_setzero_ps();
+        for (uint32_t k = 0; k < plan->period_left; ++k, row += lanes) {
+            __m128 s = _mm_or_ps(_mm_and_ps(shift, _mm_set1_ps(src[-static_cast<int64_t>(k) - 1])),
+                                 _mm_andnot_ps(shift, _mm_set1_ps(src[-static_cast<int64_t>(k)])));
+            value = _mm_add_ps(value, _mm_mul_ps(_mm_loadu_ps(row), s));
+        }
+        for (uint32_t k = 0; k < plan->period_right; ++k, row += lanes) {
+            __m128 s = _mm_or_ps(_mm_and_ps(shift, _mm_set1_ps(src[k])),
+                                 _mm_andnot_ps(shift, _mm_set1_ps(src[k + 1])));
+            value = _mm_add_ps(value, _mm_mul_ps(_mm_loadu_ps(row), s));
+        }
+        _mm_storeu_ps(values + block, _mm_div_ps(value, _mm_loadu_ps(normalization + block)));
+#elif defined(LSRAC__NEON)
+        static const uint32_t lane_offsets[4] = { 0, 1, 2, 3 };
+        uint32x4_t lane = vaddq_u32(vdupq_n_u32(block), vld1q_u32(lane_offsets));
+        uint32x4_t shift = vcltq_u32(lane, vdupq_n_u32(shifted));
+
+        float32x4_t value = vdupq_n_f32(0.0f);
+        for (uint32_t k = 0; k < plan->period_left; ++k, row += lanes) {
+            float32x4_t s = vbslq_f32(shift, vdupq_n_f32(src[-static_cast<int64_t>(k) - 1]), vdupq_n_f32(src[-static_cast<int64_t>(k)]));
+            value = vaddq_f32(value, vmulq_f32(vld1q_f32(row), s));
+        }
+        for (uint32_t k = 0; k < plan->period_right; ++k, row += lanes) {
+            float32x4_t s = vbslq_f32(shift, vdupq_n_f32(src[k]), vdupq_n_f32(src[k + 1]));
+            value = vaddq_f32(value, vmulq_f32(vld1q_f32(row), s));
+        }
+        vst1q_f32(values + block, vdivq_f32(value, vld1q_f32(normalization + block)));
+#endif
+    }
+#else
+    // Two lanes at a time, each with its own running sum
+    for (uint32_t block = 0; block < plan->dst_rate; block += 2) {
+        const float * row = plan->period_taps + block;
+
+        // Lanes centered on m - 1 read one frame further left
+        const float * center0 = block < shifted ? src - 1 : src;
+        const float * center1 = block + 1 < shifted ? src - 1 : src;
+
+        float value0 = 0.0f;
+        float value1 = 0.0f;
+        for (uint32_t k = 0; k < plan->period_left; ++k, row += lanes) {
+            value0 += row[0] * center0[-static_cast<int64_t>(k)];
+            value1 += row[1] * center1[-static_cast<int64_t>(k)];
+        }
+        for (uint32_t k = 0; k < plan->period_right; ++k, row += lanes) {
+            value0 += row[0] * center0[k + 1];
+            value1 += row[1] * center1[k + 1];
+        }
+        values[block] = value0 / normalization[block];
+        values[block + 1] = value1 / normalization[block + 1];
+    }
+#endif
+
+    for (uint32_t j = 0; j < plan->dst_rate; ++j) {
+        out[j * out_stride] = values[j];
+    }
+}
+
+// lsrac__filter_sample() for output frames whose filter reaches past [first_valid,
+// end_valid), with the missing source frames supplied by the plan's edge policy.
+static float lsrac__filter_sample_edge(
+        const lsrac_plan_t * plan,
+        const float *        src,
+        int64_t              pos_int,
+        uint64_t             left_fx,
+        int64_t              first_valid,
+        int64_t              end_valid)
+{
+    if (plan->edge == LSRAC_EDGE_RENORMALIZE) {
+        return lsrac__filter_sample(plan, src, pos_int, left_fx, first_valid, end_valid);
+    }
+
+    const float * coefficients = plan->coefficients;
+
+    lsrac__accumulator_t value;
+    lsrac__accumulator_t normalization;
+    lsrac__accumulator_clear(&value);
+    lsrac__accumulator_clear(&normalization);
+
+    for (int32_t side = 0; side < 2; ++side) {
+        // Left part (going back from pos_int), then right part (going on from pos_int + 1)
+        uint64_t start_fx = side == 0 ? left_fx : plan->filter_step_fx - left_fx;
+        int64_t taps = lsrac__taps_in_filter(plan, start_fx);
+
+        uint64_t pos_fx = start_fx;
+        for (int64_t k = 0; k < taps; ++k) {
+            float c = lsrac__filter_tap(coefficients, pos_fx);
+            int64_t index = side == 0 ? pos_int - k : pos_int + 1 + k;
+            if (index >= first_valid && index < end_valid) {
+                lsrac__accumulate(&value, plan->accumulation, k, c * src[index - pos_int]);
+            } else if (lsrac__edge_index(&index, first_valid, end_valid, plan->edge)) {
+                lsrac__accumulate(&value, plan->accumulation, k, c * src[index - pos_int]);
+            }
+            lsrac__accumulate(&normalization, plan->accumulation, k, c);
+            pos_fx += plan->filter_step_fx;
+        }
+    }
+
+    return lsrac__accumulator_total(&value, plan->accumulation) / lsrac__accumulator_total(&normalization, plan->accumulation);
+}
+
+
+/*
+ *  Plans
+ */
+
+static uint32_t lsrac__gcd(uint32_t a, uint32_t b)
+{
+    while (b != 0) {
+        uint32_t t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+static int64_t lsrac__floor_div(int64_t a, int64_t b)
+{
+    int64_t q = a / b;
+    if ((a % b != 0) && ((a < 0) != (b < 0))) {
+        q -= 1;
+    }
+    return q;
+}
+
+// Output frame n is centered on source position (n + 0.5) * src_rate / dst_rate - 0.5,
+// kept exact as an integer part and a numerator over 2 * dst_rate.
+static void lsrac__src_position(const lsrac_plan_t * plan, uint64_t dst_frame, int64_t * pos_int, uint64_t * pos_frac)
+{
+    int64_t numerator = static_cast<int64_t>(2 * dst_frame + 1) * plan->src_rate - static_cast<int64_t>(plan->dst_rate);
+    int64_t denominator = 2 * static_cast<int64_t>(plan->dst_rate);
+
+    *pos_int  = lsrac__floor_div(numerator, denominator);
+    *pos_frac = static_cast<uint64_t>(numerator - *pos_int * denominator);
+}
+
+// Streams filter tiles of tile_frames output frames, tile_channels channels at a time. The
+// source frames one group of channels reads for a tile should fit in LSRAC_TILE_CACHE_BYTES,
+// so that consecutive output frames find their (overlapping) filter windows in cache.
+static void lsrac__plan_choose_tiles(lsrac_plan_t * plan)
+{
+    uint64_t budget = LSRAC_TILE_CACHE_BYTES / sizeof(float);
+    uint64_t filter_frames = 2 * static_cast<uint64_t>(plan->half_width) + 1;
+    uint64_t step = (plan->src_rate + plan->dst_rate - 1) / plan->dst_rate;
+
+    uint64_t frames = LSRAC__TILE_MAX_FRAMES;
+    while (frames > 1 && frames * step + filter_frames > budget) {
+        frames /= 2;
+    }
+
+    uint64_t channels = budget / (frames * step + filter_frames);
+
+    // Whole periods of an integer factor, which streams filter in one go
+    if (plan->src_rate == 1 && frames >= plan->dst_rate) {
+        frames -= frames % plan->dst_rate;
+    }
+
+    plan->tile_frames   = static_cast<uint32_t>(frames);
+    plan->tile_channels = static_cast<uint32_t>(channels < 1 ? 1 : channels > LSRAC_MAX_CHANNELS ? LSRAC_MAX_CHANNELS : channels);
+}
+
+static void lsrac__plan_set_filter_length(lsrac_plan_t * plan)
+{
+    plan->filter_limit_fx = static_cast<uint64_t>(plan->coefficient_count - 1) << LSRAC__FX_BITS;
+    plan->half_width      = static_cast<int32_t>(plan->filter_limit_fx / plan->filter_step_fx) + 2;
+
+    lsrac__plan_choose_tiles(plan);
+}
+
+// Multiply-adds per dst_rate output frames: mixing first costs a mix of every source
+// frame and filters dst_channels channels, filtering first filters every source channel
+// and mixes every output frame.
+static void lsrac__plan_choose_mix_order(lsrac_plan_t * plan)
+{
+    if (plan->mix == nullptr) {
+        plan->mix_first = 0;
+        return;
+    }
+
+    uint64_t gain_count   = static_cast<uint64_t>(plan->dst_channels) * plan->channels;
+    uint64_t taps         = 2 * static_cast<uint64_t>(plan->half_width);
+    uint64_t mix_first    = gain_count * plan->src_rate + taps * plan->dst_channels * plan->dst_rate;
+    uint64_t filter_first = taps * plan->channels * plan->dst_rate + gain_count * plan->dst_rate;
+
+    plan->mix_first = mix_first < filter_first;
+}
+
+// Upsampling by an integer factor L, one source frame m makes a period of L output frames:
+// phase j is centered on m - 1 for j < L / 2 and on m for the rest. The period table holds
+// the phase table transposed, tap k of every phase side by side, so that all L phases are
+// filtered at once (see lsrac__filter_period()). Each lane keeps one running sum, which is
+// the serial accumulation order; pairwise and Kahan plans spread one phase over several
+// sums and keep filtering frame by frame.
+static void lsrac__plan_build_period(lsrac_plan_t * plan)
+{
+    if (plan->phases == nullptr ||
+        plan->src_rate != 1 ||
+        plan->dst_rate < 2 ||
+        plan->dst_rate > LSRAC__PERIOD_MAX_FACTOR ||
+        plan->accumulation != LSRAC_ACCUMULATE_SERIAL) {
+        return;
+    }
+
+    uint32_t lanes = (plan->dst_rate + 3) & ~3u;
+    uint32_t left = 0;
+    uint32_t right = 0;
+    for (uint32_t j = 0; j < plan->dst_rate; ++j) {
+        left = plan->phases[j].left_taps > left ? plan->phases[j].left_taps : left;
+        right = plan->phases[j].right_taps > right ? plan->phases[j].right_taps : right;
+    }
+
+    size_t count = static_cast<size_t>(lanes) * (left + right + 1);
+    float * taps = static_cast<float *>(lsrac__alloc(&plan->allocator, sizeof(float) * count));
+    if (taps == nullptr) {
+        return;
+    }
+
+    // Phases run out of taps at different k, the rest of their column is zero. Adding a
+    // zero product leaves their sums as they are.
+    memset(taps, 0, sizeof(float) * count);
+
+    for (uint32_t j = 0; j < lanes; ++j) {
+        float * normalization = taps + static_cast<size_t>(left + right) * lanes + j;
+        if (j >= plan->dst_rate) {
+            *normalization = 1.0f;
+            continue;
+        }
+
+        const lsrac_phase_t * entry = plan->phases + j;
+        const float * phase_taps = plan->phase_taps + static_cast<size_t>(j) * plan->phase_stride;
+
+        for (uint32_t k = 0; k < entry->left_taps; ++k) {
+            taps[static_cast<size_t>(k) * lanes + j] = phase_taps[k];
+        }
+        for (uint32_t k = 0; k < entry->right_taps; ++k) {
+            taps[static_cast<size_t>(left + k) * lanes + j] = phase_taps[entry->left_taps + k];
+        }
+        *normalization = entry->normalization;
+    }
+
+    plan->period_taps  = taps;
+    plan->period_lanes = lanes;
+    plan->period_left  = left;
+    plan->period_right = right;
+}
+
+// Fills the phase table, one entry and one row of taps per output frame of the period.
+// Plans with a period too long for LSRAC_PHASE_TABLE_MAX_TAPS, or that cannot allocate
+// the table, compute the phase of every output frame instead.
+static void lsrac__plan_build_phases(lsrac_plan_t * plan)
+{
+    lsrac__free(&plan->allocator, plan->phases);
+    lsrac__free(&plan->allocator, plan->phase_taps);
+    lsrac__free(&plan->allocator, plan->period_taps);
+
+    plan->phases       = nullptr;
+    plan->phase_taps   = nullptr;
+    plan->period_taps  = nullptr;
+    plan->phase_stride = 2 * static_cast<uint32_t>(plan->half_width);
+
+    uint64_t tap_count = static_cast<uint64_t>(plan->dst_rate) * plan->phase_stride;
+    if (tap_count > LSRAC_PHASE_TABLE_MAX_TAPS) {
+        return;
+    }
+
+    plan->phases     = static_cast<lsrac_phase_t *>(lsrac__alloc(&plan->allocator, sizeof(lsrac_phase_t) * plan->dst_rate));
+    plan->phase_taps = static_cast<float *>(lsrac__alloc(&plan->allocator, sizeof(float) * static_cast<size_t>(tap_count)));
+
+    if (plan->phases == nullptr || plan->phase_taps == nullptr) {
+        lsrac__free(&plan->allocator, plan->phases);
+        lsrac__free(&plan->allocator, plan->phase_taps);
+        plan->phases     = nullptr;
+        plan->phase_taps = nullptr;
+        return;
+    }
+
+    uint64_t two_dst = 2 * static_cast<uint64_t>(plan->dst_rate);
+
+    int64_t pos_int;
+    uint64_t pos_frac;
+    lsrac__src_position(plan, 0, &pos_int, &pos_frac);
+
+    for (uint32_t n = 0; n < plan->dst_rate; ++n) {
+        lsrac_phase_t * entry = plan->phases + n;
+        float * taps = plan->phase_taps + static_cast<size_t>(n) * plan->phase_stride;
+
+        uint64_t left_fx = (pos_frac * plan->filter_step_fx) / two_dst;
+        uint64_t right_fx = plan->filter_step_fx - left_fx;
+
+        entry->left_fx       = static_cast<uint32_t>(left_fx);
+        entry->left_taps     = static_cast<uint32_t>(lsrac__taps_in_filter(plan, left_fx));
+        entry->right_taps    = static_cast<uint32_t>(lsrac__taps_in_filter(plan, right_fx));
+        entry->normalization = lsrac__compute_taps(plan, left_fx, taps, entry->left_taps, entry->right_taps);
+
+        int64_t next_int;
+        lsrac__src_position(plan, n + 1, &next_int, &pos_frac);
+        entry->advance = static_cast<uint32_t>(next_int - pos_int);
+        pos_int = next_int;
+    }
+
+    lsrac__plan_build_period(plan);
+}
+
+int32_t lsrac_plan_init(
+        lsrac_plan_t *             plan,
+        uint32_t                   src_rate,
+        uint32_t                   dst_rate,
+        uint32_t                   channels,
+        const lsrac_allocator_t *  allocator)
+{
+    if (plan == nullptr ||
+        src_rate == 0 ||
+        dst_rate == 0 ||
+        channels == 0 ||
+        channels > LSRAC_MAX_CHANNELS) {
+        return LSRAC_RET_VAL_ARGUMENT_ERROR;
+    }
+
+    LSRAC__STATS_START(setup_start);
+
+    memset(plan, 0, sizeof(*plan));
+
+    uint32_t gcd = lsrac__gcd(src_rate, dst_rate);
+
+    plan->src_rate          = src_rate / gcd;
+    plan->dst_rate          = dst_rate / gcd;
+    plan->channels          = channels;
+    plan->dst_channels      = channels;
+    plan->coefficients      = lsrac_filter.coefficients;
+    plan->coefficient_count = static_cast<uint32_t>(ARRAY_COUNT(lsrac_filter.coefficients));
+    plan->allocator         = lsrac__resolve_allocator(allocator);
+
+    // When downsampling the filter is stretched so that its zero crossings fall on the
+    // destination sample spacing.
+    double filter_scale = plan->dst_rate < plan->src_rate ? static_cast<double>(plan->dst_rate) / static_cast<double>(plan->src_rate) : 1.0;
+
+    plan->filter_step_fx  = static_cast<uint64_t>(static_cast<double>(lsrac_filter.increment) * filter_scale * static_cast<double>(LSRAC__FX_ONE) + 0.5);
+
+    if (plan->filter_step_fx == 0) {
+        return LSRAC_RET_VAL_ARGUMENT_ERROR;
+    }
+
+    lsrac__plan_set_filter_length(plan);
+    lsrac__plan_build_phases(plan);
+
+    LSRAC__STATS_SINCE(setup_ticks, setup_start);
+
+    return LSRAC_RET_VAL_OK;
+}
+
+void lsrac_plan_uninit(lsrac_plan_t * plan)
+{
+    if (plan == nullptr) {
+        return;
+    }
+
+    lsrac__free(&plan->allocator, plan->mix);
+    lsrac__free(&plan->allocator, plan->phases);
+    lsrac__free(&plan->allocator, plan->phase_taps);
+    lsrac__free(&plan->allocator, plan->period_taps);
+    lsrac__free(&plan->allocator, plan->phase_taps_f64);
+
+    // Shortened filters are owned by the plan
+    if (plan->coefficients != lsrac_filter.coefficients) {
+        lsrac__free(&plan->allocator, const_cast<float *>(plan->coefficients));
+    }
+    if (plan->coefficients_f64 != lsrac_filter_f64.coefficients) {
+        lsrac__free(&plan->allocator, const_cast<double *>(plan->coefficients_f64));
+    }
+
+    memset(plan, 0, sizeof(*plan));
+}
+
+int32_t lsrac_plan_set_mix(lsrac_plan_t * plan, uint32_t dst_channels, const float * gains)
+{
+    if (plan == nullptr ||
+        plan->channels == 0 ||
+        dst_channels == 0 ||
+        dst_channels > LSRAC_MAX_CHANNELS ||
+        (gains == nullptr && dst_channels != plan->channels)) {
+        return LSRAC_RET_VAL_ARGUMENT_ERROR;
+    }
+
+    lsrac__free(&plan->allocator, plan->mix);
+
+    plan->mix          = nullptr;
+    plan->mix_first    = 0;
+    plan->dst_channels = dst_channels;
+
+    if (gains == nullptr) {
+        return LSRAC_RET_VAL_OK;
+    }
+
+    size_t gain_count = static_cast<size_t>(dst_channels) * plan->channels;
+
+    plan->mix = static_cast<float *>(lsrac__alloc(&plan->allocator, sizeof(float) * gain_count));
+    if (plan->mix == nullptr) {
+        plan->dst_channels = plan->channels;
+        return LSRAC_RET_VAL_OUT_OF_MEMORY;
+    }
+
+    memcpy(plan->mix, gains, sizeof(float) * gain_count);
+
+    lsrac__plan_choose_mix_order(plan);
+
+    return LSRAC_RET_VAL_OK;
+}
+
+// Gain of coefficient i of a filter shortened to count coefficients: a raised cosine over
+// the last quarter, so the cut off filter ends at zero.
+static double lsrac__taper_gain(uint32_t i, uint32_t count)
+{
+    uint32_t taper_start = count - count / 4;
+    if (i < taper_start) {
+        return 1.0;
+    }
+
+    double t = static_cast<double>(i - taper_start) / static_cast<double>(count - 1 - taper_start);
+    return 0.5 + 0.5 * cos(3.14159265358979323846 * t);
+}
+
+// Coefficient i of the preview filter, a Lanczos kernel sampled lsrac_filter.increment
+// times per zero crossing like the sinc filter.
+static double lsrac__lanczos(uint32_t i)
+{
+    if (i == 0) {
+        return 1.0;
+    }
+
+    double x = 3.14159265358979323846 * static_cast<double>(i) / static_cast<double>(lsrac_filter.increment);
+    return LSRAC__PREVIEW_LOBES * sin(x) * sin(x / LSRAC__PREVIEW_LOBES) / (x * x);
+}
+
+// Length of the filter of a quality preset, in coefficients.
+static uint32_t lsrac__quality_coefficient_count(uint32_t quality)
+{
+    if (quality == LSRAC_QUALITY_PREVIEW) {
+        return LSRAC__PREVIEW_LOBES * static_cast<uint32_t>(lsrac_filter.increment) + 1;
+    }
+    return (static_cast<uint32_t>(ARRAY_COUNT(lsrac_filter.coefficients) - 1) >> quality) + 1;
+}
+
+int32_t lsrac_plan_set_quality(lsrac_plan_t * plan, uint32_t quality)
+{
+    if (plan == nullptr ||
+        plan->coefficients == nullptr ||
+        quality > LSRAC_QUALITY_PREVIEW) {
+        return LSRAC_RET_VAL_ARGUMENT_ERROR;
+    }
+
+    LSRAC__STATS_START(setup_start);
+
+    uint32_t count = lsrac__quality_coefficient_count(quality);
+
+    float * coefficients = nullptr;
+
+    if (quality != LSRAC_QUALITY_BEST) {
+        coefficients = static_cast<float *>(lsrac__alloc(&plan->allocator, sizeof(float) * count));
+        if (coefficients == nullptr) {
+            return LSRAC_RET_VAL_OUT_OF_MEMORY;
+        }
+
+        for (uint32_t i = 0; i < count; ++i) {
+            coefficients[i] = quality == LSRAC_QUALITY_PREVIEW ? static_cast<float>(lsrac__lanczos(i)) :
+                              lsrac_filter.coefficients[i] * static_cast<float>(lsrac__taper_gain(i, count));
+        }
+    }
+
+    if (plan->coefficients != lsrac_filter.coefficients) {
+        lsrac__free(&plan->allocator, const_cast<float *>(plan->coefficients));
+    }
+
+    plan->quality           = quality;
+    plan->coefficients      = coefficients != nullptr ? coefficients : lsrac_filter.coefficients;
+    plan->coefficient_count = count;
+
+    lsrac__plan_set_filter_length(plan);
+    lsrac__plan_build_phases(plan);
+    lsrac__plan_choose_mix_order(plan);
+
+    int32_t result = LSRAC_RET_VAL_OK;
+    if (plan->coefficients_f64 != nullptr) {
+        result = lsrac_plan_prepare_f64(plan);
+    }
+
+    LSRAC__STATS_SINCE(setup_ticks, setup_start);
+
+    return result;
+}
+
+int32_t lsrac_plan_set_edge(lsrac_plan_t * plan, uint32_t edge)
+{
+    if (plan == nullptr ||
+        edge > LSRAC_EDGE_CLAMP) {
+        return LSRAC_RET_VAL_ARGUMENT_ERROR;
+    }
+
+    plan->edge = edge;
+
+    return LSRAC_RET_VAL_OK;
+}
+
+int32_t lsrac_plan_set_accumulation(lsrac_plan_t * plan, uint32_t accumulation)
+{
+    if (plan == nullptr ||
+        plan->coefficients == nullptr ||
+        accumulation > LSRAC_ACCUMULATE_KAHAN) {
+        return LSRAC_RET_VAL_ARGUMENT_ERROR;
+    }
+
+    LSRAC__STATS_START(setup_start);
+
+    plan->accumulation = accumulation;
+
+    // The normalizations in the phase table are added up the same way
+    lsrac__plan_build_phases(plan);
+
+    LSRAC__STATS_SINCE(setup_ticks, setup_start);
+
+    return LSRAC_RET_VAL_OK;
+}
+
+
+/*
+ *  Output stage
+ */
+
+static size_t lsrac__format_bytes(uint32_t format)
+{
+    switch (format) {
+        case LSRAC_FORMAT_S16: return 2;
+        case LSRAC_FORMAT_S24: return 3;
+        default:               return 4;
+    }
+}
+
+void lsrac_output_stage_init(lsrac_output_stage_t * stage, float gain, uint32_t flags)
+{
+    memset(stage, 0, sizeof(*stage));
+
+    stage->gain   = gain;
+    stage->flags  = flags;
+    stage->random = 0x9e3779b9u;
+}
+
+// Uniform noise in [0, 1) from a xorshift generator.
+static inline float lsrac__output_random(lsrac_output_stage_t * stage)
+{
+    uint32_t x = stage->random;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    stage->random = x;
+
+    return static_cast<float>(x >> 8) * (1.0f / 16777216.0f);
+}
+
+// Applies the stage to one sample of channel and writes it as sample index of dst.
+static inline void lsrac__output_store(
+        lsrac_output_stage_t * stage,
+        uint32_t               format,
+        void *                 dst,
+        uint64_t               index,
+        uint32_t               channel,
+        float                  value)
+{
+    value *= stage->gain;
+
+    if (format == LSRAC_FORMAT_F32) {
+        static_cast<float *>(dst)[index] = value;
+        return;
+    }
+
+    // Largest magnitude representable in the format (and as a float)
+    float limit = format == LSRAC_FORMAT_S16 ? 32767.0f :
+                  format == LSRAC_FORMAT_S24 ? 8388607.0f :
+                                               2147483520.0f;
+
+    float wanted = value * (format == LSRAC_FORMAT_S32 ? 2147483647.0f : limit);
+    float * error = stage->error[channel];
+
+    if (stage->flags & LSRAC_OUTPUT_NOISE_SHAPING) {
+        // Total error becomes e[n] - 2 e[n-1] + e[n-2], a second order high pass
+        wanted -= 2.0f * error[0] - error[1];
+    }
+
+    float dithered = wanted;
+    if (stage->flags & LSRAC_OUTPUT_DITHER) {
+        dithered += lsrac__output_random(stage) - lsrac__output_random(stage);
+    }
+
+    float rounded = floorf(dithered + 0.5f);
+    float clipped = clamp(rounded, limit);
+
+    // Feeding clipping errors back would make the shaping filter ring, so they are dropped
+    error[1] = error[0];
+    error[0] = clipped == rounded ? clipped - wanted : 0.0f;
+
+    switch (format) {
+        case LSRAC_FORMAT_S16: {
+            static_cast<int16_t *>(dst)[index] = static_cast<int16_t>(clipped);
+        } break;
+        case LSRAC_FORMAT_S24: {
+            int32_t sample = static_cast<int32_t>(clipped);
+            uint8_t * bytes = static_cast<uint8_t *>(dst) + 3 * index;
+            bytes[0] = static_cast<uint8_t>(sample);
+            bytes[1] = static_cast<uint8_t>(sample >> 8);
+            bytes[2] = static_cast<uint8_t>(sample >> 16);
+        } break;
+        default: {
+            static_cast<int32_t *>(dst)[index] = static_cast<int32_t>(clipped);
+        } break;
+    }
+}
+
+int32_t lsrac_output_stage_process(
+        lsrac_output_stage_t * stage,
+        void *                 dst,
+        uint32_t               format,
+        const float *          src,
+        uint64_t               frames,
+        uint32_t               channels)
+{
+    if (stage == nullptr ||
+        channels == 0 ||
+        channels > LSRAC_MAX_CHANNELS ||
+        format > LSRAC_FORMAT_S32 ||
+        (frames != 0 && (dst == nullptr || src == nullptr))) {
+        return LSRAC_RET_VAL_ARGUMENT_ERROR;
+    }
+
+    LSRAC__STATS_START(output_start);
+
+    for (uint64_t i = 0; i < frames; ++i) {
+        for (uint32_t c = 0; c < channels; ++c) {
+            lsrac__output_store(stage, format, dst, i * channels + c, c, src[i * channels + c]);
+        }
+    }
+
+    LSRAC__STATS_SINCE(output_ticks, output_start);
+
+    return LSRAC_RET_VAL_OK;
+}
+
+
+/*
+ *  Streams
+ */
+
+// Channels kept in stream history: the mixed channels when mixing comes first.
+static uint32_t lsrac__history_channels(const lsrac_plan_t * plan)
+{
+    return plan->mix_first ? plan->dst_channels : plan->channels;
+}
+
+static uint32_t lsrac__stream_history_capacity(const lsrac_plan_t * plan)
+{
+    return static_cast<uint32_t>(2 * plan->half_width + 2 + LSRAC_STREAM_BLOCK_FRAMES);
+}
+
+size_t lsrac_stream_workspace_size(const lsrac_plan_t * plan)
+{
+    if (plan == nullptr) {
+        return 0;
+    }
+
+    return lsrac__workspace_bytes(sizeof(float) * lsrac__history_channels(plan) * (lsrac__stream_history_capacity(plan) + plan->tile_frames));
+}
+
+int32_t lsrac_stream_init(lsrac_stream_t * stream, const lsrac_plan_t * plan, const lsrac_allocator_t * allocator)
+{
+    if (stream == nullptr ||
+        plan == nullptr ||
+        plan->channels == 0) {
+        return LSRAC_RET_VAL_ARGUMENT_ERROR;
+    }
+
+    LSRAC__STATS_START(setup_start);
+
+    memset(stream, 0, sizeof(*stream));
+
+    stream->plan             = plan;
+    stream->allocator        = allocator != nullptr ? lsrac__resolve_allocator(allocator) : plan->allocator;
+    stream->history_capacity = lsrac__stream_history_capacity(plan);
+    stream->history          = static_cast<float *>(lsrac__alloc(&stream->allocator, sizeof(float) * lsrac__history_channels(plan) * (stream->history_capacity + plan->tile_frames)));
+
+    if (stream->history == nullptr) {
+        return LSRAC_RET_VAL_OUT_OF_MEMORY;
+    }
+
+    // The tile follows the history in the same allocation
+    stream->tile = stream->history + static_cast<size_t>(lsrac__history_channels(plan)) * stream->history_capacity;
+
+    lsrac_output_stage_init(&stream->output, 1.0f, 0);
+    lsrac_stream_reset(stream);
+
+    LSRAC__STATS_SINCE(setup_ticks, setup_start);
+
+    return LSRAC_RET_VAL_OK;
+}
+
+void lsrac_stream_uninit(lsrac_stream_t * stream)
+{
+    if (stream == nullptr) {
+        return;
+    }
+
+    lsrac__free(&stream->allocator, stream->history);
+
+    memset(stream, 0, sizeof(*stream));
+}
+
+void lsrac_plan_src_window(
+        const lsrac_plan_t * plan,
+        uint64_t             dst_first,
+        uint64_t             dst_count,
+        uint64_t *           src_first,
+        uint64_t *           src_end)
+{
+    int64_t  pos_int;
+    uint64_t pos_frac;
+
+    lsrac__src_position(plan, dst_first, &pos_int, &pos_frac);
+    int64_t first = pos_int - plan->half_width;
+
+    int64_t end = first;
+    if (dst_count != 0) {
+        lsrac__src_position(plan, dst_first + dst_count - 1, &pos_int, &pos_frac);
+        end = pos_int + plan->half_width + 1;
+    }
+
+    *src_first = first > 0 ? static_cast<uint64_t>(first) : 0;
+    *src_end   = end > 0 ? static_cast<uint64_t>(end) : 0;
+}
+
+void lsrac_stream_reset(lsrac_stream_t * stream)
+{
+    const lsrac_plan_t * plan = stream->plan;
+
+    stream->history_frames   = 0;
+    stream->history_first    = 0;
+    stream->src_frames_total = 0;
+    stream->dst_position     = 0;
+    stream->dst_total        = 0;
+    stream->flushed          = 0;
+    stream->phase            = 0;
+
+    lsrac_output_stage_init(&stream->output, stream->output.gain, stream->output.flags);
+
+    lsrac__src_position(plan, 0, &stream->src_pos_int, &stream->src_pos_frac);
+}
+
+int32_t lsrac_stream_seek(lsrac_stream_t * stream, uint64_t dst_frame, uint64_t * src_frame)
+{
+    if (stream == nullptr ||
+        stream->history == nullptr) {
+        return LSRAC_RET_VAL_ARGUMENT_ERROR;
+    }
+
+    lsrac_stream_reset(stream);
+
+    uint64_t src_first;
+    uint64_t src_end;
+    lsrac_plan_src_window(stream->plan, dst_frame, 0, &src_first, &src_end);
+
+    stream->history_first    = static_cast<int64_t>(src_first);
+    stream->src_frames_total = src_first;
+    stream->dst_position     = dst_frame;
+    stream->phase            = static_cast<uint32_t>(dst_frame % stream->plan->dst_rate);
+
+    lsrac__src_position(stream->plan, dst_frame, &stream->src_pos_int, &stream->src_pos_frac);
+
+    if (src_frame != nullptr) {
+        *src_frame = src_first;
+    }
+
+    return LSRAC_RET_VAL_OK;
+}
+
+void lsrac_stream_set_output(lsrac_stream_t * stream, float gain, uint32_t flags)
+{
+    lsrac_output_stage_init(&stream->output, gain, flags);
+}
+
+static uint64_t lsrac__stream_append(lsrac_stream_t * stream, const lsrac_buffer_t * src, uint64_t src_offset, uint64_t src_frames)
+{
+    uint32_t channels = stream->plan->channels;
+
+    uint64_t space = stream->history_capacity - stream->history_frames;
+    uint64_t count = src_frames < space ? src_frames : space;
+
+    if (count == 0) {
+        return 0;
+    }
+
+    if (stream->plan->mix_first) {
+        const float * mix = stream->plan->mix;
+
+        for (uint32_t d = 0; d < stream->plan->dst_channels; ++d) {
+            float * dst = stream->history + static_cast<size_t>(d) * stream->history_capacity + stream->history_frames;
+
+            for (uint32_t c = 0; c < channels; ++c) {
+                const float * channel = static_cast<const float *>(src->channel_data[c]) + src_offset * src->stride[c];
+                uint64_t      stride  = src->stride[c];
+                float         gain    = mix[d * channels + c];
+
+                if (c == 0) {
+                    for (uint64_t i = 0; i < count; ++i) {
+                        dst[i] = gain * channel[i * stride];
+                    }
+                } else {
+                    for (uint64_t i = 0; i < count; ++i) {
+                        dst[i] += gain * channel[i * stride];
+                    }
+                }
+            }
+        }
+    } else {
+        for (uint32_t c = 0; c < channels; ++c) {
+            float * dst = stream->history + static_cast<size_t>(c) * stream->history_capacity + stream->history_frames;
+            lsrac__copy_samples(dst, 1, static_cast<const float *>(src->channel_data[c]) + src_offset * src->stride[c], src->stride[c], count);
+        }
+    }
+
+    stream->history_frames   += static_cast<uint32_t>(count);
+    stream->src_frames_total += count;
+
+    return count;
+}
+
+static void lsrac__stream_discard(lsrac_stream_t * stream)
+{
+    int64_t keep_from = stream->src_pos_int - stream->plan->half_width;
+    int64_t discard = keep_from - stream->history_first;
+
+    if (discard <= 0) {
+        return;
+    }
+    if (discard > static_cast<int64_t>(stream->history_frames)) {
+        discard = static_cast<int64_t>(stream->history_frames);
+    }
+
+    uint32_t remaining = stream->history_frames - static_cast<uint32_t>(discard);
+
+    for (uint32_t c = 0; c < lsrac__history_channels(stream->plan); ++c) {
+        float * channel = stream->history + static_cast<size_t>(c) * stream->history_capacity;
+        memmove(channel, channel + discard, sizeof(float) * remaining);
+    }
+
+    stream->history_frames = remaining;
+    stream->history_first += discard;
+}
+
+static uint64_t lsrac__stream_produce(lsrac_stream_t * stream, const lsrac_buffer_t * dst, uint64_t dst_offset, uint64_t dst_frames)
+{
+    const lsrac_plan_t * plan = stream->plan;
+    uint32_t channels = lsrac__history_channels(plan);
+    uint32_t tile_channels = plan->tile_channels < channels ? plan->tile_channels : channels;
+
+    int32_t mix_after = plan->mix != nullptr && !plan->mix_first;
+
+    uint64_t two_dst = 2 * static_cast<uint64_t>(plan->dst_rate);
+    uint64_t two_src = 2 * static_cast<uint64_t>(plan->src_rate);
+
+    int64_t first_valid = stream->history_first;
+    int64_t end_valid = stream->history_first + stream->history_frames;
+
+    // Source position and filter phase of every output frame of a tile
+    int64_t  tile_pos[LSRAC__TILE_MAX_FRAMES];
+    uint64_t tile_left_fx[LSRAC__TILE_MAX_FRAMES];
+    uint32_t tile_phase[LSRAC__TILE_MAX_FRAMES];
+
+    uint64_t written = 0;
+
+    while (written < dst_frames) {
+
+        uint32_t count = 0;
+
+        while (count < plan->tile_frames && written + count < dst_frames) {
+            if (stream->flushed) {
+                if (stream->dst_position + count >= stream->dst_total) {
+                    break;
+                }
+            } else if (stream->src_pos_int + plan->half_width >= end_valid) {
+                break;
+            }
+
+            tile_pos[count]     = stream->src_pos_int;
+            tile_phase[count]   = stream->phase;
+            tile_left_fx[count] = plan->phases != nullptr ? plan->phases[stream->phase].left_fx : (stream->src_pos_frac * plan->filter_step_fx) / two_dst;
+            count += 1;
+
+            if (plan->phases != nullptr) {
+                stream->src_pos_int += plan->phases[stream->phase].advance;
+            } else {
+                stream->src_pos_frac += two_src;
+                stream->src_pos_int  += static_cast<int64_t>(stream->src_pos_frac / two_dst);
+                stream->src_pos_frac %= two_dst;
+            }
+
+            stream->phase = stream->phase + 1 == plan->dst_rate ? 0 : stream->phase + 1;
+        }
+
+        if (count == 0) {
+            break;
+        }
+
+        // Filter the tile one group of channels at a time
+        for (uint32_t first_channel = 0; first_channel < channels; first_channel += tile_channels) {
+            uint32_t end_channel = first_channel + tile_channels < channels ? first_channel + tile_channels : channels;
+
+            for (uint32_t i = 0; i < count; ++i) {
+                LSRAC__STATS_START(frame_start);
+
+                // A whole integer factor period, with its source frame m the center of its last frame
+                if (plan->period_taps != nullptr && tile_phase[i] == 0 && i + plan->dst_rate <= count) {
+                    int64_t m = tile_pos[i + plan->dst_rate - 1];
+                    if (m - 1 - plan->half_width >= first_valid && m + plan->half_width < end_valid) {
+                        float * filtered = stream->tile + static_cast<size_t>(i) * channels;
+                        for (uint32_t c = first_channel; c < end_channel; ++c) {
+                            const float * src = stream->history + static_cast<size_t>(c) * stream->history_capacity + (m - stream->history_first);
+                            lsrac__filter_period(plan, src, filtered + c, channels);
+                        }
+
+                        for (uint32_t j = 0; j < plan->dst_rate; ++j) {
+                            LSRAC__STATS_ADD(interior_taps, (end_channel - first_channel) * lsrac__frame_taps(plan, tile_left_fx[i + j]));
+                        }
+                        LSRAC__STATS_FILTERED(0, frame_start);
+
+                        i += plan->dst_rate - 1;
+                        continue;
+                    }
+                }
+
+                int64_t pos_int = tile_pos[i];
+                int64_t offset = pos_int - stream->history_first;
+
+                // Only the first and last frames of the output reach past the source
+                int32_t interior = pos_int - plan->half_width >= first_valid &&
+                                   pos_int + plan->half_width < end_valid;
+                int32_t tabulated = interior && plan->phases != nullptr;
+
+                float * filtered = stream->tile + static_cast<size_t>(i) * channels;
+
+                for (uint32_t c = first_channel; c < end_channel; ++c) {
+                    const float * src = stream->history + static_cast<size_t>(c) * stream->history_capacity + offset;
+                    filtered[c] = tabulated ? lsrac__filter_sample_phase(plan, tile_phase[i], src) :
+                                  interior  ? lsrac__filter_sample(plan, src, pos_int, tile_left_fx[i], first_valid, end_valid) :
+                                              lsrac__filter_sample_edge(plan, src, pos_int, tile_left_fx[i], first_valid, end_valid);
+                }
+
+                LSRAC__STATS_ADD(interior_taps, (end_channel - first_channel) * lsrac__frame_taps(plan, tile_left_fx[i]));
+                LSRAC__STATS_FILTERED(!interior, frame_start);
+            }
+        }
+
+        LSRAC__STATS_START(output_start);
+
+        // Mixing and the output stage go frame by frame, so dither does not depend on the tiles
+        for (uint32_t i = 0; i < count; ++i) {
+            const float * filtered = stream->tile + static_cast<size_t>(i) * channels;
+            uint64_t frame = dst_offset + written + i;
+
+            if (mix_after) {
+                for (uint32_t d = 0; d < plan->dst_channels; ++d) {
+                    const float * gains = plan->mix + static_cast<size_t>(d) * channels;
+
+                    float value = 0.0f;
+                    for (uint32_t c = 0; c < channels; ++c) {
+                        value += gains[c] * filtered[c];
+                    }
+                    lsrac__output_store(&stream->output, dst->format, dst->channel_data[d], frame * dst->stride[d], d, value);
+                }
+            } else {
+                for (uint32_t c = 0; c < channels; ++c) {
+                    lsrac__output_store(&stream->output, dst->format, dst->channel_data[c], frame * dst->stride[c], c, filtered[c]);
+                }
+            }
+        }
+
+        LSRAC__STATS_SINCE(output_ticks, output_start);
+
+        written += count;
+        stream->dst_position += count;
+    }
+
+    return written;
+}
+
+void lsrac_buffer_interleaved(lsrac_buffer_t * buffer, void * data, uint32_t channels, uint32_t format)
+{
+    buffer->channels = channels;
+    buffer->format   = format;
+
+    size_t sample_bytes = lsrac__format_bytes(format);
+
+    for (uint32_t c = 0; c < channels && c < LSRAC_MAX_CHANNELS; ++c) {
+        buffer->channel_data[c] = data != nullptr ? static_cast<uint8_t *>(data) + c * sample_bytes : nullptr;
+        buffer->stride[c] = channels;
+    }
+}
+
+void lsrac_buffer_planar(lsrac_buffer_t * buffer, void * const * channel_data, uint32_t channels, uint32_t format)
+{
+    buffer->channels = channels;
+    buffer->format   = format;
+
+    for (uint32_t c = 0; c < channels && c < LSRAC_MAX_CHANNELS; ++c) {
+        buffer->channel_data[c] = channel_data != nullptr ? channel_data[c] : nullptr;
+        buffer->stride[c] = 1;
+    }
+}
+
+void lsrac_buffer_advance(lsrac_buffer_t * buffer, uint64_t frames)
+{
+    size_t sample_bytes = lsrac__format_bytes(buffer->format);
+
+    for (uint32_t c = 0; c < buffer->channels && c < LSRAC_MAX_CHANNELS; ++c) {
+        buffer->channel_data[c] = static_cast<uint8_t *>(buffer->channel_data[c]) + frames * buffer->stride[c] * sample_bytes;
+    }
+}
+
+static int32_t lsrac__buffer_valid(const lsrac_buffer_t * buffer, uint32_t channels, uint64_t frames)
+{
+    if (frames == 0) {
+        return 1;
+    }
+    if (buffer == nullptr || buffer->channels != channels || buffer->format > LSRAC_FORMAT_S32) {
+        return 0;
+    }
+
+    for (uint32_t c = 0; c < channels; ++c) {
+        if (buffer->channel_data[c] == nullptr) {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+int32_t lsrac_stream_process_buffers(
+        lsrac_stream_t *        stream,
+        const lsrac_buffer_t *  dst,  uint64_t   dst_frames, uint64_t * dst_frames_written,
+        const lsrac_buffer_t *  src,  uint64_t   src_frames, uint64_t * src_frames_read)
+{
+    if (dst_frames_written != nullptr) {
+        *dst_frames_written = 0;
+    }
+    if (src_frames_read != nullptr) {
+        *src_frames_read = 0;
+    }
+
+    if (stream == nullptr ||
+        stream->history == nullptr ||
+        !lsrac__buffer_valid(dst, stream->plan->dst_channels, dst_frames) ||
+        !lsrac__buffer_valid(src, stream->plan->channels, src_frames) ||
+        (src_frames != 0 && src->format != LSRAC_FORMAT_F32)) {
+        return LSRAC_RET_VAL_ARGUMENT_ERROR;
+    }
+
+    if (stream->flushed) {
+        return LSRAC_RET_VAL_ERROR;
+    }
+
+    uint64_t written = 0;
+    uint64_t read = 0;
+
+    for (;;) {
+        uint64_t produced = lsrac__stream_produce(stream, dst, written, dst_frames - written);
+        written += produced;
+
+        lsrac__stream_discard(stream);
+
+        LSRAC__STATS_START(input_start);
+
+        uint64_t appended = lsrac__stream_append(stream, src, read, src_frames - read);
+        read += appended;
+
+        LSRAC__STATS_SINCE(input_ticks, input_start);
+
+        if (produced == 0 && appended == 0) {
+            break;
+        }
+    }
+
+    LSRAC__STATS_ADD(calls, 1);
+    LSRAC__STATS_ADD(src_frames, read);
+    LSRAC__STATS_ADD(dst_frames, written);
+
+    if (dst_frames_written != nullptr) {
+        *dst_frames_written = written;
+    }
+    if (src_frames_read != nullptr) {
+        *src_frames_read = read;
+    }
+
+    return LSRAC_RET_VAL_OK;
+}
+
+int32_t lsrac_stream_flush_buffers(
+        lsrac_stream_t *        stream,
+        const lsrac_buffer_t *  dst,  uint64_t   dst_frames, uint64_t * dst_frames_written)
+{
+    if (dst_frames_written != nullptr) {
+        *dst_frames_written = 0;
+    }
+
+    if (stream == nullptr ||
+        stream->history == nullptr ||
+        !lsrac__buffer_valid(dst, stream->plan->dst_channels, dst_frames)) {
+        return LSRAC_RET_VAL_ARGUMENT_ERROR;
+    }
+
+    const lsrac_plan_t * plan = stream->plan;
+
+    if (!stream->flushed) {
+        stream->flushed = 1;
+        stream->dst_total = lsrac_plan_dst_frames(plan, stream->src_frames_total);
+    }
+
+    uint64_t written = lsrac__stream_produce(stream, dst, 0, dst_frames);
+
+    LSRAC__STATS_ADD(calls, 1);
+    LSRAC__STATS_ADD(dst_frames, written);
+
+    if (dst_frames_written != nullptr) {
+        *dst_frames_written = written;
+    }
+
+    return LSRAC_RET_VAL_OK;
+}
+
+int32_t lsrac_stream_process(
+        lsrac_stream_t * stream,
+        float *          dst_data,  uint64_t   dst_frames, uint64_t * dst_frames_written,
+        const float *    src_data,  uint64_t   src_frames, uint64_t * src_frames_read)
+{
+    if (stream == nullptr || stream->history == nullptr) {
+        return lsrac_stream_process_buffers(stream, nullptr, 0, dst_frames_written, nullptr, 0, src_frames_read);
+    }
+
+    lsrac_buffer_t dst;
+    lsrac_buffer_t src;
+
+    lsrac_buffer_interleaved(&dst, dst_data, stream->plan->dst_channels, LSRAC_FORMAT_F32);
+    lsrac_buffer_interleaved(&src, const_cast<float *>(src_data), stream->plan->channels, LSRAC_FORMAT_F32);
+
+    return lsrac_stream_process_buffers(stream, &dst, dst_frames, dst_frames_written, &src, src_frames, src_frames_read);
+}
+
+int32_t lsrac_stream_flush(
+        lsrac_stream_t * stream,
+        float *          dst_data,  uint64_t   dst_frames, uint64_t * dst_frames_written)
+{
+    if (stream == nullptr || stream->history == nullptr) {
+        return lsrac_stream_flush_buffers(stream, nullptr, 0, dst_frames_written);
+    }
+
+    lsrac_buffer_t dst;
+
+    lsrac_buffer_interleaved(&dst, dst_data, stream->plan->dst_channels, LSRAC_FORMAT_F32);
+
+    return lsrac_stream_flush_buffers(stream, &dst, dst_frames, dst_frames_written);
+}
+
+uint64_t lsrac_plan_dst_frames(const lsrac_plan_t * plan, uint64_t src_frames)
+{
+    // One output frame per started dst_rate / src_rate of input.
+    return (src_frames * plan->dst_rate + plan->src_rate - 1) / plan->src_rate;
+}
+
+int32_t lsrac_plan_convert(
+        const lsrac_plan_t * plan,
+        float *        dst_data,    const float *  src_data,
+        uint64_t       dst_first,   uint64_t       src_first,
+        uint64_t       dst_frames,  uint64_t       src_frames,
+                                    uint64_t       src_total)
+{
+    lsrac_stream_t stream;
+    int32_t result = lsrac_stream_init(&stream, plan, nullptr);
+    if (result != LSRAC_RET_VAL_OK) {
+        return result;
+    }
+
+    result = lsrac_stream_convert(&stream, dst_data, src_data, dst_first, src_first, dst_frames, src_frames, src_total);
+
+    lsrac_stream_uninit(&stream);
+
+    return result;
+}
+
+int32_t lsrac_stream_convert(
+        lsrac_stream_t * stream,
+        float *        dst_data,    const float *  src_data,
+        uint64_t       dst_first,   uint64_t       src_first,
+        uint64_t       dst_frames,  uint64_t       src_frames,
+                                    uint64_t       src_total)
+{
+    if (stream == nullptr ||
+        stream->history == nullptr) {
+        return LSRAC_RET_VAL_ARGUMENT_ERROR;
+    }
+
+    const lsrac_plan_t * plan = stream->plan;
+
+    if (dst_first > lsrac_plan_dst_frames(plan, src_total) ||
+        dst_frames > lsrac_plan_dst_frames(plan, src_total) - dst_first) {
+        return LSRAC_RET_VAL_ARGUMENT_ERROR;
+    }
+
+    if (dst_frames == 0) {
+        return LSRAC_RET_VAL_OK;
+    }
+
+    uint64_t needed_first;
+    uint64_t needed_end;
+    lsrac_plan_src_window(plan, dst_first, dst_frames, &needed_first, &needed_end);
+
+    if (needed_end > src_total) {
+        needed_end = src_total;
+    }
+
+    if (dst_data == nullptr ||
+        src_data == nullptr ||
+        src_first > needed_first ||
+        src_frames < needed_end - src_first) {
+        return LSRAC_RET_VAL_ARGUMENT_ERROR;
+    }
+
+    lsrac_stream_seek(stream, dst_first, nullptr);
+
+    uint64_t written = 0;
+    lsrac_stream_process(stream, dst_data, dst_frames, &written,
+                         src_data + (needed_first - src_first) * plan->channels, needed_end - needed_first, nullptr);
+
+    if (written < dst_frames) {
+        // The range reaches the end of the source
+        uint64_t flushed = 0;
+        lsrac_stream_flush(stream, dst_data + written * plan->dst_channels, dst_frames - written, &flushed);
+        written += flushed;
+    }
+
+    return written == dst_frames ? LSRAC_RET_VAL_OK : LSRAC_RET_VAL_ERROR;
+}
+
+int32_t lsrac_convert_rates(
+        float *        dst_data,    const float *  src_data,
+        uint32_t       dst_rate,    uint32_t       src_rate,
+        uint64_t       dst_first,   uint64_t       src_first,
+        uint64_t       dst_frames,  uint64_t       src_frames,
+                                    uint64_t       src_total,
+        uint32_t       channels)
+{
+    lsrac_plan_t plan;
+
+    int32_t result = lsrac_plan_init(&plan, src_rate, dst_rate, channels, nullptr);
+    if (result != LSRAC_RET_VAL_OK) {
+        return result;
+    }
+
+    result = lsrac_plan_convert(&plan, dst_data, src_data, dst_first, src_first, dst_frames, src_frames, src_total);
+
+    lsrac_plan_uninit(&plan);
+
+    return result;
+}
+
+/*
+ *  Double precision
+ */
+
+static inline double lsrac__filter_tap_f64(const double * coefficients, uint64_t pos_fx)
+{
+    size_t index = static_cast<size_t>(pos_fx >> LSRAC__FX_BITS);
+    double frac  = static_cast<double>(pos_fx & LSRAC__FX_MASK) * (1.0 / static_cast<double>(LSRAC__FX_ONE));
+
+    return coefficients[index] + frac * (coefficients[index + 1] - coefficients[index]);
+}
+
+// lsrac__compute_taps() on double precision coefficients.
+static double lsrac__compute_taps_f64(const lsrac_plan_t * plan, const double * coefficients, uint64_t left_fx, double * taps, int64_t left_taps, int64_t right_taps)
+{
+    uint64_t right_fx = plan->filter_step_fx - left_fx;
+
+    double normalization_value = 0.0;
+
+    for (int64_t k = 0; k < left_taps; ++k) {
+        taps[k] = lsrac__filter_tap_f64(coefficients, left_fx + static_cast<uint64_t>(k) * plan->filter_step_fx);
+        normalization_value += taps[k];
+    }
+    for (int64_t k = 0; k < right_taps; ++k) {
+        taps[left_taps + k] = lsrac__filter_tap_f64(coefficients, right_fx + static_cast<uint64_t>(k) * plan->filter_step_fx);
+        normalization_value += taps[left_taps + k];
+    }
+
+    return normalization_value;
+}
+
+// Adds taps[k] * src[k * step + c] to the partial sum sums[k % 4][c] of every channel c,
+// for the count taps of a side of the filter (or a run of them starting at a multiple of
+// 4). step is -channels going back from a frame and channels going on. With clear set the
+// sums start at zero instead. Pairs of channels share a SIMD register; the remaining
+// channel, all of mono, adds two taps at a time.
+static void lsrac__accumulate_taps_f64(
+        double         sums[4][LSRAC_MAX_CHANNELS],
+        int32_t        clear,
+        const double * taps,
+        int64_t        count,
+        const double * src,
+        ptrdiff_t      step,
+        uint32_t       channels)
+{
+    uint32_t c = 0;
+
+#if defined(LSRAC__SSE)
+    for (; c + 2 <= channels; c += 2) {
+        __m128d sum0 = clear ? _mm_setzero_pd() : _mm_loadu_pd(sums[0] + c);
+        __m128d sum1 = clear ? _mm_setzero_pd() : _mm_loadu_pd(sums[1] + c);
+        __m128d sum2 = clear ? _mm_setzero_pd() : _mm_loadu_pd(sums[2] + c);
+        __m128d sum3 = clear ? _mm_setzero_pd() : _mm_loadu_pd(sums[3] + c);
+
+        int64_t k = 0;
+        for (; k + 4 <= count; k += 4) {
+            const double * s = src + k * step + c;
+            sum0 = _mm_add_pd(sum0, _mm_mul_pd(_mm_set1_pd(taps[k]),     _mm_loadu_pd(s)));
+            sum1 = _mm_add_pd(sum1, _mm_mul_pd(_mm_set1_pd(taps[k + 1]), _mm_loadu_pd(s + step)));
+            sum2 = _mm_add_pd(sum2, _mm_mul_pd(_mm_set1_pd(taps[k + 2]), _mm_loadu_pd(s + 2 * step)));
+            sum3 = _mm_add_pd(sum3, _mm_mul_pd(_mm_set1_pd(taps[k + 3]), _mm_loadu_pd(s + 3 * step)));
+        }
+
+        _mm_storeu_pd(sums[0] + c, sum0);
+        _mm_storeu_pd(sums[1] + c, sum1);
+        _mm_storeu_pd(sums[2] + c, sum2);
+        _mm_storeu_pd(sums[3] + c, sum3);
+
+        for (; k < count; ++k) {
+            sums[k & 3][c]     += taps[k] * src[k * step + c];
+            sums[k & 3][c + 1] += taps[k] * src[k * step + c + 1];
+        }
+    }
+#elif defined(LSRAC__NEON) && defined(__aarch64__)
+    for (; c + 2 <= channels; c += 2) {
+        float64x2_t sum0 = clear ? vdupq_n_f64(0.0) : vld1q_f64(sums[0] + c);
+        float64x2_t sum1 = clear ? vdupq_n_f64(0.0) : vld1q_f64(sums[1] + c);
+        float64x2_t sum2 = clear ? vdupq_n_f64(0.0) : vld1q_f64(sums[2] + c);
+        float64x2_t sum3 = clear ? vdupq_n_f64(0.0) : vld1q_f64(sums[3] + c);
+
+        int64_t k = 0;
+        for (; k + 4 <= count; k += 4) {
+            const double * s = src + k * step + c;
+            sum0 = vaddq_f64(sum0, vmulq_f64(vdupq_n_f64(taps[k]),     vld1q_f64(s)));
+            sum1 = vaddq_f64(sum1, vmulq_f64(vdupq_n_f64(taps[k + 1]), vld1q_f64(s + step)));
+            sum2 = vaddq_f64(sum2, vmulq_f64(vdupq_n_f64(taps[k + 2]), vld1q_f64(s + 2 * step)));
+            sum3 = vaddq_f64(sum3, vmulq_f64(vdupq_n_f64(taps[k + 3]), vld1q_f64(s + 3 * step)));
+        }
+
+        vst1q_f64(sums[0] + c, sum0);
+        vst1q_f64(sums[1] + c, sum1);
+        vst1q_f64(sums[2] + c, sum2);
+        vst1q_f64(sums[3] + c, sum3);
+
+        for (; k < count; ++k) {
+            sums[k & 3][c]     += taps[k] * src[k * step + c];
+            sums[k & 3][c + 1] += taps[k] * src[k * step + c + 1];
+        }
+    }
+#endif
+
+    for (; c < channels; ++c) {
+        int64_t k = 0;
+
+#if defined(LSRAC__SSE)
+        // Partial sums 0 and 1 in one register, 2 and 3 in the other
+        __m128d sum01 = clear ? _mm_setzero_pd() : _mm_set_pd(sums[1][c], sums[0][c]);
+        __m128d sum23 = clear ? _mm_setzero_pd() : _mm_set_pd(sums[3][c], sums[2][c]);
+
+        const double * s = src + c;
+        int64_t vector_end = count & ~static_cast<int64_t>(3);
+
+        if (step == 1) {
+            for (; k < vector_end; k += 4) {
+                sum01 = _mm_add_pd(sum01, _mm_mul_pd(_mm_loadu_pd(taps + k), _mm_loadu_pd(s + k)));
+                sum23 = _mm_add_pd(sum23, _mm_mul_pd(_mm_loadu_pd(taps + k + 2), _mm_loadu_pd(s + k + 2)));
+            }
+        } else if (step == -1) {
+            for (; k < vector_end; k += 4) {
+                __m128d s01 = _mm_loadu_pd(s - k - 1);
+                __m128d s23 = _mm_loadu_pd(s - k - 3);
+                sum01 = _mm_add_pd(sum01, _mm_mul_pd(_mm_loadu_pd(taps + k), _mm_shuffle_pd(s01, s01, 1)));
+                sum23 = _mm_add_pd(sum23, _mm_mul_pd(_mm_loadu_pd(taps + k + 2), _mm_shuffle_pd(s23, s23, 1)));
+            }
+        } else {
+            for (; k < vector_end; k += 4) {
+                const double * x = s + k * step;
+                sum01 = _mm_add_pd(sum01, _mm_mul_pd(_mm_loadu_pd(taps + k), _mm_set_pd(x[step], x[0])));
+                sum23 = _mm_add_pd(sum23, _mm_mul_pd(_mm_loadu_pd(taps + k + 2), _mm_set_pd(x[3 * step], x[2 * step])));
+            }
+        }
+
+        _mm_storel_pd(&sums[0][c], sum01);
+        _mm_storeh_pd(&sums[1][c], sum01);
+        _mm_storel_pd(&sums[2][c], sum23);
+        _mm_storeh_pd(&sums[3][c], sum23);
+#elif defined(LSRAC__NEON) && defined(__aarch64__)
+        float64x2_t sum01 = clear ? vdupq_n_f64(0.0) : vcombine_f64(vdup_n_f64(sums[0][c]), vdup_n_f64(sums[1][c]));
+        float64x2_t sum23 = clear ? vdupq_n_f64(0.0) : vcombine_f64(vdup_n_f64(sums[2][c]), vdup_n_f64(sums[3][c]));
+
+        for (; k + 4 <= count; k += 4) {
+            const double * s = src + k * step + c;
+
+            float64x2_t s01;
+            float64x2_t s23;
+            if (step == 1) {
+                s01 = vld1q_f64(s);
+                s23 = vld1q_f64(s + 2);
+            } else if (step == -1) {
+                s01 = vld1q_f64(s - 1);
+                s23 = vld1q_f64(s - 3);
+                s01 = vextq_f64(s01, s01, 1);
+                s23 = vextq_f64(s23, s23, 1);
+            } else {
+                s01 = vcombine_f64(vdup_n_f64(s[0]), vdup_n_f64(s[step]));
+                s23 = vcombine_f64(vdup_n_f64(s[2 * step]), vdup_n_f64(s[3 * step]));
+            }
+
+            sum01 = vaddq_f64(sum01, vmulq_f64(vld1q_f64(taps + k), s01));
+            sum23 = vaddq_f64(sum23, vmulq_f64(vld1q_f64(taps + k + 2), s23));
+        }
+
+        vst1q_lane_f64(&sums[0][c], sum01, 0);
+        vst1q_lane_f64(&sums[1][c], sum01, 1);
+        vst1q_lane_f64(&sums[2][c], sum23, 0);
+        vst1q_lane_f64(&sums[3][c], sum23, 1);
+#else
+        if (clear) {
+            sums[0][c] = 0.0;
+            sums[1][c] = 0.0;
+            sums[2][c] = 0.0;
+            sums[3][c] = 0.0;
+        }
+#endif
+
+        for (; k < count; ++k) {
+            sums[k & 3][c] += taps[k] * src[k * step + c];
+        }
+    }
+}
+
+// Filters all channels of the interleaved frame at src with left_taps taps going back from
+// it and then right_taps taps going on from the next frame. Every channel adds up its
+// products in four partial sums, tap k of each side in sum k % 4 (the order of
+// LSRAC_ACCUMULATE_PAIRWISE), the same in every build.
+static void lsrac__filter_frame_f64(
+        const double * taps,
+        int64_t        left_taps,
+        int64_t        right_taps,
+        double         normalization,
+        const double * src,
+        uint32_t       channels,
+        double *       filtered)
+{
+    ptrdiff_t stride = static_cast<ptrdiff_t>(channels);
+
+    double sums[4][LSRAC_MAX_CHANNELS];
+
+    lsrac__accumulate_taps_f64(sums, 1, taps, left_taps, src, -stride, channels);
+    lsrac__accumulate_taps_f64(sums, 0, taps + left_taps, right_taps, src + channels, stride, channels);
+
+    for (uint32_t c = 0; c < channels; ++c) {
+        filtered[c] = ((sums[0][c] + sums[1][c]) + (sums[2][c] + sums[3][c])) / normalization;
+    }
+}
+
+// lsrac__filter_frame_f64() with the taps at filter position left_fx computed from
+// coefficients, LSRAC__F64_TAP_BLOCK at a time so that no buffer as long as the filter is
+// needed. Gives the same results as taps from lsrac__compute_taps_f64().
+static void lsrac__filter_frame_at_f64(
+        const lsrac_plan_t * plan,
+        const double *       coefficients,
+        uint64_t             left_fx,
+        const double *       src,
+        double *             filtered)
+{
+    uint32_t channels = plan->channels;
+
+    double sums[4][LSRAC_MAX_CHANNELS];
+    double taps[LSRAC__F64_TAP_BLOCK];
+    double normalization = 0.0;
+    int32_t clear = 1;
+
+    for (int32_t side = 0; side < 2; ++side) {
+        uint64_t start_fx = side == 0 ? left_fx : plan->filter_step_fx - left_fx;
+        int64_t count = lsrac__taps_in_filter(plan, start_fx);
+        ptrdiff_t step = side == 0 ? -static_cast<ptrdiff_t>(channels) : static_cast<ptrdiff_t>(channels);
+        const double * first = side == 0 ? src : src + channels;
+
+        for (int64_t block = 0; block < count; block += LSRAC__F64_TAP_BLOCK) {
+            int64_t block_taps = count - block < LSRAC__F64_TAP_BLOCK ? count - block : LSRAC__F64_TAP_BLOCK;
+
+            for (int64_t k = 0; k < block_taps; ++k) {
+                taps[k] = lsrac__filter_tap_f64(coefficients, start_fx + static_cast<uint64_t>(block + k) * plan->filter_step_fx);
+                normalization += taps[k];
+            }
+
+            lsrac__accumulate_taps_f64(sums, clear, taps, block_taps, first + block * step, step, channels);
+            clear = 0;
+        }
+    }
+
+    for (uint32_t c = 0; c < channels; ++c) {
+        filtered[c] = ((sums[0][c] + sums[1][c]) + (sums[2][c] + sums[3][c])) / normalization;
+    }
+}
+
+// Writes the plan's filter in double precision, coefficient_count coefficients, to coefficients.
+static void lsrac__build_coefficients_f64(const lsrac_plan_t * plan, double * coefficients)
+{
+    for (uint32_t i = 0; i < plan->coefficient_count; ++i) {
+        coefficients[i] = plan->quality == LSRAC_QUALITY_PREVIEW ? lsrac__lanczos(i) :
+                          lsrac_filter_f64.coefficients[i] * lsrac__taper_gain(i, plan->coefficient_count);
+    }
+}
+
+// Writes the taps of every phase of the plan's phase table, phase_stride per phase, and then
+// the dst_rate normalizations to phase_taps.
+static void lsrac__build_phase_taps_f64(const lsrac_plan_t * plan, const double * coefficients, double * phase_taps)
+{
+    double * normalization = phase_taps + static_cast<size_t>(plan->dst_rate) * plan->phase_stride;
+
+    for (uint32_t n = 0; n < plan->dst_rate; ++n) {
+        const lsrac_phase_t * entry = plan->phases + n;
+        normalization[n] = lsrac__compute_taps_f64(plan, coefficients, entry->left_fx, phase_taps + static_cast<size_t>(n) * plan->phase_stride,
+                                                   entry->left_taps, entry->right_taps);
+    }
+}
+
+int32_t lsrac_plan_prepare_f64(lsrac_plan_t * plan)
+{
+    if (plan == nullptr ||
+        plan->coefficients == nullptr) {
+        return LSRAC_RET_VAL_ARGUMENT_ERROR;
+    }
+
+    LSRAC__STATS_START(setup_start);
+
+    lsrac__free(&plan->allocator, plan->phase_taps_f64);
+    if (plan->coefficients_f64 != lsrac_filter_f64.coefficients) {
+        lsrac__free(&plan->allocator, const_cast<double *>(plan->coefficients_f64));
+    }
+
+    plan->coefficients_f64 = nullptr;
+    plan->phase_taps_f64   = nullptr;
+
+    const double * coefficients = lsrac_filter_f64.coefficients;
+    if (plan->quality != LSRAC_QUALITY_BEST) {
+        double * shortened = static_cast<double *>(lsrac__alloc(&plan->allocator, sizeof(double) * plan->coefficient_count));
+        if (shortened == nullptr) {
+            return LSRAC_RET_VAL_OUT_OF_MEMORY;
+        }
+        lsrac__build_coefficients_f64(plan, shortened);
+        coefficients = shortened;
+    }
+
+    // Plans without a phase table compute the taps of every frame
+    if (plan->phases != nullptr) {
+        size_t table_doubles = static_cast<size_t>(plan->dst_rate) * (plan->phase_stride + 1);
+        plan->phase_taps_f64 = static_cast<double *>(lsrac__alloc(&plan->allocator, sizeof(double) * table_doubles));
+        if (plan->phase_taps_f64 != nullptr) {
+            lsrac__build_phase_taps_f64(plan, coefficients, plan->phase_taps_f64);
+        }
+    }
+
+    plan->coefficients_f64 = coefficients;
+
+    LSRAC__STATS_SINCE(setup_ticks, setup_start);
+
+    return LSRAC_RET_VAL_OK;
+}
+
+// lsrac__filter_sample_edge() in double precision, for channel c of the interleaved frames
+// src holds from src_first on.
+static double lsrac__filter_sample_edge_f64(
+        const lsrac_plan_t * plan,
+        const double *       coefficients,
+        const double *       src,
+        int64_t              src_first,
+        uint32_t             c,
+        int64_t              pos_int,
+        uint64_t             left_fx,
+        int64_t              end_valid)
+{
+    double value = 0.0;
+    double normalization_value = 0.0;
+
+    for (int32_t side = 0; side < 2; ++side) {
+        uint64_t start_fx = side == 0 ? left_fx : plan->filter_step_fx - left_fx;
+        int64_t taps = lsrac__taps_in_filter(plan, start_fx);
+
+        uint64_t pos_fx = start_fx;
+        for (int64_t k = 0; k < taps; ++k) {
+            double c_tap = lsrac__filter_tap_f64(coefficients, pos_fx);
+            pos_fx += plan->filter_step_fx;
+
+            int64_t index = side == 0 ? pos_int - k : pos_int + 1 + k;
+            if (index < 0 || index >= end_valid) {
+                // Dropped from the normalization too when renormalizing
+                if (plan->edge == LSRAC_EDGE_RENORMALIZE) {
+                    continue;
+                }
+                normalization_value += c_tap;
+                if (!lsrac__edge_index(&index, 0, end_valid, plan->edge)) {
+                    continue;
+                }
+                value += c_tap * src[static_cast<size_t>(index - src_first) * plan->channels + c];
+                continue;
+            }
+
+            value += c_tap * src[static_cast<size_t>(index - src_first) * plan->channels + c];
+            normalization_value += c_tap;
+        }
+    }
+
+    if (normalization_value == 0.0) {
+        return 0.0;
+    }
+
+    return value / normalization_value;
+}
+
+int32_t lsrac_plan_convert_f64(
+        const lsrac_plan_t * plan,
+        double *       dst_data,    const double * src_data,
+        uint64_t       dst_first,   uint64_t       src_first,
+        uint64_t       dst_frames,  uint64_t       src_frames,
+                                    uint64_t       src_total)
+{
+    if (plan == nullptr ||
+        plan->channels == 0 ||
+        dst_first > lsrac_plan_dst_frames(plan, src_total) ||
+        dst_frames > lsrac_plan_dst_frames(plan, src_total) - dst_first) {
+        return LSRAC_RET_VAL_ARGUMENT_ERROR;
+    }
+
+    if (dst_frames == 0) {
+        return LSRAC_RET_VAL_OK;
+    }
+
+    uint64_t needed_first;
+    uint64_t needed_end;
+    lsrac_plan_src_window(plan, dst_first, dst_frames, &needed_first, &needed_end);
+
+    if (needed_end > src_total) {
+        needed_end = src_total;
+    }
+
+    if (dst_data == nullptr ||
+        src_data == nullptr ||
+        src_first > needed_first ||
+        src_frames < needed_end - src_first) {
+        return LSRAC_RET_VAL_ARGUMENT_ERROR;
+    }
+
+    LSRAC__STATS_START(setup_start);
+
+    uint32_t channels = plan->channels;
+    uint32_t stride = plan->phase_stride;
+
+    const double * coefficients = plan->coefficients_f64;
+    const double * phase_taps = plan->phases != nullptr ? plan->phase_taps_f64 : nullptr;
+    double * workspace = nullptr;
+
+    if (coefficients == nullptr) {
+        // Not prepared: the shortened filter of lower qualities and, when the range covers
+        // a whole period of a plan with a phase table, the phase table, for this call only
+        int32_t tabulate = plan->phases != nullptr && dst_frames >= plan->dst_rate;
+        size_t coefficient_doubles = plan->quality != LSRAC_QUALITY_BEST ? plan->coefficient_count : 0;
+        size_t table_doubles = tabulate ? static_cast<size_t>(plan->dst_rate) * (stride + 1) : 0;
+
+        coefficients = lsrac_filter_f64.coefficients;
+
+        if (coefficient_doubles + table_doubles != 0) {
+            workspace = static_cast<double *>(lsrac__alloc(&plan->allocator, sizeof(double) * (coefficient_doubles + table_doubles)));
+            if (workspace == nullptr) {
+                return LSRAC_RET_VAL_OUT_OF_MEMORY;
+            }
+        }
+
+        if (coefficient_doubles != 0) {
+            lsrac__build_coefficients_f64(plan, workspace);
+            coefficients = workspace;
+        }
+        if (tabulate) {
+            lsrac__build_phase_taps_f64(plan, coefficients, workspace + coefficient_doubles);
+            phase_taps = workspace + coefficient_doubles;
+        }
+    }
+
+    int32_t tabulate = phase_taps != nullptr;
+    const double * phase_normalization = tabulate ? phase_taps + static_cast<size_t>(plan->dst_rate) * stride : nullptr;
+
+    LSRAC__STATS_SINCE(setup_ticks, setup_start);
+    LSRAC__STATS_ADD(calls, 1);
+    LSRAC__STATS_ADD(src_frames, needed_end - needed_first);
+    LSRAC__STATS_ADD(dst_frames, dst_frames);
+
+    uint64_t two_dst = 2 * static_cast<uint64_t>(plan->dst_rate);
+    uint64_t two_src = 2 * static_cast<uint64_t>(plan->src_rate);
+    int64_t end_valid = static_cast<int64_t>(src_total);
+
+    int64_t pos_int;
+    uint64_t pos_frac;
+    lsrac__src_position(plan, dst_first, &pos_int, &pos_frac);
+    uint32_t phase = static_cast<uint32_t>(dst_first % plan->dst_rate);
+
+    double filtered[LSRAC_MAX_CHANNELS];
+
+    for (uint64_t i = 0; i < dst_frames; ++i) {
+        LSRAC__STATS_START(frame_start);
+
+        int32_t interior = pos_int - plan->half_width >= 0 && pos_int + plan->half_width < end_valid;
+
+        // With a phase table the clock only steps through it, edge frames need the
+        // fractional position too
+        if (tabulate && !interior) {
+            lsrac__src_position(plan, dst_first + i, &pos_int, &pos_frac);
+        }
+        uint64_t left_fx = tabulate && interior ? plan->phases[phase].left_fx : (pos_frac * plan->filter_step_fx) / two_dst;
+
+        double * out = plan->mix != nullptr ? filtered : dst_data + i * plan->dst_channels;
+
+        if (interior) {
+            const double * frame = src_data + static_cast<size_t>(pos_int - static_cast<int64_t>(src_first)) * channels;
+
+            if (tabulate) {
+                const lsrac_phase_t * entry = plan->phases + phase;
+                lsrac__filter_frame_f64(phase_taps + static_cast<size_t>(phase) * stride, entry->left_taps, entry->right_taps,
+                                        phase_normalization[phase], frame, channels, out);
+            } else {
+                lsrac__filter_frame_at_f64(plan, coefficients, left_fx, frame, out);
+            }
+        } else {
+            for (uint32_t c = 0; c < channels; ++c) {
+                out[c] = lsrac__filter_sample_edge_f64(plan, coefficients, src_data, static_cast<int64_t>(src_first), c, pos_int, left_fx, end_valid);
+            }
+        }
+
+        if (plan->mix != nullptr) {
+            double * dst = dst_data + i * plan->dst_channels;
+            for (uint32_t d = 0; d < plan->dst_channels; ++d) {
+                const float * gains = plan->mix + static_cast<size_t>(d) * channels;
+
+                double value = 0.0;
+                for (uint32_t c = 0; c < channels; ++c) {
+                    value += static_cast<double>(gains[c]) * filtered[c];
+                }
+                dst[d] = value;
+            }
+        }
+
+        LSRAC__STATS_ADD(interior_taps, channels * lsrac__frame_taps(plan, left_fx));
+        LSRAC__STATS_FILTERED(!interior, frame_start);
+
+        if (tabulate) {
+            pos_int += plan->phases[phase].advance;
+        } else {
+            pos_frac += two_src;
+            pos_int  += static_cast<int64_t>(pos_frac / two_dst);
+            pos_frac %= two_dst;
+        }
+        phase = phase + 1 == plan->dst_rate ? 0 : phase + 1;
+    }
+
+    lsrac__free(&plan->allocator, workspace);
+
+    return LSRAC_RET_VAL_OK;
+}
+
+int32_t lsrac_convert_rates_f64(
+        double *       dst_data,    const double * src_data,
+        uint32_t       dst_rate,    uint32_t       src_rate,
+        uint64_t       dst_first,   uint64_t       src_first,
+        uint64_t       dst_frames,  uint64_t       src_frames,
+                                    uint64_t       src_total,
+        uint32_t       channels)
+{
+    lsrac_plan_t plan;
+
+    int32_t result = lsrac_plan_init(&plan, src_rate, dst_rate, channels, nullptr);
+    if (result != LSRAC_RET_VAL_OK) {
+        return result;
+    }
+
+    result = lsrac_plan_convert_f64(&plan, dst_data, src_data, dst_first, src_first, dst_frames, src_frames, src_total);
+
+    lsrac_plan_uninit(&plan);
+
+    return result;
+}
+
+/*
+ *  Variable speed streams
+ */
+
+// Slowest speed a speed curve is clamped to
+#define LSRAC__VSTREAM_MIN_SPEED (1.0 / 1024.0)
+
+// Filter step for ratio source frames per output frame: the full filter up to ratio 1,
+// stretched so its zero crossings follow the output spacing above.
+static uint64_t lsrac__vstream_step(const lsrac_vstream_t * vstream, double ratio)
+{
+    if (ratio <= 1.0) {
+        return vstream->full_step_fx;
+    }
+
+    uint64_t step = static_cast<uint64_t>(static_cast<double>(vstream->full_step_fx) / ratio + 0.5);
+    return step != 0 ? step : 1;
+}
+
+int32_t lsrac_vstream_init(lsrac_vstream_t * vstream, const lsrac_plan_t * plan, float max_speed, const lsrac_allocator_t * allocator)
+{
+    if (vstream == nullptr ||
+        plan == nullptr ||
+        plan->channels == 0 ||
+        !(max_speed > 0.0f)) {
+        return LSRAC_RET_VAL_ARGUMENT_ERROR;
+    }
+
+    memset(vstream, 0, sizeof(*vstream));
+
+    vstream->nominal_ratio = static_cast<double>(plan->src_rate) / static_cast<double>(plan->dst_rate);
+    vstream->max_speed     = max_speed;
+    vstream->speed         = 1.0 < vstream->max_speed ? 1.0 : vstream->max_speed;
+    vstream->target_speed  = vstream->speed;
+    vstream->full_step_fx  = static_cast<uint64_t>(static_cast<double>(lsrac_filter.increment) * static_cast<double>(LSRAC__FX_ONE) + 0.5);
+
+    // The kernel shares the plan's coefficients and mix, it never owns memory. Its history
+    // has to cover the widest filter, the one of the highest speed.
+    vstream->kernel                = *plan;
+    vstream->kernel.phases         = nullptr;
+    vstream->kernel.phase_taps     = nullptr;
+    vstream->kernel.period_taps    = nullptr;
+    vstream->kernel.phase_taps_f64 = nullptr;
+    vstream->kernel.filter_step_fx = lsrac__vstream_step(vstream, vstream->nominal_ratio * vstream->max_speed);
+    lsrac__plan_set_filter_length(&vstream->kernel);
+
+    int32_t result = lsrac_stream_init(&vstream->stream, &vstream->kernel, allocator);
+    if (result != LSRAC_RET_VAL_OK) {
+        return result;
+    }
+
+    vstream->taps = static_cast<float *>(lsrac__alloc(&vstream->stream.allocator, sizeof(float) * 2 * vstream->kernel.half_width));
+    if (vstream->taps == nullptr) {
+        lsrac_stream_uninit(&vstream->stream);
+        return LSRAC_RET_VAL_OUT_OF_MEMORY;
+    }
+
+    lsrac_vstream_reset(vstream);
+
+    return LSRAC_RET_VAL_OK;
+}
+
+void lsrac_vstream_uninit(lsrac_vstream_t * vstream)
+{
+    if (vstream == nullptr) {
+        return;
+    }
+
+    lsrac__free(&vstream->stream.allocator, vstream->taps);
+    lsrac_stream_uninit(&vstream->stream);
+
+    memset(vstream, 0, sizeof(*vstream));
+}
+
+void lsrac_vstream_reset(lsrac_vstream_t * vstream)
+{
+    vstream->stream.plan = &vstream->kernel;
+    lsrac_stream_reset(&vstream->stream);
+
+    vstream->speed       = vstream->target_speed;
+    vstream->ramp_frames = 0;
+    vstream->src_time    = 0.0;
+    vstream->step_ratio  = 0.0;
+
+    vstream->stream.src_pos_int = -1;
+}
+
+int32_t lsrac_vstream_set_speed(lsrac_vstream_t * vstream, float speed, uint64_t ramp_frames)
+{
+    if (vstream == nullptr ||
+        !(speed > 0.0f) ||
+        speed > vstream->max_speed) {
+        return LSRAC_RET_VAL_ARGUMENT_ERROR;
+    }
+
+    vstream->target_speed = speed;
+    vstream->ramp_frames  = ramp_frames;
+
+    if (ramp_frames == 0) {
+        vstream->speed = speed;
+    }
+
+    return LSRAC_RET_VAL_OK;
+}
+
+static uint64_t lsrac__vstream_produce(lsrac_vstream_t * vstream, const lsrac_buffer_t * dst, uint64_t dst_offset, uint64_t dst_frames, const float * speeds)
+{
+    lsrac_stream_t * stream = &vstream->stream;
+    lsrac_plan_t * kernel = &vstream->kernel;
+    uint32_t channels = lsrac__history_channels(kernel);
+
+    int32_t mix_after = kernel->mix != nullptr && !kernel->mix_first;
+
+    int64_t first_valid = stream->history_first;
+    int64_t end_valid = stream->history_first + stream->history_frames;
+
+    // Filtered channels of the current output frame
+    float * filtered = stream->tile;
+
+    uint64_t written = 0;
+
+    while (written < dst_frames) {
+        double speed = vstream->speed;
+        if (speeds != nullptr) {
+            speed = speeds[dst_offset + written];
+            speed = speed < LSRAC__VSTREAM_MIN_SPEED ? LSRAC__VSTREAM_MIN_SPEED : speed > vstream->max_speed ? vstream->max_speed : speed;
+        }
+
+        double ratio = vstream->nominal_ratio * speed;
+        double pos = vstream->src_time + 0.5 * ratio - 0.5;
+        int64_t pos_int = static_cast<int64_t>(floor(pos));
+
+        if (stream->flushed) {
+            if (vstream->src_time >= static_cast<double>(stream->src_frames_total)) {
+                break;
+            }
+        } else if (pos_int + kernel->half_width >= end_valid) {
+            break;
+        }
+
+        if (ratio != vstream->step_ratio) {
+            kernel->filter_step_fx = lsrac__vstream_step(vstream, ratio);
+            vstream->step_ratio = ratio;
+        }
+
+        LSRAC__STATS_START(frame_start);
+
+        uint64_t left_fx = static_cast<uint64_t>((pos - static_cast<double>(pos_int)) * static_cast<double>(kernel->filter_step_fx));
+        int64_t offset = pos_int - stream->history_first;
+
+        int32_t interior = pos_int - kernel->half_width >= first_valid &&
+                           pos_int + kernel->half_width < end_valid;
+
+        if (interior) {
+            // The taps are computed once and applied to every channel
+            int64_t left_taps = lsrac__taps_in_filter(kernel, left_fx);
+            int64_t right_taps = lsrac__taps_in_filter(kernel, kernel->filter_step_fx - left_fx);
+            const float * left = vstream->taps;
+            const float * right = vstream->taps + left_taps;
+            float normalization = lsrac__compute_taps(kernel, left_fx, vstream->taps, left_taps, right_taps);
+
+            for (uint32_t c = 0; c < channels; ++c) {
+                const float * src = stream->history + static_cast<size_t>(c) * stream->history_capacity + offset;
+
+                filtered[c] = lsrac__apply_taps(kernel->accumulation, left, left_taps, right, right_taps, src) / normalization;
+            }
+        } else {
+            for (uint32_t c = 0; c < channels; ++c) {
+                const float * src = stream->history + static_cast<size_t>(c) * stream->history_capacity + offset;
+                filtered[c] = lsrac__filter_sample_edge(kernel, src, pos_int, left_fx, first_valid, end_valid);
+            }
+        }
+
+        LSRAC__STATS_ADD(interior_taps, channels * lsrac__frame_taps(kernel, left_fx));
+        LSRAC__STATS_FILTERED(!interior, frame_start);
+
+        uint64_t frame = dst_offset + written;
+
+        if (mix_after) {
+            for (uint32_t d = 0; d < kernel->dst_channels; ++d) {
+                const float * gains = kernel->mix + static_cast<size_t>(d) * channels;
+
+                float value = 0.0f;
+                for (uint32_t c = 0; c < channels; ++c) {
+                    value += gains[c] * filtered[c];
+                }
+                lsrac__output_store(&stream->output, dst->format, dst->channel_data[d], frame * dst->stride[d], d, value);
+            }
+        } else {
+            for (uint32_t c = 0; c < channels; ++c) {
+                lsrac__output_store(&stream->output, dst->format, dst->channel_data[c], frame * dst->stride[c], c, filtered[c]);
+            }
+        }
+
+        vstream->src_time += ratio;
+
+        if (speeds != nullptr) {
+            vstream->speed = speed;
+        } else if (vstream->ramp_frames != 0) {
+            vstream->speed += (vstream->target_speed - vstream->speed) / static_cast<double>(vstream->ramp_frames);
+            vstream->ramp_frames -= 1;
+        }
+
+        // No later output frame reaches further back than this, whatever its speed
+        stream->src_pos_int = static_cast<int64_t>(floor(vstream->src_time - 0.5));
+
+        written += 1;
+        stream->dst_position += 1;
+    }
+
+    if (speeds != nullptr) {
+        vstream->target_speed = vstream->speed;
+        vstream->ramp_frames = 0;
+    }
+
+    return written;
+}
+
+int32_t lsrac_vstream_process(
+        lsrac_vstream_t * vstream,
+        float *           dst_data,  uint64_t   dst_frames, uint64_t * dst_frames_written,
+        const float *     src_data,  uint64_t   src_frames, uint64_t * src_frames_read,
+        const float *     speeds)
+{
+    if (dst_frames_written != nullptr) {
+        *dst_frames_written = 0;
+    }
+    if (src_frames_read != nullptr) {
+        *src_frames_read = 0;
+    }
+
+    if (vstream == nullptr ||
+        vstream->stream.history == nullptr ||
+        (dst_frames != 0 && dst_data == nullptr) ||
+        (src_frames != 0 && src_data == nullptr)) {
+        return LSRAC_RET_VAL_ARGUMENT_ERROR;
+    }
+
+    lsrac_stream_t * stream = &vstream->stream;
+    stream->plan = &vstream->kernel;
+
+    if (stream->flushed) {
+        return LSRAC_RET_VAL_ERROR;
+    }
+
+    lsrac_buffer_t dst;
+    lsrac_buffer_t src;
+
+    lsrac_buffer_interleaved(&dst, dst_data, vstream->kernel.dst_channels, LSRAC_FORMAT_F32);
+    lsrac_buffer_interleaved(&src, const_cast<float *>(src_data), vstream->kernel.channels, LSRAC_FORMAT_F32);
+
+    uint64_t written = 0;
+    uint64_t read = 0;
+
+    for (;;) {
+        uint64_t produced = lsrac__vstream_produce(vstream, &dst, written, dst_frames - written, speeds);
+        written += produced;
+
+        lsrac__stream_discard(stream);
+
+        LSRAC__STATS_START(input_start);
+
+        uint64_t appended = lsrac__stream_append(stream, &src, read, src_frames - read);
+        read += appended;
+
+        LSRAC__STATS_SINCE(input_ticks, input_start);
+
+        if (produced == 0 && appended == 0) {
+            break;
+        }
+    }
+
+    LSRAC__STATS_ADD(calls, 1);
+    LSRAC__STATS_ADD(src_frames, read);
+    LSRAC__STATS_ADD(dst_frames, written);
+
+    if (dst_frames_written != nullptr) {
+        *dst_frames_written = written;
+    }
+    if (src_frames_read != nullptr) {
+        *src_frames_read = read;
+    }
+
+    return LSRAC_RET_VAL_OK;
+}
+
+int32_t lsrac_vstream_flush(
+        lsrac_vstream_t * vstream,
+        float *           dst_data,  uint64_t   dst_frames, uint64_t * dst_frames_written,
+        const float *     speeds)
+{
+    if (dst_frames_written != nullptr) {
+        *dst_frames_written = 0;
+    }
+
+    if (vstream == nullptr ||
+        vstream->stream.history == nullptr ||
+        (dst_frames != 0 && dst_data == nullptr)) {
+        return LSRAC_RET_VAL_ARGUMENT_ERROR;
+    }
+
+    lsrac_stream_t * stream = &vstream->stream;
+    stream->plan = &vstream->kernel;
+    stream->flushed = 1;
+
+    lsrac_buffer_t dst;
+    lsrac_buffer_interleaved(&dst, dst_data, vstream->kernel.dst_channels, LSRAC_FORMAT_F32);
+
+    uint64_t written = lsrac__vstream_produce(vstream, &dst, 0, dst_frames, speeds);
+
+    LSRAC__STATS_ADD(calls, 1);
+    LSRAC__STATS_ADD(dst_frames, written);
+
+    if (dst_frames_written != nullptr) {
+        *dst_frames_written = written;
+    }
+
+    return LSRAC_RET_VAL_OK;
+}
+
+/*
+ *  Stream pools
+ */
+
+#define LSRAC__POOL_LANES 8
+
+static uint32_t lsrac__pool_history_capacity(const lsrac_plan_t * plan, uint32_t block_frames)
+{
+    return static_cast<uint32_t>(2 * plan->half_width + 4) + block_frames;
+}
+
+size_t lsrac_pool_workspace_size(const lsrac_plan_t * plan, uint32_t capacity, uint32_t block_frames)
+{
+    if (plan == nullptr) {
+        return 0;
+    }
+
+    size_t lane_stride = (capacity + LSRAC__POOL_LANES - 1) / LSRAC__POOL_LANES * LSRAC__POOL_LANES;
+
+    return lsrac__workspace_bytes(capacity) +
+           lsrac__workspace_bytes(sizeof(float) * lane_stride * lsrac__pool_history_capacity(plan, block_frames)) +
+           lsrac__workspace_bytes(sizeof(float) * lane_stride) +
+           lsrac__workspace_bytes(sizeof(float) * 2 * plan->half_width);
+}
+
+int32_t lsrac_pool_init(
+        lsrac_pool_t *             pool,
+        const lsrac_plan_t *       plan,
+        uint32_t                   capacity,
+        uint32_t                   block_frames,
+        const lsrac_allocator_t *  allocator)
+{
+    if (pool == nullptr ||
+        plan == nullptr ||
+        plan->channels != 1 ||
+        plan->mix != nullptr ||
+        (plan->edge != LSRAC_EDGE_RENORMALIZE && plan->edge != LSRAC_EDGE_ZERO) ||
+        capacity == 0 ||
+        block_frames == 0) {
+        return LSRAC_RET_VAL_ARGUMENT_ERROR;
+    }
+
+    memset(pool, 0, sizeof(*pool));
+
+    pool->plan             = plan;
+    pool->allocator        = allocator != nullptr ? lsrac__resolve_allocator(allocator) : plan->allocator;
+    pool->capacity         = capacity;
+    pool->lane_stride      = (capacity + LSRAC__POOL_LANES - 1) / LSRAC__POOL_LANES * LSRAC__POOL_LANES;
+    pool->block_frames     = block_frames;
+    pool->history_capacity = lsrac__pool_history_capacity(plan, block_frames);
+
+    pool->active       = static_cast<uint8_t *>(lsrac__alloc(&pool->allocator, capacity));
+    pool->history      = static_cast<float *>(lsrac__alloc(&pool->allocator, sizeof(float) * pool->lane_stride * pool->history_capacity));
+    pool->accumulators = static_cast<float *>(lsrac__alloc(&pool->allocator, sizeof(float) * pool->lane_stride));
+    pool->taps         = static_cast<float *>(lsrac__alloc(&pool->allocator, sizeof(float) * 2 * plan->half_width));
+
+    if (pool->active == nullptr ||
+        pool->history == nullptr ||
+        pool->accumulators == nullptr ||
+        pool->taps == nullptr) {
+        lsrac_pool_uninit(pool);
+        return LSRAC_RET_VAL_OUT_OF_MEMORY;
+    }
+
+    memset(pool->active, 0, capacity);
+
+    // The pool starts out with half a filter of silence, so no output frame ever needs
+    // samples from before the start of the history.
+    pool->history_frames = static_cast<uint32_t>(plan->half_width);
+    pool->history_first  = -plan->half_width;
+    memset(pool->history, 0, sizeof(float) * pool->lane_stride * pool->history_frames);
+
+    int64_t numerator = static_cast<int64_t>(plan->src_rate) - static_cast<int64_t>(plan->dst_rate);
+    int64_t denominator = 2 * static_cast<int64_t>(plan->dst_rate);
+
+    pool->src_pos_int  = lsrac__floor_div(numerator, denominator);
+    pool->src_pos_frac = static_cast<uint64_t>(numerator - pool->src_pos_int * denominator);
+
+    return LSRAC_RET_VAL_OK;
+}
+
+void lsrac_pool_uninit(lsrac_pool_t * pool)
+{
+    if (pool == nullptr) {
+        return;
+    }
+
+    lsrac__free(&pool->allocator, pool->taps);
+    lsrac__free(&pool->allocator, pool->accumulators);
+    lsrac__free(&pool->allocator, pool->history);
+    lsrac__free(&pool->allocator, pool->active);
+
+    memset(pool, 0, sizeof(*pool));
+}
+
+int32_t lsrac_pool_add_stream(lsrac_pool_t * pool, uint32_t * stream_index)
+{
+    if (pool == nullptr ||
+        pool->active == nullptr ||
+        stream_index == nullptr) {
+        return LSRAC_RET_VAL_ARGUMENT_ERROR;
+    }
+
+    for (uint32_t lane = 0; lane < pool->capacity; ++lane) {
+        if (pool->active[lane]) {
+            continue;
+        }
+
+        for (uint32_t i = 0; i < pool->history_frames; ++i) {
+            pool->history[static_cast<size_t>(i) * pool->lane_stride + lane] = 0.0f;
+        }
+
+        pool->active[lane] = 1;
+        pool->active_count += 1;
+        *stream_index = lane;
+
+        return LSRAC_RET_VAL_OK;
+    }
+
+    return LSRAC_RET_VAL_ERROR;
+}
+
+int32_t lsrac_pool_remove_stream(lsrac_pool_t * pool, uint32_t stream_index)
+{
+    if (pool == nullptr ||
+        pool->active == nullptr ||
+        stream_index >= pool->capacity ||
+        !pool->active[stream_index]) {
+        return LSRAC_RET_VAL_ARGUMENT_ERROR;
+    }
+
+    pool->active[stream_index] = 0;
+    pool->active_count -= 1;
+
+    return LSRAC_RET_VAL_OK;
+}
+
+uint64_t lsrac_pool_max_dst_frames(const lsrac_pool_t * pool)
+{
+    const lsrac_plan_t * plan = pool->plan;
+    return (static_cast<uint64_t>(pool->block_frames) * plan->dst_rate + plan->src_rate - 1) / plan->src_rate + 1;
+}
+
+// acc[i] += c * row[i] for n samples, n a multiple of LSRAC__POOL_LANES.
+static inline void lsrac__pool_accumulate(float * acc, const float * row, float c, uint32_t n)
+{
+#if defined(LSRAC__SSE)
+    __m128 cv = _mm_set1_ps(c);
+    for (uint32_t i = 0; i < n; i += 8) {
+        __m128 a0 = _mm_loadu_ps(acc + i);
+        __m128 a1 = _mm_loadu_ps(acc + i + 4);
+        a0 = _mm_add_ps(a0, _mm_mul_ps(cv, _mm_loadu_ps(row + i)));
+        a1 = _mm_add_ps(a1, _mm_mul_ps(cv, _mm_loadu_ps(row + i + 4)));
+        _mm_storeu_ps(acc + i, a0);
+        _mm_storeu_ps(acc + i + 4, a1);
+    }
+#elif defined(LSRAC__NEON)
+    float32x4_t cv = vdupq_n_f32(c);
+    for (uint32_t i = 0; i < n; i += 8) {
+        vst1q_f32(acc + i,     vmlaq_f32(vld1q_f32(acc + i),     cv, vld1q_f32(row + i)));
+        vst1q_f32(acc + i + 4, vmlaq_f32(vld1q_f32(acc + i + 4), cv, vld1q_f32(row + i + 4)));
+    }
+#else
+    for (uint32_t i = 0; i < n; ++i) {
+        acc[i] += c * row[i];
+    }
+#endif
+}
+
+int32_t lsrac_pool_process_all(
+        lsrac_pool_t *         pool,
+        float * const *        dst_data,
+        const float * const *  src_data,
+        uint64_t *             dst_frames_written)
+{
+    if (dst_frames_written != nullptr) {
+        *dst_frames_written = 0;
+    }
+
+    if (pool == nullptr ||
+        pool->history == nullptr ||
+        dst_data == nullptr ||
+        src_data == nullptr) {
+        return LSRAC_RET_VAL_ARGUMENT_ERROR;
+    }
+
+    const lsrac_plan_t * plan = pool->plan;
+    uint32_t lane_stride = pool->lane_stride;
+
+    {
+        // Transpose the new block into the history, one row per source frame
+        float * rows = pool->history + static_cast<size_t>(pool->history_frames) * lane_stride;
+
+        memset(rows, 0, sizeof(float) * lane_stride * pool->block_frames);
+
+        for (uint32_t lane = 0; lane < pool->capacity; ++lane) {
+            const float * src = src_data[lane];
+            if (!pool->active[lane] || src == nullptr) {
+                continue;
+            }
+            for (uint32_t i = 0; i < pool->block_frames; ++i) {
+                rows[static_cast<size_t>(i) * lane_stride + lane] = src[i];
+            }
+        }
+
+        pool->history_frames += pool->block_frames;
+    }
+
+    uint64_t two_dst = 2 * static_cast<uint64_t>(plan->dst_rate);
+    uint64_t two_src = 2 * static_cast<uint64_t>(plan->src_rate);
+
+    int64_t end_valid = pool->history_first + pool->history_frames;
+
+    uint64_t written = 0;
+
+    LSRAC__STATS_START(filter_start);
+
+    while (pool->src_pos_int + plan->half_width < end_valid) {
+
+        // One set of filter coefficients is shared by every stream in the pool
+        const float * taps = pool->taps;
+        int64_t left_taps;
+        int64_t right_taps;
+        float normalization_value = 0.0f;
+
+        if (plan->phases != nullptr) {
+            const lsrac_phase_t * entry = plan->phases + pool->phase;
+
+            taps                = plan->phase_taps + static_cast<size_t>(pool->phase) * plan->phase_stride;
+            left_taps           = entry->left_taps;
+            right_taps          = entry->right_taps;
+            normalization_value = entry->normalization;
+        } else {
+            uint64_t left_fx = (pool->src_pos_frac * plan->filter_step_fx) / two_dst;
+            uint64_t right_fx = plan->filter_step_fx - left_fx;
+
+            left_taps = lsrac__taps_in_filter(plan, left_fx);
+            right_taps = lsrac__taps_in_filter(plan, right_fx);
+            normalization_value = lsrac__compute_taps(plan, left_fx, pool->taps, left_taps, right_taps);
+        }
+
+        float normalization_factor = 1.0f / normalization_value;
+
+        LSRAC__STATS_ADD(interior_taps, (left_taps + right_taps) * pool->active_count);
+
+        memset(pool->accumulators, 0, sizeof(float) * lane_stride);
+
+        const float * center = pool->history + static_cast<size_t>(pool->src_pos_int - pool->history_first) * lane_stride;
+
+        for (int64_t k = 0; k < left_taps; ++k) {
+            lsrac__pool_accumulate(pool->accumulators, center - k * lane_stride, taps[k], lane_stride);
+        }
+        for (int64_t k = 0; k < right_taps; ++k) {
+            lsrac__pool_accumulate(pool->accumulators, center + (k + 1) * lane_stride, taps[left_taps + k], lane_stride);
+        }
+
+        for (uint32_t lane = 0; lane < pool->capacity; ++lane) {
+            if (pool->active[lane]) {
+                dst_data[lane][written] = pool->accumulators[lane] * normalization_factor;
+            }
+        }
+
+        written += 1;
+
+        if (plan->phases != nullptr) {
+            pool->src_pos_int += plan->phases[pool->phase].advance;
+        } else {
+            pool->src_pos_frac += two_src;
+            pool->src_pos_int  += static_cast<int64_t>(pool->src_pos_frac / two_dst);
+            pool->src_pos_frac %= two_dst;
+        }
+
+        pool->phase = pool->phase + 1 == plan->dst_rate ? 0 : pool->phase + 1;
+    }
+
+    LSRAC__STATS_SINCE(interior_ticks, filter_start);
+    LSRAC__STATS_ADD(calls, 1);
+    LSRAC__STATS_ADD(src_frames, static_cast<uint64_t>(pool->block_frames) * pool->active_count);
+    LSRAC__STATS_ADD(dst_frames, written * pool->active_count);
+
+    {
+        // Drop the rows no future output frame reaches
+        int64_t discard = pool->src_pos_int - plan->half_width - pool->history_first;
+
+        if (discard > 0) {
+            uint32_t remaining = pool->history_frames - static_cast<uint32_t>(discard);
+            memmove(pool->history, pool->history + static_cast<size_t>(discard) * lane_stride, sizeof(float) * lane_stride * remaining);
+            pool->history_frames = remaining;
+            pool->history_first += discard;
+        }
+    }
+
+    if (dst_frames_written != nullptr) {
+        *dst_frames_written = written;
+    }
+
+    return LSRAC_RET_VAL_OK;
+}
+
+// The coefficients are listed once and expanded into both the float and the double table
+#define LSRAC__FILTER_COEFFICIENTS(X) \
+    X( 8.31472372954840555082e-01) \
+    X( 8.31414005540308198583e-01) \
+    X( 8.31238918266223869580e-01) \
+    X( 8.30947156036480505392e-01) \
+    X( 8.30538793675450581766e-01) \
+    X( 8.30013935904800659316e-01) \
+    X( 8.29372717311066987023e-01) \
+    X( 8.28615302303967515840e-01) \
+    X( 8.27741885065490623496e-01) \
+    X( 8.26752689489751890761e-01) \
+    X( 8.25647969113678215081e-01) \
+    X( 8.24428007038499943704e-01) \
+    X( 8.23093115842108757896e-01) \
+    X( 8.21643637482293187624e-01) \
+    X( 8.20079943190897053817e-01) \
+    X( 8.18402433358933589780e-01) \
+    X( 8.16611537412689103554e-01) \
+    X( 8.14707713680854150873e-01) \
+    X( 8.12691449252757824873e-01) \
+    X( 8.10563259827706050764e-01) \
+    X( 8.08323689555523805517e-01) \
+    X( 8.05973310868314363198e-01) \
+    X( 8.03512724303517833491e-01) \
+    X( 8.00942558318331943035e-01) \
+    X( 7.98263469095534694553e-01) \
+    X( 7.95476140340800830231e-01) \
+    X( 7.92581283071560838138e-01) \
+    X( 7.89579635397499868255e-01) \
+    X( 7.86471962292734527722e-01) \
+    X( 7.83259055359786127148e-01) \
+    X( 7.79941732585400893107e-01) \
+    X( 7.76520838088307852054e-01) \
+    X( 7.72997241859018080490e-01) \
+    X( 7.69371839491718167992e-01) \
+    X( 7.65645551908390675777e-01) \
+    X( 7.61819325075220210586e-01) \
+    X( 7.57894129711408459649e-01) \
+    X( 7.53870960990470018181e-01) \
+    X( 7.49750838234153449413e-01) \
+    X( 7.45534804599028211314e-01) \
+    X( 7.41223926755909090502e-01) \
+    X( 7.36819294562192195208e-01) \
+    X( 7.32322020727209643809e-01) \
+    X( 7.27733240470738174110e-01) \
+    X( 7.23054111174766811487e-01) \
+    X( 7.18285812028632841830e-01) \
+    X( 7.13429543667664534112e-01) \
+    X( 7.08486527805442301009e-01) \
+    X( 7.03458006859804640953e-01) \
+    X( 6.98345243572719653891e-01) \
+    X( 6.93149520624175785599e-01) \
+    X( 6.87872140240182283755e-01) \
+    X( 6.82514423795047564525e-01) \
+    X( 6.77077711408058502407e-01) \
+    X( 6.71563361534684655219e-01) \
+    X( 6.65972750552474845875e-01) \
+    X( 6.60307272341742135247e-01) \
+    X( 6.54568337861228477514e-01) \
+    X( 6.48757374718860524432e-01) \
+    X( 6.42875826737744904271e-01) \
+    X( 6.36925153517562181449e-01) \
+    X( 6.30906829991492501541e-01) \
+    X( 6.24822345978837789815e-01) \
+    X( 6.18673205733470954470e-01) \
+    X( 6.12460927488293727095e-01) \
+    X( 6.06187042995817604307e-01) \
+    X( 5.99853097065060292259e-01) \
+    X( 5.93460647094893878339e-01) \
+    X( 5.87011262603992944875e-01) \
+    X( 5.80506524757569142281e-01) \
+    X( 5.73948025891025337408e-01) \
+    X( 5.67337369030688098981e-01) \
+    X( 5.60676167411809700525e-01) \
+    X( 5.53966043993961543279e-01) \
+    X( 5.47208630974010734604e-01) \
+    X( 5.40405569296826038261e-01) \
+    X( 5.33558508163880174102e-01) \
+    X( 5.26669104539922661168e-01) \
+    X( 5.19739022657876970079e-01) \
+    X( 5.12769933522119303326e-01) \
+    X( 5.05763514410336290084e-01) \
+    X( 4.98721448374081555155e-01) \
+    X( 4.91645423738241937883e-01) \
+    X( 4.84537133599546865348e-01) \
+    X( 4.77398275324308896117e-01) \
+    X( 4.70230550045545592219e-01) \
+    X( 4.63035662159660077464e-01) \
+    X( 4.55815318822846149427e-01) \
+    X( 4.48571229447379538069e-01) \
+    X( 4.41305105197960123586e-01) \
+    X( 4.34018658488283970431e-01) \
+    X( 4.26713602477997000495e-01) \
+    X( 4.19391650570203500248e-01) \
+    X( 4.12054515909689722530e-01) \
+    X( 4.04703910882034223473e-01) \
+    X( 3.97341546613763640927e-01) \
+    X( 3.89969132473721613596e-01) \
+    X( 3.82588375575806771689e-01) \
+    X( 3.75200980283257823356e-01) \
+    X( 3.67808647714624070701e-01) \
+    X( 3.60413075251609871241e-01) \
+    X( 3.53015956048925771960e-01) \
+    X( 3.45618978546330835044e-01) \
+    X( 3.38223825983006376461e-01) \
+    X( 3.30832175914426429575e-01) \
+    X( 3.23445699731881031180e-01) \
+    X( 3.16066062184803764357e-01) \
+    X( 3.08694920906066150312e-01) \
+    X( 3.01333925940378832831e-01) \
+    X( 2.93984719275965256102e-01) \
+    X( 2.86648934379644393378e-01) \
+    X( 2.79328195735489559492e-01) \
+    X( 2.72024118387182545220e-01) \
+    X( 2.64738307484245039003e-01) \
+    X( 2.57472357832259801658e-01) \
+    X( 2.50227853447243409057e-01) \
+    X( 2.43006367114305704691e-01) \
+    X( 2.35809459950733935063e-01) \
+    X( 2.28638680973647728800e-01) \
+    X( 2.21495566672345989279e-01) \
+    X( 2.14381640585498134399e-01) \
+    X( 2.07298412883298144305e-01) \
+    X( 2.00247379954717363848e-01) \
+    X( 1.93230023999986955108e-01) \
+    X( 1.86247812628430653437e-01) \
+    X( 1.79302198461779749294e-01) \
+    X( 1.72394618743085786816e-01) \
+    X( 1.65526494951356295537e-01) \
+    X( 1.58699232422028796430e-01) \
+    X( 1.51914219973401071195e-01) \
+    X( 1.45172829539132269838e-01) \
+    X( 1.38476415806921215879e-01) \
+    X( 1.31826315863480453272e-01) \
+    X( 1.25223848845901208904e-01) \
+    X( 1.18670315599523901184e-01) \
+    X( 1.12166998342411894374e-01) \
+    X( 1.05715160336527447260e-01) \
+    X( 9.93160455657086521652e-02) \
+    X( 9.29708784205405536216e-02) \
+    X( 8.66808633902153846673e-02) \
+    X( 8.04471847614677826321e-02) \
+    X( 7.42710063246745516574e-02) \
+    X( 6.81534710872001986415e-02) \
+    X( 6.20957009940759641076e-02) \
+    X( 5.60987966560835549235e-02) \
+    X( 5.01638370853247708703e-02) \
+    X( 4.42918794383505357026e-02) \
+    X( 3.84839587669171534490e-02) \
+    X( 3.27410877764400740086e-02) \
+    X( 2.70642565922108620236e-02) \
+    X( 2.14544325334371267788e-02) \
+    X( 1.59125598951669576520e-02) \
+    X( 1.04395597381551803740e-02) \
+    X( 5.03632968672305773861e-03) \
+    X(-2.96256265336385191805e-04) \
+    X(-5.55734794075828358179e-03) \
+    X(-1.07461191566687631893e-02) \
+    X(-1.58617678942645466689e-02) \
+    X(-2.09035164602743607498e-02) \
+    X(-2.58706116401622790435e-02) \
+    X(-3.07623248430414844568e-02) \
+    X(-3.55779522382659724178e-02) \
+    X(-4.03168148836769782428e-02) \
+    X(-4.49782588454727128013e-02) \
+    X(-4.95616553096875425699e-02) \
+    X(-5.40664006852556791594e-02) \
+    X(-5.84919166986474642345e-02) \
+    X(-6.28376504800633867154e-02) \
+    X(-6.71030746411782619276e-02) \
+    X(-7.12876873444269476554e-02) \
+    X(-7.53910123638282386738e-02) \
+    X(-7.94125991373483691715e-02) \
+    X(-8.33520228108008270906e-02) \
+    X(-8.72088842732959695914e-02) \
+    X(-9.09828101842390379872e-02) \
+    X(-9.46734529918955292072e-02) \
+    X(-9.82804909435327500589e-02) \
+    X(-1.01803628087157427284e-01) \
+    X(-1.05242594264867719844e-01) \
+    X(-1.08597145097841310535e-01) \
+    X(-1.11867061962988789681e-01) \
+    X(-1.15052151961296145188e-01) \
+    X(-1.18152247877890054228e-01) \
+    X(-1.21167208133862752684e-01) \
+    X(-1.24096916729885473063e-01) \
+    X(-1.26941283181660202750e-01) \
+    X(-1.29700242447243679900e-01) \
+    X(-1.32373754846295377252e-01) \
+    X(-1.34961805971292009287e-01) \
+    X(-1.37464406590764143257e-01) \
+    X(-1.39881592544604443917e-01) \
+    X(-1.42213424631507739937e-01) \
+    X(-1.44459988488595730827e-01) \
+    X(-1.46621394463294696386e-01) \
+    X(-1.48697777477524800682e-01) \
+    X(-1.50689296884269657850e-01) \
+    X(-1.52596136316595465399e-01) \
+    X(-1.54418503529190731527e-01) \
+    X(-1.56156630232500315270e-01) \
+    X(-1.57810771919529219121e-01) \
+    X(-1.59381207685401427021e-01) \
+    X(-1.60868240039743037872e-01) \
+    X(-1.62272194711985145998e-01) \
+    X(-1.63593420449666626659e-01) \
+    X(-1.64832288809824062392e-01) \
+    X(-1.65989193943563151379e-01) \
+    X(-1.67064552373901109572e-01) \
+    X(-1.68058802766975601273e-01) \
+    X(-1.68972405696717037360e-01) \
+    X(-1.69805843403086798027e-01) \
+    X(-1.70559619543971530131e-01) \
+    X(-1.71234258940853617537e-01) \
+    X(-1.71830307318344255307e-01) \
+    X(-1.72348331037702334756e-01) \
+    X(-1.72788916824434257702e-01) \
+    X(-1.73152671490098081231e-01) \
+    X(-1.73440221648409775845e-01) \
+    X(-1.73652213425782242506e-01) \
+    X(-1.73789312166397952319e-01) \
+    X(-1.73852202131942051855e-01) \
+    X(-1.73841586196111674845e-01) \
+    X(-1.73758185534021086793e-01) \
+    X(-1.73602739306629005878e-01) \
+    X(-1.73376004340306061335e-01) \
+    X(-1.73078754801670009478e-01) \
+    X(-1.72711781867818603420e-01) \
+    X(-1.72275893392080048372e-01) \
+    X(-1.71771913565416961545e-01) \
+    X(-1.71200682573611373538e-01) \
+    X(-1.70563056250360139954e-01) \
+    X(-1.69859905726417126370e-01) \
+    X(-1.69092117074913228514e-01) \
+    X(-1.68260590952989147473e-01) \
+    X(-1.67366242239875284703e-01) \
+    X(-1.66409999671557895518e-01) \
+    X(-1.65392805472166642966e-01) \
+    X(-1.64315614982222552021e-01) \
+    X(-1.63179396283883837437e-01) \
+    X(-1.61985129823331186483e-01) \
+    X(-1.60733808030429803360e-01) \
+    X(-1.59426434935813571281e-01) \
+    X(-1.58064025785527417778e-01) \
+    X(-1.56647606653372045704e-01) \
+    X(-1.55178214051094831571e-01) \
+    X(-1.53656894536566474008e-01) \
+    X(-1.52084704320088470730e-01) \
+    X(-1.50462708868975059140e-01) \
+    X(-1.48791982510548842500e-01) \
+    X(-1.47073608033699704256e-01) \
+    X(-1.45308676289147314931e-01) \
+    X(-1.43498285788550977715e-01) \
+    X(-1.41643542302611558092e-01) \
+    X(-1.39745558458309881988e-01) \
+    X(-1.37805453335422323224e-01) \
+    X(-1.35824352062461073398e-01) \
+    X(-1.33803385412180564362e-01) \
+    X(-1.31743689396791985313e-01) \
+    X(-1.29646404863030306753e-01) \
+    X(-1.27512677087215337002e-01) \
+    X(-1.25343655370452389253e-01) \
+    X(-1.23140492634104758984e-01) \
+    X(-1.20904345015691472298e-01) \
+    X(-1.18636371465341922127e-01) \
+    X(-1.16337733342949820048e-01) \
+    X(-1.14009594016166518338e-01) \
+    X(-1.11653118459372716065e-01) \
+    X(-1.09269472853762789066e-01) \
+    X(-1.06859824188683741331e-01) \
+    X(-1.04425339864360325337e-01) \
+    X(-1.01967187296145456177e-01) \
+    X(-9.94865335204263567803e-02) \
+    X(-9.69845448023236023083e-02) \
+    X(-9.44623862453117940641e-02) \
+    X(-9.19212214028948121358e-02) \
+    X(-8.93622118924671249296e-02) \
+    X(-8.67865170114848205607e-02) \
+    X(-8.41952933560805999447e-02) \
+    X(-8.15896944422443981537e-02) \
+    X(-7.89708703296961439522e-02) \
+    X(-7.63399672485739477779e-02) \
+    X(-7.36981272290610500697e-02) \
+    X(-7.10464877340710454501e-02) \
+    X(-6.83861812951113146042e-02) \
+    X(-6.57183351514422919859e-02) \
+    X(-6.30440708926501142129e-02) \
+    X(-6.03645041047437408421e-02) \
+    X(-5.76807440198948140342e-02) \
+    X(-5.49938931699267691267e-02) \
+    X(-5.23050470436661057994e-02) \
+    X(-4.96152937482609926456e-02) \
+    X(-4.69257136745778041798e-02) \
+    X(-4.42373791667729082677e-02) \
+    X(-4.15513541961495605492e-02) \
+    X(-3.88686940393953503370e-02) \
+    X(-3.61904449613011935938e-02) \
+    X(-3.35176439020573244121e-02) \
+    X(-3.08513181692228674602e-02) \
+    X(-2.81924851344595717162e-02) \
+    X(-2.55421519351213023585e-02) \
+    X(-2.29013151807887539724e-02) \
+    X(-2.02709606648342685609e-02) \
+    X(-1.76520630811025022733e-02) \
+    X(-1.50455857457888787787e-02) \
+    X(-1.24524803245954687053e-02) \
+    X(-9.87368656524285036313e-03) \
+    X(-7.31013203541311037958e-03) \
+    X(-4.76273186619807602227e-03) \
+    X(-2.23238850112297869746e-03) \
+    X( 2.80008549183706099625e-04) \
+    X( 2.77358294660976899965e-03) \
+    X( 5.24747175940274562800e-03) \
+    X( 7.70082569017439908660e-03) \
+    X( 1.01328092980087648006e-02) \
+    X( 1.25426012146140665460e-02) \
+    X( 1.49293943544662570388e-02) \
+    X( 1.72923961188884665885e-02) \
+    X( 1.96308285940195309527e-02) \
+    X( 2.19439287426209730936e-02) \
+    X( 2.42309485896793734561e-02) \
+    X( 2.64911554017603391442e-02) \
+    X( 2.87238318600733545660e-02) \
+    X( 3.09282762272103349532e-02) \
+    X( 3.31038025075217068327e-02) \
+    X( 3.52497406010981520486e-02) \
+    X( 3.73654364513253609004e-02) \
+    X( 3.94502521859858221176e-02) \
+    X( 4.15035662518817155542e-02) \
+    X( 4.35247735429537541130e-02) \
+    X( 4.55132855218787699125e-02) \
+    X( 4.74685303351244439196e-02) \
+    X( 4.93899529214478216765e-02) \
+    X( 5.12770151138242716304e-02) \
+    X( 5.31291957347935772660e-02) \
+    X( 5.49459906852194576721e-02) \
+    X( 5.67269130264521220797e-02) \
+    X( 5.84714930558940249039e-02) \
+    X( 6.01792783759655322551e-02) \
+    X( 6.18498339564735599705e-02) \
+    X( 6.34827421903864652641e-02) \
+    X( 6.50776029430226859995e-02) \
+    X( 6.66340335946605799577e-02) \
+    X( 6.81516690765814614483e-02) \
+    X( 6.96301619005592065115e-02) \
+    X( 7.10691821818139612965e-02) \
+    X( 7.24684176554465098175e-02) \
+    X( 7.38275736863740761340e-02) \
+    X( 7.51463732727930683319e-02) \
+    X( 7.64245570431912463194e-02) \
+    X( 7.76618832469397474272e-02) \
+    X( 7.88581277384926976337e-02) \
+    X( 8.00130839552289779837e-02) \
+    X( 8.11265628889681067459e-02) \
+    X( 8.21983930512013155623e-02) \
+    X( 8.32284204320703352442e-02) \
+    X( 8.42165084531432683868e-02) \
+    X( 8.51625379140240473808e-02) \
+    X( 8.60664069328434949702e-02) \
+    X( 8.69280308806818224898e-02) \
+    X( 8.77473423099686122839e-02) \
+    X( 8.85242908769151987114e-02) \
+    X( 8.92588432580306151420e-02) \
+    X( 8.99509830607803234637e-02) \
+    X( 9.06007107284422380511e-02) \
+    X( 9.12080434392217309636e-02) \
+    X( 9.17730149996878741270e-02) \
+    X( 9.22956757325926607782e-02) \
+    X( 9.27760923591415126443e-02) \
+    X( 9.32143478757788968014e-02) \
+    X( 9.36105414255621187669e-02) \
+    X( 9.39647881641913207407e-02) \
+    X( 9.42772191207702781046e-02) \
+    X( 9.45479810533706027664e-02) \
+    X( 9.47772362994778183598e-02) \
+    X( 9.49651626213951355338e-02) \
+    X( 9.51119530466846413441e-02) \
+    X( 9.52178157037280176178e-02) \
+    X( 9.52829736524876819148e-02) \
+    X( 9.53076647105531166160e-02) \
+    X( 9.52921412745576373871e-02) \
+    X( 9.52366701370536278271e-02) \
+    X( 9.51415322989309503177e-02) \
+    X( 9.50070227774735681647e-02) \
+    X( 9.48334504101390751707e-02) \
+    X( 9.46211376541590265532e-02) \
+    X( 9.43704203820504156086e-02) \
+    X( 9.40816476731309581094e-02) \
+    X( 9.37551816011396865758e-02) \
+    X( 9.33913970180541563870e-02) \
+    X( 9.29906813342047527948e-02) \
+    X( 9.25534342947849225647e-02) \
+    X( 9.20800677528557931506e-02) \
+    X( 9.15710054389489019888e-02) \
+    X( 9.10266827273659706599e-02) \
+    X( 9.04475463992783224043e-02) \
+    X( 8.98340544027328158361e-02) \
+    X( 8.91866756096650198371e-02) \
+    X( 8.85058895700238101867e-02) \
+    X( 8.77921862631190763615e-02) \
+    X( 8.70460658462897246546e-02) \
+    X( 8.62680384010083983748e-02) \
+    X( 8.54586236765221690659e-02) \
+    X( 8.46183508311429133375e-02) \
+    X( 8.37477581712920277068e-02) \
+    X( 8.28473928884114751980e-02) \
+    X( 8.19178107938471483651e-02) \
+    X( 8.09595760518180135312e-02) \
+    X( 7.99732609105757996648e-02) \
+    X( 7.89594454318716387764e-02) \
+    X( 7.79187172188340326784e-02) \
+    X( 7.68516711423724852015e-02) \
+    X( 7.57589090662164482692e-02) \
+    X( 7.46410395707000073884e-02) \
+    X( 7.34986776754032733461e-02) \
+    X( 7.23324445607601979047e-02) \
+    X( 7.11429672887474440213e-02) \
+    X( 6.99308785227581580779e-02) \
+    X( 6.86968162467783832748e-02) \
+    X( 6.74414234839716131287e-02) \
+    X( 6.61653480147834510694e-02) \
+    X( 6.48692420946761771905e-02) \
+    X( 6.35537621716019962559e-02) \
+    X( 6.22195686033254202751e-02) \
+    X( 6.08673253747022482973e-02) \
+    X( 5.94976998150253330588e-02) \
+    X( 5.81113623155428762890e-02) \
+    X( 5.67089860472591994478e-02) \
+    X( 5.52912466791220663653e-02) \
+    X( 5.38588220967053943333e-02) \
+    X( 5.24123921214928872869e-02) \
+    X( 5.09526382308646275110e-02) \
+    X( 4.94802432788957607945e-02) \
+    X( 4.79958912180662375380e-02) \
+    X( 4.65002668219884549017e-02) \
+    X( 4.49940554092515265783e-02) \
+    X( 4.34779425684853407241e-02) \
+    X( 4.19526138847447563340e-02) \
+    X( 4.04187546673120054463e-02) \
+    X( 3.88770496790168534895e-02) \
+    X( 3.73281828671714888124e-02) \
+    X( 3.57728370962169389680e-02) \
+    X( 3.42116938821758476141e-02) \
+    X( 3.26454331290065291604e-02) \
+    X( 3.10747328669506231447e-02) \
+    X( 2.95002689929673225788e-02) \
+    X( 2.79227150133440210622e-02) \
+    X( 2.63427417885741359249e-02) \
+    X( 2.47610172805882329528e-02) \
+    X( 2.31782063024293799591e-02) \
+    X( 2.15949702704538760989e-02) \
+    X( 2.00119669591453143431e-02) \
+    X( 1.84298502586232419709e-02) \
+    X( 1.68492699349288496680e-02) \
+    X( 1.52708713931675090641e-02) \
+    X( 1.36952954435869880129e-02) \
+    X( 1.21231780706691841254e-02) \
+    X( 1.05551502053105091677e-02) \
+    X( 8.99183750016553651196e-03) \
+    X( 7.43386010822696258193e-03) \
+    X( 5.88183246471273707412e-03) \
+    X( 4.33636307232945251988e-03) \
+    X( 2.79805428998205086427e-03) \
+    X( 1.26750212499337003291e-03) \
+    X(-2.54703971099550386531e-04) \
+    X(-1.76798130311027175757e-03) \
+    X(-3.27175412906725469539e-03) \
+    X(-4.76545385331804925710e-03) \
+    X(-6.24851921581533794464e-03) \
+    X(-7.72039647752874400727e-03) \
+    X(-9.18053960192777122884e-03) \
+    X(-1.06284104324833178490e-02) \
+    X(-1.20634788661366718077e-02) \
+    X(-1.34852230226875247771e-02) \
+    X(-1.48931294100519973078e-02) \
+    X(-1.62866930853476296615e-02) \
+    X(-1.76654178117594401476e-02) \
+    X(-1.90288162111466874205e-02) \
+    X(-2.03764099123495759369e-02) \
+    X(-2.17077296951579609696e-02) \
+    X(-2.30223156299061669505e-02) \
+    X(-2.43197172126588360974e-02) \
+    X(-2.55994934959561624976e-02) \
+    X(-2.68612132150869431513e-02) \
+    X(-2.81044549098614510063e-02) \
+    X(-2.93288070418574950415e-02) \
+    X(-3.05338681071131295974e-02) \
+    X(-3.17192467442452205595e-02) \
+    X(-3.28845618379712614776e-02) \
+    X(-3.40294426180154721551e-02) \
+    X(-3.51535287533818185945e-02) \
+    X(-3.62564704419792716017e-02) \
+    X(-3.73379284955845242022e-02) \
+    X(-3.83975744201309962533e-02) \
+    X(-3.94350904913155775322e-02) \
+    X(-4.04501698255130062720e-02) \
+    X(-4.14425164459938585870e-02) \
+    X(-4.24118453444415760556e-02) \
+    X(-4.33578825377650758921e-02) \
+    X(-4.42803651202084772032e-02) \
+    X(-4.51790413107587551789e-02) \
+    X(-4.60536704958539877541e-02) \
+    X(-4.69040232673985507672e-02) \
+    X(-4.77298814560914094751e-02) \
+    X(-4.85310381600771723054e-02) \
+    X(-4.93072977689298017068e-02) \
+    X(-5.00584759829825892696e-02) \
+    X(-5.07843998280173986037e-02) \
+    X(-5.14849076653303427964e-02) \
+    X(-5.21598491971914657306e-02) \
+    X(-5.28090854677170859488e-02) \
+    X(-5.34324888591782357072e-02) \
+    X(-5.40299430837655400572e-02) \
+    X(-5.46013431708381041796e-02) \
+    X(-5.51465954496810906171e-02) \
+    X(-5.56656175277993395256e-02) \
+    X(-5.61583382647804357779e-02) \
+    X(-5.66246977417538960298e-02) \
+    X(-5.70646472264832865795e-02) \
+    X(-5.74781491341238848225e-02) \
+    X(-5.78651769836829588112e-02) \
+    X(-5.82257153502198851469e-02) \
+    X(-5.85597598128258789441e-02) \
+    X(-5.88673168984241990120e-02) \
+    X(-5.91484040214318093631e-02) \
+    X(-5.94030494193287308957e-02) \
+    X(-5.96312920841784027681e-02) \
+    X(-5.98331816901454746627e-02) \
+    X(-6.00087785170606569096e-02) \
+    X(-6.01581533700810480725e-02) \
+    X(-6.02813874954959694197e-02) \
+    X(-6.03785724927326447609e-02) \
+    X(-6.04498102226119424230e-02) \
+    X(-6.04952127119116611631e-02) \
+    X(-6.05149020542914278797e-02) \
+    X(-6.05090103076376881197e-02) \
+    X(-6.04776793878847099273e-02) \
+    X(-6.04210609593744951695e-02) \
+    X(-6.03393163218124903291e-02) \
+    X(-6.02326162938837256222e-02) \
+    X(-6.01011410935896536745e-02) \
+    X(-5.99450802153716350018e-02) \
+    X(-5.97646323040843391317e-02) \
+    X(-5.95600050258849322837e-02) \
+    X(-5.93314149361059764431e-02) \
+    X(-5.90790873441773764507e-02) \
+    X(-5.88032561756684640786e-02) \
+    X(-5.85041638315173181950e-02) \
+    X(-5.81820610445198463379e-02) \
+    X(-5.78372067331465664064e-02) \
+    X(-5.74698678527617162759e-02) \
+    X(-5.70803192443151696800e-02) \
+    X(-5.66688434805820984153e-02) \
+    X(-5.62357307100216502471e-02) \
+    X(-5.57812784983319834287e-02) \
+    X(-5.53057916677746758127e-02) \
+    X(-5.48095821343453915020e-02) \
+    X(-5.42929687428649263015e-02) \
+    X(-5.37562771000702349644e-02) \
+    X(-5.31998394057807341695e-02) \
+    X(-5.26239942822169029513e-02) \
+    X(-5.20290866015511582754e-02) \
+    X(-5.14154673117670768523e-02) \
+    X(-5.07834932609073572141e-02) \
+    X(-5.01335270197884388943e-02) \
+    X(-4.94659367032617980353e-02) \
+    X(-4.87810957901005926018e-02) \
+    X(-4.80793829415919610204e-02) \
+    X(-4.73611818189140221236e-02) \
+    X(-4.66268808993793651418e-02) \
+    X(-4.58768732916221277929e-02) \
+    X(-4.51115565498113532672e-02) \
+    X(-4.43313324869706107401e-02) \
+    X(-4.35366069874822472774e-02) \
+    X(-4.27277898188581847783e-02) \
+    X(-4.19052944428566706558e-02) \
+    X(-4.10695378260253277092e-02) \
+    X(-4.02209402497498702544e-02) \
+    X(-3.93599251198885058400e-02) \
+    X(-3.84869187760717781921e-02) \
+    X(-3.76023503007467674308e-02) \
+    X(-3.67066513280452297319e-02) \
+    X(-3.58002558525536487832e-02) \
+    X(-3.48836000380640318119e-02) \
+    X(-3.39571220263849699039e-02) \
+    X(-3.30212617462878818553e-02) \
+    X(-3.20764607226682249563e-02) \
+    X(-3.11231618859974003277e-02) \
+    X(-3.01618093821427596390e-02) \
+    X(-2.91928483826300218251e-02) \
+    X(-2.82167248954252464221e-02) \
+    X(-2.72338855763107207109e-02) \
+    X(-2.62447775409285488646e-02) \
+    X(-2.52498481775659533444e-02) \
+    X(-2.42495449607560524530e-02) \
+    X(-2.32443152657647901516e-02) \
+    X(-2.22346061840382018537e-02) \
+    X(-2.12208643396787077773e-02) \
+    X(-2.02035357070221716080e-02) \
+    X(-1.91830654293842946256e-02) \
+    X(-1.81598976390459701524e-02) \
+    X(-1.71344752785447841659e-02) \
+    X(-1.61072399233397958729e-02) \
+    X(-1.50786316059164128556e-02) \
+    X(-1.40490886413957953571e-02) \
+    X(-1.30190474547137412242e-02) \
+    X(-1.19889424094323342185e-02) \
+    X(-1.09592056382471266657e-02) \
+    X(-9.93026687525074697183e-03) \
+    X(-8.90255329001433948211e-03) \
+    X(-7.87648932354562125724e-03) \
+    X(-6.85249652618241146540e-03) \
+    X(-5.83099339747908569642e-03) \
+    X(-4.81239522814202146106e-03) \
+    X(-3.79711394406930576734e-03) \
+    X(-2.78555795254968683455e-03) \
+    X(-1.77813199067227692071e-03) \
+    X(-7.75236976000132386663e-04) \
+    X( 2.22730140442126654798e-04) \
+    X( 1.21537651881706244492e-03) \
+    X( 2.20231357271108733539e-03) \
+    X( 3.18315710891246220898e-03) \
+    X( 4.15752746468348553799e-03) \
+    X( 5.12504964248380791986e-03) \
+    X( 6.08535344210042478813e-03) \
+    X( 7.03807359014245199208e-03) \
+    X( 7.98284986685961206465e-03) \
+    X( 8.91932723024580452476e-03) \
+    X( 9.84715593738785290034e-03) \
+    X( 1.07659916630240357766e-02) \
+    X( 1.16754956152756248638e-02) \
+    X( 1.25753346485176220604e-02) \
+    X( 1.34651813733560731662e-02) \
+    X( 1.43447142636787781933e-02) \
+    X( 1.52136177607511777904e-02) \
+    X( 1.60715823743268690360e-02) \
+    X( 1.69183047807457617728e-02) \
+    X( 1.77534879179936204430e-02) \
+    X( 1.85768410776981605925e-02) \
+    X( 1.93880799940382604618e-02) \
+    X( 2.01869269295435888045e-02) \
+    X( 2.09731107577651766649e-02) \
+    X( 2.17463670427963037812e-02) \
+    X( 2.25064381156266125894e-02) \
+    X( 2.32530731473125917841e-02) \
+    X( 2.39860282189490944815e-02) \
+    X( 2.47050663884288181082e-02) \
+    X( 2.54099577539762186418e-02) \
+    X( 2.61004795144461655687e-02) \
+    X( 2.67764160263764816605e-02) \
+    X( 2.74375588577874841845e-02) \
+    X( 2.80837068387202806741e-02) \
+    X( 2.87146661085097808230e-02) \
+    X( 2.93302501597869115513e-02) \
+    X( 2.99302798792087168533e-02) \
+    X( 3.05145835849139068774e-02) \
+    X( 3.10829970607048658437e-02) \
+    X( 3.16353635869560598226e-02) \
+    X( 3.21715339682534032240e-02) \
+    X( 3.26913665577675052742e-02) \
+    X( 3.31947272783659833029e-02) \
+    X( 3.36814896404726560331e-02) \
+    X( 3.41515347566807569990e-02) \
+    X( 3.46047513531298478462e-02) \
+    X( 3.50410357776568884280e-02) \
+    X( 3.54602920047340924858e-02) \
+    X( 3.58624316372060172875e-02) \
+    X( 3.62473739048404727803e-02) \
+    X( 3.66150456597097023748e-02) \
+    X( 3.69653813684179058385e-02) \
+    X( 3.72983231011940682964e-02) \
+    X( 3.76138205178691634178e-02) \
+    X( 3.79118308507581658340e-02) \
+    X( 3.81923188844700278732e-02) \
+    X( 3.84552569326661666804e-02) \
+    X( 3.87006248117945095277e-02) \
+    X( 3.89284098118221136287e-02) \
+    X( 3.91386066639944005252e-02) \
+    X( 3.93312175056476295842e-02) \
+    X( 3.95062518421033306848e-02) \
+    X( 3.96637265056755394799e-02) \
+    X( 3.98036656118202977761e-02) \
+    X( 3.99261005124597820326e-02) \
+    X( 4.00310697465144360585e-02) \
+    X( 4.01186189876763035778e-02) \
+    X( 4.01888009894591641258e-02) \
+    X( 4.02416755275608953313e-02) \
+    X( 4.02773093395744422041e-02) \
+    X( 4.02957760620868618573e-02) \
+    X( 4.02971561652026855072e-02) \
+    X( 4.02815368845340013304e-02) \
+    X( 4.02490121506946865737e-02) \
+    X( 4.01996825163432602857e-02) \
+    X( 4.01336550808131173329e-02) \
+    X( 4.00510434123766412284e-02) \
+    X( 3.99519674681838021790e-02) \
+    X( 3.98365535119223901361e-02) \
+    X( 3.97049340292425986809e-02) \
+    X( 3.95572476409943238340e-02) \
+    X( 3.93936390143226622396e-02) \
+    X( 3.92142587716682866628e-02) \
+    X( 3.90192633977227906761e-02) \
+    X( 3.88088151443859719070e-02) \
+    X( 3.85830819337740632546e-02) \
+    X( 3.83422372593309676581e-02) \
+    X( 3.80864600850902706997e-02) \
+    X( 3.78159347431409609275e-02) \
+    X( 3.75308508293468318096e-02) \
+    X( 3.72314030973733209318e-02) \
+    X( 3.69177913510723085255e-02) \
+    X( 3.65902203352790472701e-02) \
+    X( 3.62488996250740352911e-02) \
+    X( 3.58940435135636018438e-02) \
+    X( 3.55258708982338911042e-02) \
+    X( 3.51446051659309519066e-02) \
+    X( 3.47504740765239503175e-02) \
+    X( 3.43437096453047957523e-02) \
+    X( 3.39245480241803926136e-02) \
+    X( 3.34932293817127510471e-02) \
+    X( 3.30499977820627663383e-02) \
+    X( 3.25951010628938789293e-02) \
+    X( 3.21287907122915217251e-02) \
+    X( 3.16513217447548164674e-02) \
+    X( 3.11629525763171093267e-02) \
+    X( 3.06639448988514501382e-02) \
+    X( 3.01545635536184866710e-02) \
+    X( 2.96350764041116987446e-02) \
+    X( 2.91057542082603579181e-02) \
+    X( 2.85668704900414009706e-02) \
+    X( 2.80187014105628129368e-02) \
+    X( 2.74615256386703497637e-02) \
+    X( 2.68956242211381771345e-02) \
+    X( 2.63212804524964143205e-02) \
+    X( 2.57387797445546746833e-02) \
+    X( 2.51484094956766456030e-02) \
+    X( 2.45504589598617914414e-02) \
+    X( 2.39452191156906725455e-02) \
+    X( 2.33329825351894608321e-02) \
+    X( 2.27140432526683408443e-02) \
+    X( 2.20886966335908999093e-02) \
+    X( 2.14572392435271874778e-02) \
+    X( 2.08199687172471933905e-02) \
+    X( 2.01771836280079629178e-02) \
+    X( 1.95291833570884962312e-02) \
+    X( 1.88762679636269269101e-02) \
+    X( 1.82187380548123403767e-02) \
+    X( 1.75568946564845403124e-02) \
+    X( 1.68910390841945853846e-02) \
+    X( 1.62214728147774996103e-02) \
+    X( 1.55484973584896369464e-02) \
+    X( 1.48724141317607399387e-02) \
+    X( 1.41935243306124080076e-02) \
+    X( 1.35121288047925294795e-02) \
+    X( 1.28285279326754275003e-02) \
+    X( 1.21430214969758445281e-02) \
+    X( 1.14559085613274869858e-02) \
+    X( 1.07674873477713456404e-02) \
+    X( 1.00780551152029641815e-02) \
+    X( 9.38790803882408146641e-03) \
+    X( 8.69734109064560119429e-03) \
+    X( 8.00664792108640895052e-03) \
+    X( 7.31612074171312902482e-03) \
+    X( 6.62605020916498532735e-03) \
+    X( 5.93672531030635993593e-03) \
+    X( 5.24843324865020312286e-03) \
+    X( 4.56145933209378684481e-03) \
+    X( 3.87608686200798923521e-03) \
+    X( 3.19259702372048361982e-03) \
+    X( 2.51126877843176705626e-03) \
+    X( 1.83237875660391988202e-03) \
+    X( 1.15620115285868549186e-03) \
+    X( 4.83007622422852007059e-04) \
+    X(-1.86932820843070034112e-04) \
+    X(-8.53353904797455329115e-04) \
+    X(-1.51599219771675255281e-03) \
+    X(-2.17458720530792556924e-03) \
+    X(-2.82888146600037857989e-03) \
+    X(-3.47862064448672828401e-03) \
+    X(-4.12355362347965707925e-03) \
+    X(-4.76343259365718217635e-03) \
+    X(-5.39801314176371720144e-03) \
+    X(-6.02705433684159932323e-03) \
+    X(-6.65031881456398799024e-03) \
+    X(-7.26757285964317947813e-03) \
+    X(-7.87858648628854928153e-03) \
+    X(-8.48313351669007821576e-03) \
+    X(-9.08099165750268083608e-03) \
+    X(-9.67194257431004678072e-03) \
+    X(-1.02557719640449674509e-02) \
+    X(-1.08322696253466653482e-02) \
+    X(-1.14012295268339416271e-02) \
+    X(-1.19624498732761111452e-02) \
+    X(-1.25157331696445651287e-02) \
+    X(-1.30608862830260651078e-02) \
+    X(-1.35977205023845738180e-02) \
+    X(-1.41260515961539080687e-02) \
+    X(-1.46456998676501564532e-02) \
+    X(-1.51564902082884610246e-02) \
+    X(-1.56582521485937077588e-02) \
+    X(-1.61508199069943896020e-02) \
+    X(-1.66340324363880263936e-02) \
+    X(-1.71077334684716746149e-02) \
+    X(-1.75717715558275228149e-02) \
+    X(-1.80260001117568194329e-02) \
+    X(-1.84702774478586080609e-02) \
+    X(-1.89044668093441003975e-02) \
+    X(-1.93284364080869922042e-02) \
+    X(-1.97420594534034529732e-02) \
+    X(-2.01452141805614354242e-02) \
+    X(-2.05377838770183090977e-02) \
+    X(-2.09196569063852221004e-02) \
+    X(-2.12907267301215390176e-02) \
+    X(-2.16508919269584217127e-02) \
+    X(-2.20000562100566773860e-02) \
+    X(-2.23381284419012192399e-02) \
+    X(-2.26650226469371808558e-02) \
+    X(-2.29806580219539050014e-02) \
+    X(-2.32849589442222955349e-02) \
+    X(-2.35778549773940013234e-02) \
+    X(-2.38592808751701725145e-02) \
+    X(-2.41291765827496146324e-02) \
+    X(-2.43874872360661625048e-02) \
+    X(-2.46341631588262027774e-02) \
+    X(-2.48691598573592027865e-02) \
+    X(-2.50924380132932847709e-02) \
+    X(-2.53039634740697960691e-02) \
+    X(-2.55037072413113186098e-02) \
+    X(-2.56916454570593408291e-02) \
+    X(-2.58677593878966008423e-02) \
+    X(-2.60320354069717534162e-02) \
+    X(-2.61844649739453247395e-02) \
+    X(-2.63250446128731642459e-02) \
+    X(-2.64537758880496950975e-02) \
+    X(-2.65706653778289558776e-02) \
+    X(-2.66757246464459155111e-02) \
+    X(-2.67689702138592805492e-02) \
+    X(-2.68504235236379437679e-02) \
+    X(-2.69201109089152179621e-02) \
+    X(-2.69780635564342181898e-02) \
+    X(-2.70243174687087896191e-02) \
+    X(-2.70589134243261995871e-02) \
+    X(-2.70818969364167577707e-02) \
+    X(-2.70933182093176481986e-02) \
+    X(-2.70932320934577017257e-02) \
+    X(-2.70816980384915410862e-02) \
+    X(-2.70587800447114543156e-02) \
+    X(-2.70245466127663376554e-02) \
+    X(-2.69790706917171427270e-02) \
+    X(-2.69224296254590607369e-02) \
+    X(-2.68547050975419879237e-02) \
+    X(-2.67759830744198866481e-02) \
+    X(-2.66863537471611969587e-02) \
+    X(-2.65859114716531889921e-02) \
+    X(-2.64747547073322930800e-02) \
+    X(-2.63529859544745573285e-02) \
+    X(-2.62207116900796607939e-02) \
+    X(-2.60780423023825730366e-02) \
+    X(-2.59250920240284947471e-02) \
+    X(-2.57619788639449828760e-02) \
+    X(-2.55888245379471308827e-02) \
+    X(-2.54057543981124761556e-02) \
+    X(-2.52128973609604678519e-02) \
+    X(-2.50103858344739478359e-02) \
+    X(-2.47983556439997539222e-02) \
+    X(-2.45769459570643403201e-02) \
+    X(-2.43462992071435090080e-02) \
+    X(-2.41065610164222128564e-02) \
+    X(-2.38578801175844575078e-02) \
+    X(-2.36004082746693114037e-02) \
+    X(-2.33343002030331689300e-02) \
+    X(-2.30597134884559483436e-02) \
+    X(-2.27768085054302904524e-02) \
+    X(-2.24857483346725776918e-02) \
+    X(-2.21866986798954189675e-02) \
+    X(-2.18798277838799307138e-02) \
+    X(-2.15653063438876642366e-02) \
+    X(-2.12433074264517691987e-02) \
+    X(-2.09140063815867055519e-02) \
+    X(-2.05775807564556566243e-02) \
+    X(-2.02342102085360346642e-02) \
+    X(-1.98840764183222142025e-02) \
+    X(-1.95273630016047500257e-02) \
+    X(-1.91642554213670816832e-02) \
+    X(-1.87949408993371563925e-02) \
+    X(-1.84196083272362247374e-02) \
+    X(-1.80384481777610752862e-02) \
+    X(-1.76516524153425696797e-02) \
+    X(-1.72594144067167720724e-02) \
+    X(-1.68619288313498413845e-02) \
+    X(-1.64593915917550098760e-02) \
+    X(-1.60519997237402040069e-02) \
+    X(-1.56399513066264282679e-02) \
+    X(-1.52234453734734331148e-02) \
+    X(-1.48026818213531103502e-02) \
+    X(-1.43778613217079923037e-02) \
+    X(-1.39491852308316760523e-02) \
+    X(-1.35168555005115483686e-02) \
+    X(-1.30810745888681710658e-02) \
+    X(-1.26420453714316226301e-02) \
+    X(-1.21999710524887047813e-02) \
+    X(-1.17550550767402828961e-02) \
+    X(-1.13075010413035727252e-02) \
+    X(-1.08575126080952908542e-02) \
+    X(-1.04052934166326063736e-02) \
+    X(-9.95104699728536351566e-03) \
+    X(-9.49497668501652312967e-03) \
+    X(-9.03728553364356763933e-03) \
+    X(-8.57817623065582068875e-03) \
+    X(-8.11785101262214349449e-03) \
+    X(-7.65651158122056946231e-03) \
+    X(-7.19435901992488725798e-03) \
+    X(-6.73159371137851351291e-03) \
+    X(-6.26841525548942068990e-03) \
+    X(-5.80502238827697216589e-03) \
+    X(-5.34161290150089295564e-03) \
+    X(-4.87838356310490647849e-03) \
+    X(-4.41553003850264462471e-03) \
+    X(-3.95324681273798422126e-03) \
+    X(-3.49172711354636287548e-03) \
+    X(-3.03116283534747218975e-03) \
+    X(-2.57174446419663202748e-03) \
+    X(-2.11366100372138449731e-03) \
+    X(-1.65709990207213789248e-03) \
+    X(-1.20224697991074881177e-03) \
+    X(-7.49286359465203312402e-04) \
+    X(-2.98400394673150758020e-04) \
+    X( 1.50230397559290287587e-04) \
+    X( 5.96427404960260163468e-04) \
+    X( 1.04001398633389997676e-03) \
+    X( 1.48081553681653948010e-03) \
+    X( 1.91865955192711671630e-03) \
+    X( 2.35337569038958404136e-03) \
+    X( 2.78479583570576333731e-03) \
+    X( 3.21275415646031688166e-03) \
+    X( 3.63708716533605539573e-03) \
+    X( 4.05763377682291995208e-03) \
+    X( 4.47423536360066955581e-03) \
+    X( 4.88673581157838838457e-03) \
+    X( 5.29498157357465894235e-03) \
+    X( 5.69882172162047926506e-03) \
+    X( 6.09810799787139853900e-03) \
+    X( 6.49269486411187517899e-03) \
+    X( 6.88243954983998491859e-03) \
+    X( 7.26720209891677272618e-03) \
+    X( 7.64684541476874993227e-03) \
+    X( 8.02123530413159993580e-03) \
+    X( 8.39024051932213063565e-03) \
+    X( 8.75373279902990839019e-03) \
+    X( 9.11158690761618844656e-03) \
+    X( 9.46368067291306243327e-03) \
+    X( 9.80989502251233651264e-03) \
+    X( 1.01501140185368699670e-02) \
+    X( 1.04842248908878447194e-02) \
+    X( 1.08121180689596009528e-02) \
+    X( 1.11336872118183785596e-02) \
+    X( 1.14488292368375710328e-02) \
+    X( 1.17574443467867335855e-02) \
+    X( 1.20594360553697797084e-02) \
+    X( 1.23547112112087492664e-02) \
+    X( 1.26431800202723137322e-02) \
+    X( 1.29247560667452802280e-02) \
+    X( 1.31993563323394361153e-02) \
+    X( 1.34669012140451026943e-02) \
+    X( 1.37273145403230718842e-02) \
+    X( 1.39805235857388930609e-02) \
+    X( 1.42264590840399576116e-02) \
+    X( 1.44650552396788801418e-02) \
+    X( 1.46962497377853603536e-02) \
+    X( 1.49199837525900817770e-02) \
+    X( 1.51362019543059365262e-02) \
+    X( 1.53448525144697818512e-02) \
+    X( 1.55458871097522988158e-02) \
+    X( 1.57392609242401407266e-02) \
+    X( 1.59249326501989980909e-02) \
+    X( 1.61028644873237487822e-02) \
+    X( 1.62730221404839558996e-02) \
+    X( 1.64353748159745995105e-02) \
+    X( 1.65898952162792344411e-02) \
+    X( 1.67365595333573702330e-02) \
+    X( 1.68753474404654685292e-02) \
+    X( 1.70062420825228405308e-02) \
+    X( 1.71292300650343690127e-02) \
+    X( 1.72443014415816948948e-02) \
+    X( 1.73514496998961910423e-02) \
+    X( 1.74506717465267233158e-02) \
+    X( 1.75419678901157470585e-02) \
+    X( 1.76253418232991503067e-02) \
+    X( 1.77008006032431768062e-02) \
+    X( 1.77683546308354950449e-02) \
+    X( 1.78280176285450023266e-02) \
+    X( 1.78798066169677284665e-02) \
+    X( 1.79237418900749095885e-02) \
+    X( 1.79598469891815541721e-02) \
+    X( 1.79881486756524357207e-02) \
+    X( 1.80086769023645003329e-02) \
+    X( 1.80214647839439801036e-02) \
+    X( 1.80265485657978320744e-02) \
+    X( 1.80239675919585257136e-02) \
+    X( 1.80137642717629609113e-02) \
+    X( 1.79959840453853894826e-02) \
+    X( 1.79706753482452019632e-02) \
+    X( 1.79378895743111561878e-02) \
+    X( 1.78976810383233188306e-02) \
+    X( 1.78501069369546815080e-02) \
+    X( 1.77952273089348571300e-02) \
+    X( 1.77331049941585293384e-02) \
+    X( 1.76638055918014250101e-02) \
+    X( 1.75873974174670689996e-02) \
+    X( 1.75039514593883366311e-02) \
+    X( 1.74135413337067820883e-02) \
+    X( 1.73162432388551425222e-02) \
+    X( 1.72121359090659648006e-02) \
+    X( 1.71013005670323306462e-02) \
+    X( 1.69838208757447130248e-02) \
+    X( 1.68597828895295613616e-02) \
+    X( 1.67292750043147309125e-02) \
+    X( 1.65923879071472879509e-02) \
+    X( 1.64492145249898746862e-02) \
+    X( 1.62998499728209574056e-02) \
+    X( 1.61443915010654574782e-02) \
+    X( 1.59829384423819872985e-02) \
+    X( 1.58155921578329479449e-02) \
+    X( 1.56424559824643004402e-02) \
+    X( 1.54636351703211580993e-02) \
+    X( 1.52792368389266484952e-02) \
+    X( 1.50893699132506348831e-02) \
+    X( 1.48941450691946284529e-02) \
+    X( 1.46936746766213478105e-02) \
+    X( 1.44880727419542387757e-02) \
+    X( 1.42774548503756936596e-02) \
+    X( 1.40619381076500047506e-02) \
+    X( 1.38416410815988405458e-02) \
+    X( 1.36166837432563775367e-02) \
+    X( 1.33871874077307433104e-02) \
+    X( 1.31532746747999255282e-02) \
+    X( 1.29150693692685249875e-02) \
+    X( 1.26726964811125480254e-02) \
+    X( 1.24262821054400597609e-02) \
+    X( 1.21759533822933443264e-02) \
+    X( 1.19218384363212748234e-02) \
+    X( 1.16640663163469111840e-02) \
+    X( 1.14027669348586990772e-02) \
+    X( 1.11380710074510391738e-02) \
+    X( 1.08701099922405512027e-02) \
+    X( 1.05990160292857588803e-02) \
+    X( 1.03249218800347264402e-02) \
+    X( 1.00479608668283364181e-02) \
+    X( 9.76826681248407595326e-03) \
+    X( 9.48597397998680001707e-03) \
+    X( 9.20121701231205180171e-03) \
+    X( 8.91413087240663405686e-03) \
+    X( 8.62485078335300560382e-03) \
+    X( 8.33351216874106057175e-03) \
+    X( 8.04025059327335284154e-03) \
+    X( 7.74520170362733365033e-03) \
+    X( 7.44850116959968472363e-03) \
+    X( 7.15028462555652392224e-03) \
+    X( 6.85068761221313375642e-03) \
+    X( 6.54984551876693164157e-03) \
+    X( 6.24789352540736173808e-03) \
+    X( 5.94496654622468298501e-03) \
+    X( 5.64119917254172174859e-03) \
+    X( 5.33672561668945780872e-03) \
+    X( 5.03167965625017643561e-03) \
+    X( 4.72619457878821046942e-03) \
+    X( 4.42040312709122713147e-03) \
+    X( 4.11443744494245557813e-03) \
+    X( 3.80842902344421868274e-03) \
+    X( 3.50250864791438413365e-03) \
+    X( 3.19680634537424174582e-03) \
+    X( 2.89145133264915015631e-03) \
+    X( 2.58657196509964968506e-03) \
+    X( 2.28229568600325869593e-03) \
+    X( 1.97874897660506266980e-03) \
+    X( 1.67605730685465247574e-03) \
+    X( 1.37434508684857771554e-03) \
+    X( 1.07373561899400072825e-03) \
+    X( 7.74351050912206037222e-04) \
+    X( 4.76312329096932108620e-04) \
+    X( 1.79739153344913828647e-04) \
+    X(-1.15250068026150436743e-04) \
+    X(-4.08538262157430215240e-04) \
+    X(-7.00009734810518881830e-04) \
+    X(-9.89550212697529359140e-04) \
+    X(-1.27704688496522110984e-03) \
+    X(-1.56238844381914230262e-03) \
+    X(-1.84546512427596291067e-03) \
+    X(-2.12616874302977649017e-03) \
+    X(-2.40439273642179809562e-03) \
+    X(-2.68003219750039467159e-03) \
+    X(-2.95298391216083011210e-03) \
+    X(-3.22314639435426720723e-03) \
+    X(-3.49041992035452591087e-03) \
+    X(-3.75470656207426648626e-03) \
+    X(-4.01591021941965966441e-03) \
+    X(-4.27393665167596914500e-03) \
+    X(-4.52869350791463860101e-03) \
+    X(-4.78009035641408387002e-03) \
+    X(-5.02803871308742881402e-03) \
+    X(-5.27245206890878791856e-03) \
+    X(-5.51324591633307794364e-03) \
+    X(-5.75033777470175880286e-03) \
+    X(-5.98364721463032038506e-03) \
+    X(-6.21309588137129026331e-03) \
+    X(-6.43860751714846711591e-03) \
+    X(-6.66010798245885143193e-03) \
+    X(-6.87752527633716734257e-03) \
+    X(-7.09078955558135361203e-03) \
+    X(-7.29983315293484570641e-03) \
+    X(-7.50459059422442856246e-03) \
+    X(-7.70499861445137022159e-03) \
+    X(-7.90099617283428028169e-03) \
+    X(-8.09252446680348673513e-03) \
+    X(-8.27952694494581836748e-03) \
+    X(-8.46194931890021165288e-03) \
+    X(-8.63973957420479179992e-03) \
+    X(-8.81284798009584514900e-03) \
+    X(-8.98122709826090423468e-03) \
+    X(-9.14483179054685624276e-03) \
+    X(-9.30361922562642808254e-03) \
+    X(-9.45754888462495800494e-03) \
+    X(-9.60658256571109842037e-03) \
+    X(-9.75068438765514661215e-03) \
+    X(-9.88982079235872779677e-03) \
+    X(-1.00239605463608785763e-02) \
+    X(-1.01530747413246837108e-02) \
+    X(-1.02771367935108499936e-02) \
+    X(-1.03961224422430293518e-02) \
+    X(-1.05100097473716045521e-02) \
+    X(-1.06187790857425311958e-02) \
+    X(-1.07224131466778661165e-02) \
+    X(-1.08208969264758890494e-02) \
+    X(-1.09142177219381259629e-02) \
+    X(-1.10023651229317290939e-02) \
+    X(-1.10853310039956218930e-02) \
+    X(-1.11631095149994884197e-02) \
+    X(-1.12356970708646971419e-02) \
+    X(-1.13030923403568215463e-02) \
+    X(-1.13652962339602110059e-02) \
+    X(-1.14223118908440956359e-02) \
+    X(-1.14741446649318026840e-02) \
+    X(-1.15208021100836454503e-02) \
+    X(-1.15622939644049946284e-02) \
+    X(-1.15986321336910645080e-02) \
+    X(-1.16298306740207010868e-02) \
+    X(-1.16559057735113307669e-02) \
+    X(-1.16768757332475214827e-02) \
+    X(-1.16927609473963332182e-02) \
+    X(-1.17035838825226608945e-02) \
+    X(-1.17093690561177760784e-02) \
+    X(-1.17101430143551586693e-02) \
+    X(-1.17059343090872795129e-02) \
+    X(-1.16967734740980097013e-02) \
+    X(-1.16826930006248379257e-02) \
+    X(-1.16637273121658596037e-02) \
+    X(-1.16399127385864407935e-02) \
+    X(-1.16112874895409699111e-02) \
+    X(-1.15778916272246922003e-02) \
+    X(-1.15397670384720374415e-02) \
+    X(-1.14969574062164479888e-02) \
+    X(-1.14495081803284975280e-02) \
+    X(-1.13974665478479546959e-02) \
+    X(-1.13408814026266253211e-02) \
+    X(-1.12798033143984600957e-02) \
+    X(-1.12142844972935168402e-02) \
+    X(-1.11443787778127377519e-02) \
+    X(-1.10701415622809114236e-02) \
+    X(-1.09916298037944538957e-02) \
+    X(-1.09089019686816925125e-02) \
+    X(-1.08220180024931385970e-02) \
+    X(-1.07310392955389764802e-02) \
+    X(-1.06360286479915983754e-02) \
+    X(-1.05370502345710423397e-02) \
+    X(-1.04341695688310136247e-02) \
+    X(-1.03274534670632443106e-02) \
+    X(-1.02169700118386209270e-02) \
+    X(-1.01027885152025192345e-02) \
+    X(-9.98497948154308812008e-03) \
+    X(-9.86361457015006402871e-03) \
+    X(-9.73876655748246930488e-03) \
+    X(-9.61050929916365190286e-03) \
+    X(-9.47891769172138146105e-03) \
+    X(-9.34406763409175583623e-03) \
+    X(-9.20603598890469380922e-03) \
+    X(-9.06490054356958417647e-03) \
+    X(-8.92073997117914622990e-03) \
+    X(-8.77363379124968326139e-03) \
+    X(-8.62366233031589164704e-03) \
+    X(-8.47090668239862398803e-03) \
+    X(-8.31544866936306283078e-03) \
+    X(-8.15737080118616487978e-03) \
+    X(-7.99675623615058242533e-03) \
+    X(-7.83368874098351944402e-03) \
+    X(-7.66825265095798756787e-03) \
+    X(-7.50053282997436773782e-03) \
+    X(-7.33061463064018075525e-03) \
+    X(-7.15858385436481461928e-03) \
+    X(-6.98452671148786126409e-03) \
+    X(-6.80852978145714965441e-03) \
+    X(-6.63067997307481386826e-03) \
+    X(-6.45106448482760802543e-03) \
+    X(-6.26977076531890029770e-03) \
+    X(-6.08688647381931853542e-03) \
+    X(-5.90249944095203298716e-03) \
+    X(-5.71669762953000513278e-03) \
+    X(-5.52956909556100162373e-03) \
+    X(-5.34120194943696596085e-03) \
+    X(-5.15168431732329797079e-03) \
+    X(-4.96110430276443595266e-03) \
+    X(-4.76954994852103134756e-03) \
+    X(-4.57710919865432410564e-03) \
+    X(-4.38386986087277181340e-03) \
+    X(-4.18991956915663876782e-03) \
+    X(-3.99534574667439676410e-03) \
+    X(-3.80023556900675307108e-03) \
+    X(-3.60467592769156538676e-03) \
+    X(-3.40875339410503987864e-03) \
+    X(-3.21255418369197943973e-03) \
+    X(-3.01616412055992575564e-03) \
+    X(-2.81966860245005685598e-03) \
+    X(-2.62315256609809257030e-03) \
+    X(-2.42670045299875130826e-03) \
+    X(-2.23039617558575898118e-03) \
+    X(-2.03432308384080993632e-03) \
+    X(-1.83856393234277533909e-03) \
+    X(-1.64320084776991355742e-03) \
+    X(-1.44831529686655904529e-03) \
+    X(-1.25398805488530435195e-03) \
+    X(-1.06029917451672204415e-03) \
+    X(-8.67327955316482155854e-04) \
+    X(-6.75152913641518712638e-04) \
+    X(-4.83851753104545291573e-04) \
+    X(-2.93501335557769932588e-04) \
+    X(-1.04177652615230481180e-04) \
+    X( 8.40442022771478958144e-05) \
+    X( 2.71090061213828637746e-04) \
+    X( 4.56886708636217294885e-04) \
+    X( 6.41361907564611910364e-04) \
+    X( 8.24444425246958221068e-04) \
+    X( 1.00606405821750295726e-03) \
+    X( 1.18615165675600578790e-03) \
+    X( 1.36463914874257485378e-03) \
+    X( 1.54145956289825905236e-03) \
+    X( 1.71654705140769636706e-03) \
+    X( 1.88983691191461173828e-03) \
+    X( 2.06126560888645086675e-03) \
+    X( 2.23077079434063144103e-03) \
+    X( 2.39829132792830895110e-03) \
+    X( 2.56376729636941056573e-03) \
+    X( 2.72714003223500402184e-03) \
+    X( 2.88835213207216685155e-03) \
+    X( 3.04734747386685260462e-03) \
+    X( 3.20407123384176817371e-03) \
+    X( 3.35846990258462183704e-03) \
+    X( 3.51049130050470068257e-03) \
+    X( 3.66008459261367522647e-03) \
+    X( 3.80720030262936314294e-03) \
+    X( 3.95179032639856198800e-03) \
+    X( 4.09380794463911311387e-03) \
+    X( 4.23320783499702736619e-03) \
+    X( 4.36994608342004212803e-03) \
+    X( 4.50398019484403704799e-03) \
+    X( 4.63526910319382156461e-03) \
+    X( 4.76377318069614620610e-03) \
+    X( 4.88945424650618146178e-03) \
+    X( 5.01227557464674778470e-03) \
+    X( 5.13220190126144337750e-03) \
+    X( 5.24919943118207308480e-03) \
+    X( 5.36323584381190321402e-03) \
+    X( 5.47428029832571112767e-03) \
+    X( 5.58230343818897148389e-03) \
+    X( 5.68727739499729628703e-03) \
+    X( 5.78917579163970574818e-03) \
+    X( 5.88797374478673089110e-03) \
+    X( 5.98364786670789981782e-03) \
+    X( 6.07617626642060343345e-03) \
+    X( 6.16553855017385084303e-03) \
+    X( 6.25171582127166582804e-03) \
+    X( 6.33469067923863194541e-03) \
+    X( 6.41444721833308011821e-03) \
+    X( 6.49097102541174898749e-03) \
+    X( 6.56424917715103632687e-03) \
+    X( 6.63427023662958338657e-03) \
+    X( 6.70102424927795491810e-03) \
+    X( 6.76450273820044644529e-03) \
+    X( 6.82469869887525251023e-03) \
+    X( 6.88160659323871527759e-03) \
+    X( 6.93522234316026366108e-03) \
+    X( 6.98554332331408935064e-03) \
+    X( 7.03256835345506155222e-03) \
+    X( 7.07629769010476809138e-03) \
+    X( 7.11673301765615093362e-03) \
+    X( 7.15387743890304877992e-03) \
+    X( 7.18773546500291789924e-03) \
+    X( 7.21831300488032408247e-03) \
+    X( 7.24561735407938580650e-03) \
+    X( 7.26965718307318129604e-03) \
+    X( 7.29044252503875406940e-03) \
+    X( 7.30798476310635155423e-03) \
+    X( 7.32229661709144288850e-03) \
+    X( 7.33339212971884264747e-03) \
+    X( 7.34128665234775375920e-03) \
+    X( 7.34599683020745793799e-03) \
+    X( 7.34754058715258225737e-03) \
+    X( 7.34593710994830336597e-03) \
+    X( 7.34120683209452638829e-03) \
+    X( 7.33337141719967496728e-03) \
+    X( 7.32245374191355016119e-03) \
+    X( 7.30847787843014878861e-03) \
+    X( 7.29146907657012011139e-03) \
+    X( 7.27145374545387114529e-03) \
+    X( 7.24845943477565521351e-03) \
+    X( 7.22251481568945107037e-03) \
+    X( 7.19364966131744686118e-03) \
+    X( 7.16189482689201083881e-03) \
+    X( 7.12728222954231872138e-03) \
+    X( 7.08984482773655864257e-03) \
+    X( 7.04961660039112210374e-03) \
+    X( 7.00663252565801673161e-03) \
+    X( 6.96092855940177307472e-03) \
+    X( 6.91254161337735619636e-03) \
+    X( 6.86150953312070904788e-03) \
+    X( 6.80787107556324582597e-03) \
+    X( 6.75166588638215301593e-03) \
+    X( 6.69293447709806265528e-03) \
+    X( 6.63171820193170571955e-03) \
+    X( 6.56805923443159328512e-03) \
+    X( 6.50200054388410785683e-03) \
+    X( 6.43358587151825807998e-03) \
+    X( 6.36285970651646794888e-03) \
+    X( 6.28986726184373092646e-03) \
+    X( 6.21465444990643503531e-03) \
+    X( 6.13726785805332464285e-03) \
+    X( 6.05775472392990760317e-03) \
+    X( 5.97616291069856791357e-03) \
+    X( 5.89254088213594148099e-03) \
+    X( 5.80693767761965816410e-03) \
+    X( 5.71940288701587758180e-03) \
+    X( 5.62998662548002196115e-03) \
+    X( 5.53873950818146131014e-03) \
+    X( 5.44571262496510149348e-03) \
+    X( 5.35095751496040238082e-03) \
+    X( 5.25452614115022934027e-03) \
+    X( 5.15647086491062122543e-03) \
+    X( 5.05684442053339500839e-03) \
+    X( 4.95569988974256699088e-03) \
+    X( 4.85309067621648645985e-03) \
+    X( 4.74907048012647350216e-03) \
+    X( 4.64369327270371719946e-03) \
+    X( 4.53701327084515566163e-03) \
+    X( 4.42908491176951992635e-03) \
+    X( 4.31996282773485212186e-03) \
+    X( 4.20970182082771107734e-03) \
+    X( 4.09835683783572966160e-03) \
+    X( 3.98598294521311340144e-03) \
+    X( 3.87263530415101094040e-03) \
+    X( 3.75836914576165720403e-03) \
+    X( 3.64323974638825019007e-03) \
+    X( 3.52730240304928790995e-03) \
+    X( 3.41061240902878646739e-03) \
+    X( 3.29322502962129748730e-03) \
+    X( 3.17519547804233142826e-03) \
+    X( 3.05657889151338601694e-03) \
+    X( 2.93743030753160130203e-03) \
+    X( 2.81780464033296821486e-03) \
+    X( 2.69775665755896121301e-03) \
+    X( 2.57734095713514719389e-03) \
+    X( 2.45661194437134461702e-03) \
+    X( 2.33562380929147129019e-03) \
+    X( 2.21443050420279223534e-03) \
+    X( 2.09308572151161147862e-03) \
+    X( 1.97164287179554201940e-03) \
+    X( 1.85015506213867531038e-03) \
+    X( 1.72867507473943343883e-03) \
+    X( 1.60725534579748128607e-03) \
+    X( 1.48594794468843234732e-03) \
+    X( 1.36480455343317803527e-03) \
+    X( 1.24387644646943291808e-03) \
+    X( 1.12321447073277739387e-03) \
+    X( 1.00286902605367005473e-03) \
+    X( 8.82890045877847201225e-04) \
+    X( 7.63326978315998568199e-04) \
+    X( 6.44228767529792380013e-04) \
+    X( 5.25643835459782418976e-04) \
+    X( 4.07620063901896608968e-04) \
+    X( 2.90204776937506045247e-04) \
+    X( 1.73444723723805766706e-04) \
+    X( 5.73860616484244659592e-05) \
+    X(-5.79256601447129809831e-05) \
+    X(-1.72445516855139978872e-04) \
+    X(-2.86129223744603178401e-04) \
+    X(-3.98933151471683798521e-04) \
+    X(-5.10814341036775051638e-04) \
+    X(-6.21730518333987194034e-04) \
+    X(-7.31640108305292775383e-04) \
+    X(-8.40502248693749103720e-04) \
+    X(-9.48276803391555388537e-04) \
+    X(-1.05492437538016840815e-03) \
+    X(-1.16040631925863960139e-03) \
+    X(-1.26468475335793167046e-03) \
+    X(-1.36772257143744795961e-03) \
+    X(-1.46948345396231690001e-03) \
+    X(-1.56993187895820992227e-03) \
+    X(-1.66903313244173671925e-03) \
+    X(-1.76675331842487395514e-03) \
+    X(-1.86305936849075486246e-03) \
+    X(-1.95791905094055886799e-03) \
+    X(-2.05130097950870097026e-03) \
+    X(-2.14317462164644121497e-03) \
+    X(-2.23351030637205421117e-03) \
+    X(-2.32227923168745655630e-03) \
+    X(-2.40945347156019864382e-03) \
+    X(-2.49500598247101752769e-03) \
+    X(-2.57891060952624437755e-03) \
+    X(-2.66114209213571661222e-03) \
+    X(-2.74167606925580006200e-03) \
+    X(-2.82048908419860059130e-03) \
+    X(-2.89755858900738426376e-03) \
+    X(-2.97286294839969704451e-03) \
+    X(-3.04638144327833843006e-03) \
+    X(-3.11809427381250833106e-03) \
+    X(-3.18798256208930414976e-03) \
+    X(-3.25602835433819615824e-03) \
+    X(-3.32221462272949338845e-03) \
+    X(-3.38652526674922864716e-03) \
+    X(-3.44894511415224942069e-03) \
+    X(-3.50945992149601917673e-03) \
+    X(-3.56805637425754813494e-03) \
+    X(-3.62472208653601482564e-03) \
+    X(-3.67944560034401835918e-03) \
+    X(-3.73221638449032109761e-03) \
+    X(-3.78302483305743104600e-03) \
+    X(-3.83186226347697993233e-03) \
+    X(-3.87872091420681094562e-03) \
+    X(-3.92359394201303914723e-03) \
+    X(-3.96647541886111301701e-03) \
+    X(-4.00736032841956212047e-03) \
+    X(-4.04624456218095809173e-03) \
+    X(-4.08312491520368761599e-03) \
+    X(-4.11799908147960237043e-03) \
+    X(-4.15086564893147550587e-03) \
+    X(-4.18172409404541419592e-03) \
+    X(-4.21057477614258761356e-03) \
+    X(-4.23741893129556731340e-03) \
+    X(-4.26225866589410255086e-03) \
+    X(-4.28509694986558761776e-03) \
+    X(-4.30593760955555893838e-03) \
+    X(-4.32478532027361865092e-03) \
+    X(-4.34164559851025946141e-03) \
+    X(-4.35652479383043678834e-03) \
+    X(-4.36943008044940375129e-03) \
+    X(-4.38036944849687272935e-03) \
+    X(-4.38935169497548655082e-03) \
+    X(-4.39638641441941844384e-03) \
+    X(-4.40148398925969356471e-03) \
+    X(-4.40465557990201740657e-03) \
+    X(-4.40591311452397972614e-03) \
+    X(-4.40526927859759102890e-03) \
+    X(-4.40273750414399336200e-03) \
+    X(-4.39833195872687317957e-03) \
+    X(-4.39206753419116562726e-03) \
+    X(-4.38395983515392842489e-03) \
+    X(-4.37402516725410826781e-03) \
+    X(-4.36228052516814471251e-03) \
+    X(-4.34874358039834783829e-03) \
+    X(-4.33343266884099378305e-03) \
+    X(-4.31636677814128347924e-03) \
+    X(-4.29756553484226828249e-03) \
+    X(-4.27704919133478460302e-03) \
+    X(-4.25483861261575103258e-03) \
+    X(-4.23095526286197242544e-03) \
+    X(-4.20542119182673330285e-03) \
+    X(-4.17825902106652539991e-03) \
+    X(-4.14949193000528453179e-03) \
+    X(-4.11914364184333848390e-03) \
+    X(-4.08723840931864319803e-03) \
+    X(-4.05380100032764340012e-03) \
+    X(-4.01885668341308427420e-03) \
+    X(-3.98243121312639048598e-03) \
+    X(-3.94455081527187324114e-03) \
+    X(-3.90524217204034265055e-03) \
+    X(-3.86453240703949710971e-03) \
+    X(-3.82244907022857112119e-03) \
+    X(-3.77902012276458334344e-03) \
+    X(-3.73427392176791782957e-03) \
+    X(-3.68823920501411533363e-03) \
+    X(-3.64094507555994461798e-03) \
+    X(-3.59242098631046497328e-03) \
+    X(-3.54269672453505143905e-03) \
+    X(-3.49180239633924225512e-03) \
+    X(-3.43976841109999795926e-03) \
+    X(-3.38662546587152699790e-03) \
+    X(-3.33240452976901182711e-03) \
+    X(-3.27713682833726460339e-03) \
+    X(-3.22085382791172753977e-03) \
+    X(-3.16358721997866921757e-03) \
+    X(-3.10536890554190866259e-03) \
+    X(-3.04623097950279270868e-03) \
+    X(-2.98620571506079835605e-03) \
+    X(-2.92532554814109750294e-03) \
+    X(-2.86362306185669341502e-03) \
+    X(-2.80113097101106212072e-03) \
+    X(-2.73788210664884781517e-03) \
+    X(-2.67390940066071719841e-03) \
+    X(-2.60924587044905360173e-03) \
+    X(-2.54392460366138209102e-03) \
+    X(-2.47797874299740972931e-03) \
+    X(-2.41144147109654920225e-03) \
+    X(-2.34434599551184728525e-03) \
+    X(-2.27672553377682423265e-03) \
+    X(-2.20861329857108918892e-03) \
+    X(-2.14004248299099744321e-03) \
+    X(-2.07104624593109319652e-03) \
+    X(-2.00165769758243626206e-03) \
+    X(-1.93190988505322330110e-03) \
+    X(-1.86183577811795423693e-03) \
+    X(-1.79146825509988766485e-03) \
+    X(-1.72084008889326943795e-03) \
+    X(-1.64998393312966343087e-03) \
+    X(-1.57893230849462818527e-03) \
+    X(-1.50771758919912264932e-03) \
+    X(-1.43637198961127387532e-03) \
+    X(-1.36492755105304883201e-03) \
+    X(-1.29341612876705033125e-03) \
+    X(-1.22186937905778840625e-03) \
+    X(-1.15031874661246304344e-03) \
+    X(-1.07879545200534983015e-03) \
+    X(-1.00733047939059738862e-03) \
+    X(-9.35954564387392199190e-04) \
+    X(-8.64698182161781326270e-04) \
+    X(-7.93591535709335898878e-04) \
+    X(-7.22664544342259342231e-04) \
+    X(-6.51946832385152269008e-04) \
+    X(-5.81467718082645003419e-04) \
+    X(-5.11256202723101406751e-04) \
+    X(-4.41340959980976682391e-04) \
+    X(-3.71750325482115011495e-04) \
+    X(-3.02512286594312090893e-04) \
+    X(-2.33654472446860898751e-04) \
+    X(-1.65204144181543805632e-04) \
+    X(-9.71881854382950145007e-05) \
+    X(-2.96330930778333087529e-05) \
+    X( 3.74350318557888840534e-05) \
+    X( 1.03990492930665522531e-04) \
+    X( 1.70008006877860913661e-04) \
+    X( 2.35462711895771908792e-04) \
+    X( 3.00330175705594570618e-04) \
+    X( 3.64586403356421419591e-04) \
+    X( 4.28207844777551787079e-04) \
+    X( 4.91171402077186748311e-04) \
+    X( 5.53454436585029511952e-04) \
+    X( 6.15034775638214118408e-04) \
+    X( 6.75890719108685204992e-04) \
+    X( 7.36001045671158494674e-04) \
+    X( 7.95345018810736208159e-04) \
+    X( 8.53902392568785988461e-04) \
+    X( 9.11653417026953884206e-04) \
+    X( 9.68578843528107927274e-04) \
+    X( 1.02465992963409239201e-03) \
+    X( 1.07987844381954517861e-03) \
+    X( 1.13421666990184857697e-03) \
+    X( 1.18765741120669863183e-03) \
+    X( 1.24018399446962118877e-03) \
+    X( 1.29178027347317181048e-03) \
+    X( 1.34243063242041153760e-03) \
+    X( 1.39211998904448393775e-03) \
+    X( 1.44083379745542361494e-03) \
+    X( 1.48855805072399061464e-03) \
+    X( 1.53527928320389963832e-03) \
+    X( 1.58098457259274222282e-03) \
+    X( 1.62566154173287799080e-03) \
+    X( 1.66929836015300469068e-03) \
+    X( 1.71188374535185877309e-03) \
+    X( 1.75340696382495094506e-03) \
+    X( 1.79385783183615881223e-03) \
+    X( 1.83322671593499951850e-03) \
+    X( 1.87150453322187351919e-03) \
+    X( 1.90868275136241117781e-03) \
+    X( 1.94475338835288632730e-03) \
+    X( 1.97970901203875114180e-03) \
+    X( 2.01354273938795765367e-03) \
+    X( 2.04624823552140497340e-03) \
+    X( 2.07781971250251560127e-03) \
+    X( 2.10825192788842950831e-03) \
+    X( 2.13754018304492627786e-03) \
+    X( 2.16568032122775241954e-03) \
+    X( 2.19266872543273649843e-03) \
+    X( 2.21850231601753312277e-03) \
+    X( 2.24317854809751244041e-03) \
+    X( 2.26669540871874157159e-03) \
+    X( 2.28905141381085521987e-03) \
+    X( 2.31024560492300908704e-03) \
+    X( 2.33027754574556848419e-03) \
+    X( 2.34914731842113299123e-03) \
+    X( 2.36685551964774167771e-03) \
+    X( 2.38340325657774047483e-03) \
+    X( 2.39879214251553785076e-03) \
+    X( 2.41302429241780800814e-03) \
+    X( 2.42610231819949092105e-03) \
+    X( 2.43802932384921434983e-03) \
+    X( 2.44880890035772524199e-03) \
+    X( 2.45844512046309356806e-03) \
+    X( 2.46694253321619750424e-03) \
+    X( 2.47430615837057783779e-03) \
+    X( 2.48054148060029584083e-03) \
+    X( 2.48565444354972896537e-03) \
+    X( 2.48965144371932805070e-03) \
+    X( 2.49253932419119233338e-03) \
+    X( 2.49432536819870756192e-03) \
+    X( 2.49501729254406187306e-03) \
+    X( 2.49462324086802481049e-03) \
+    X( 2.49315177677595679884e-03) \
+    X( 2.49061187682437026880e-03) \
+    X( 2.48701292337218105022e-03) \
+    X( 2.48236469730101589823e-03) \
+    X( 2.47667737060877201499e-03) \
+    X( 2.46996149888082565729e-03) \
+    X( 2.46222801364318543901e-03) \
+    X( 2.45348821460201170497e-03) \
+    X( 2.44375376177385136151e-03) \
+    X( 2.43303666751100867299e-03) \
+    X( 2.42134928842652587602e-03) \
+    X( 2.40870431722312039469e-03) \
+    X( 2.39511477443066006163e-03) \
+    X( 2.38059400005651662299e-03) \
+    X( 2.36515564515335941637e-03) \
+    X( 2.34881366330883401689e-03) \
+    X( 2.33158230206161314751e-03) \
+    X( 2.31347609424828503169e-03) \
+    X( 2.29450984928561332182e-03) \
+    X( 2.27469864439260342423e-03) \
+    X( 2.25405781575686164908e-03) \
+    X( 2.23260294964972971082e-03) \
+    X( 2.21034987349466626252e-03) \
+    X( 2.18731464689328946802e-03) \
+    X( 2.16351355261355186160e-03) \
+    X( 2.13896308754443764677e-03) \
+    X( 2.11367995362164717843e-03) \
+    X( 2.08768104872860673846e-03) \
+    X( 2.06098345757712827012e-03) \
+    X( 2.03360444257223585765e-03) \
+    X( 2.00556143466523338278e-03) \
+    X( 1.97687202419953838434e-03) \
+    X( 1.94755395175337346625e-03) \
+    X( 1.91762509898370150235e-03) \
+    X( 1.88710347947544372464e-03) \
+    X( 1.85600722960030926380e-03) \
+    X( 1.82435459938927956557e-03) \
+    X( 1.79216394342290039413e-03) \
+    X( 1.75945371174334418141e-03) \
+    X( 1.72624244079242210488e-03) \
+    X( 1.69254874437936271916e-03) \
+    X( 1.65839130468247841071e-03) \
+    X( 1.62378886328829906069e-03) \
+    X( 1.58876021227249563002e-03) \
+    X( 1.55332418532590395277e-03) \
+    X( 1.51749964892962602506e-03) \
+    X( 1.48130549358308134279e-03) \
+    X( 1.44476062508820820261e-03) \
+    X( 1.40788395589385340219e-03) \
+    X( 1.37069439650360901800e-03) \
+    X( 1.33321084695073701146e-03) \
+    X( 1.29545218834344489506e-03) \
+    X( 1.25743727448406820806e-03) \
+    X( 1.21918492356532437090e-03) \
+    X( 1.18071390994699786103e-03) \
+    X( 1.14204295601606406994e-03) \
+    X( 1.10319072413361980722e-03) \
+    X( 1.06417580867146756643e-03) \
+    X( 1.02501672814153568618e-03) \
+    X( 9.85731917420752321024e-04) \
+    X( 9.46339720074761028661e-04) \
+    X( 9.06858380782653099826e-04) \
+    X( 8.67306037865940180828e-04) \
+    X( 8.27700715924154601863e-04) \
+    X( 7.88060318579825755218e-04) \
+    X( 7.48402621335140681366e-04) \
+    X( 7.08745264542995573667e-04) \
+    X( 6.69105746494616255432e-04) \
+    X( 6.29501416626196083105e-04) \
+    X( 5.89949468846577432593e-04) \
+    X( 5.50466934988384673337e-04) \
+    X( 5.11070678384569518186e-04) \
+    X( 4.71777387572266644969e-04) \
+    X( 4.32603570126133903009e-04) \
+    X( 3.93565546622840108093e-04) \
+    X( 3.54679444738640930936e-04) \
+    X( 3.15961193481461178213e-04) \
+    X( 2.77426517559644606348e-04) \
+    X( 2.39090931888283949464e-04) \
+    X( 2.00969736235134577339e-04) \
+    X( 1.63078010007227617185e-04) \
+    X( 1.25430607179671989044e-04) \
+    X( 8.80421513676910678318e-05) \
+    X( 5.09270310433270975443e-05) \
+    X( 1.40993948977051206995e-05) \
+    X(-2.24268526499689963992e-05) \
+    X(-5.86380557959355767418e-05) \
+    X(-9.45208115468090933828e-05) \
+    X(-1.30061973765318488264e-04) \
+    X(-1.65248657065980185041e-04) \
+    X(-2.00068240560348736649e-04) \
+    X(-2.34508371450769772170e-04) \
+    X(-2.68556968472767403858e-04) \
+    X(-3.02202225185153135114e-04) \
+    X(-3.35432613107714699702e-04) \
+    X(-3.68236884706315019053e-04) \
+    X(-4.00604076224976460123e-04) \
+    X(-4.32523510365022737217e-04) \
+    X(-4.63984798811095579957e-04) \
+    X(-4.94977844604242624843e-04) \
+    X(-5.25492844361963827582e-04) \
+    X(-5.55520290345540247376e-04) \
+    X(-5.85050972374773735341e-04) \
+    X(-6.14075979590610184985e-04) \
+    X(-6.42586702065795259929e-04) \
+    X(-6.70574832264203037069e-04) \
+    X(-6.98032366349193725621e-04) \
+    X(-7.24951605341828033552e-04) \
+    X(-7.51325156129156322866e-04) \
+    X(-7.77145932323820387393e-04) \
+    X(-8.02407154975299293648e-04) \
+    X(-8.27102353133903219450e-04) \
+    X(-8.51225364268258727699e-04) \
+    X(-8.74770334537431802288e-04) \
+    X(-8.97731718918501797773e-04) \
+    X(-9.20104281190827605862e-04) \
+    X(-9.41883093778050233848e-04) \
+    X(-9.63063537449165905750e-04) \
+    X(-9.83641300879760935652e-04) \
+    X(-1.00361238007481306557e-03) \
+    X(-1.02297307765449128208e-03) \
+    X(-1.04172000200423238610e-03) \
+    X(-1.05985006629069969386e-03) \
+    X(-1.07736048734502422482e-03) \
+    X(-1.09424878441514257174e-03) \
+    X(-1.11051277778848088776e-03) \
+    X(-1.12615058728708443934e-03) \
+    X(-1.14116063063659394818e-03) \
+    X(-1.15554162171100749217e-03) \
+    X(-1.16929256865495575027e-03) \
+    X(-1.18241277188544584124e-03) \
+    X(-1.19490182197486941203e-03) \
+    X(-1.20675959741726535404e-03) \
+    X(-1.21798626227982297217e-03) \
+    X(-1.22858226374166065384e-03) \
+    X(-1.23854832952187280184e-03) \
+    X(-1.24788546519901061629e-03) \
+    X(-1.25659495142406364872e-03) \
+    X(-1.26467834102919943727e-03) \
+    X(-1.27213745603428412742e-03) \
+    X(-1.27897438455362244883e-03) \
+    X(-1.28519147760499177768e-03) \
+    X(-1.29079134582336268501e-03) \
+    X(-1.29577685608154116216e-03) \
+    X(-1.30015112802015094483e-03) \
+    X(-1.30391753048923449490e-03) \
+    X(-1.30707967790388737521e-03) \
+    X(-1.30964142651636395419e-03) \
+    X(-1.31160687060702277167e-03) \
+    X(-1.31298033859659005196e-03) \
+    X(-1.31376638908218385492e-03) \
+    X(-1.31396980679961724973e-03) \
+    X(-1.31359559851441281067e-03) \
+    X(-1.31264898884408520024e-03) \
+    X(-1.31113541601419526274e-03) \
+    X(-1.30906052755070225271e-03) \
+    X(-1.30643017591116055581e-03) \
+    X(-1.30325041405731484843e-03) \
+    X(-1.29952749097163636725e-03) \
+    X(-1.29526784712039586857e-03) \
+    X(-1.29047810986578645812e-03) \
+    X(-1.28516508882973415524e-03) \
+    X(-1.27933577121191956356e-03) \
+    X(-1.27299731706460124078e-03) \
+    X(-1.26615705452684046764e-03) \
+    X(-1.25882247502064623448e-03) \
+    X(-1.25100122841167137044e-03) \
+    X(-1.24270111813698665680e-03) \
+    X(-1.23393009630251375940e-03) \
+    X(-1.22469625875265661526e-03) \
+    X(-1.21500784011470538623e-03) \
+    X(-1.20487320882053006339e-03) \
+    X(-1.19430086210808427544e-03) \
+    X(-1.18329942100529298017e-03) \
+    X(-1.17187762529875026674e-03) \
+    X(-1.16004432848981092231e-03) \
+    X(-1.14780849274044756403e-03) \
+    X(-1.13517918381147498753e-03) \
+    X(-1.12216556599544479457e-03) \
+    X(-1.10877689704675665670e-03) \
+    X(-1.09502252311132830878e-03) \
+    X(-1.08091187365826806380e-03) \
+    X(-1.06645445641585442931e-03) \
+    X(-1.05165985231426076241e-03) \
+    X(-1.03653771043727446592e-03) \
+    X(-1.02109774298538512859e-03) \
+    X(-1.00534972025243104707e-03) \
+    X(-9.89303465618205854493e-04) \
+    X(-9.72968850559070386023e-04) \
+    X(-9.56355789678956110487e-04) \
+    X(-9.39474235762757228438e-04) \
+    X(-9.22334174854466432199e-04) \
+    X(-9.04945621361946477522e-04) \
+    X(-8.87318613190598128385e-04) \
+    X(-8.69463206907894578697e-04) \
+    X(-8.51389472940857513876e-04) \
+    X(-8.33107490808391681729e-04) \
+    X(-8.14627344390523211622e-04) \
+    X(-7.95959117236444131487e-04) \
+    X(-7.77112887913182157074e-04) \
+    X(-7.58098725396869001399e-04) \
+    X(-7.38926684508335205812e-04) \
+    X(-7.19606801394884719458e-04) \
+    X(-7.00149089059903611230e-04) \
+    X(-6.80563532942129469604e-04) \
+    X(-6.60860086546161931871e-04) \
+    X(-6.41048667125920334890e-04) \
+    X(-6.21139151422514545521e-04) \
+    X(-6.01141371458319205383e-04) \
+    X(-5.81065110388481308873e-04) \
+    X(-5.60920098411564179222e-04) \
+    X(-5.40716008740645473485e-04) \
+    X(-5.20462453636329636791e-04) \
+    X(-5.00168980502928035153e-04) \
+    X(-4.79845068049252442000e-04) \
+    X(-4.59500122515179752151e-04) \
+    X(-4.39143473965308969373e-04) \
+    X(-4.18784372650737749064e-04) \
+    X(-3.98431985440370181519e-04) \
+    X(-3.78095392322528038760e-04) \
+    X(-3.57783582978218623466e-04) \
+    X(-3.37505453426840712917e-04) \
+    X(-3.17269802745462131330e-04) \
+    X(-2.97085329862539673351e-04) \
+    X(-2.76960630426857884294e-04) \
+    X(-2.56904193752789059696e-04) \
+    X(-2.36924399842341755311e-04) \
+    X(-2.17029516485020210204e-04) \
+    X(-1.97227696436049984184e-04) \
+    X(-1.77526974673721080374e-04) \
+    X(-1.57935265736364822877e-04) \
+    X(-1.38460361139671443579e-04) \
+    X(-1.19109926874780676581e-04) \
+    X(-9.98915009877096604120e-05) \
+    X(-8.08124912404658787314e-05) \
+    X(-6.18801728543761411219e-05) \
+    X(-4.31016863358901726119e-05) \
+    X(-2.44840353852607290751e-05) \
+    X(-6.03408488822807525549e-06) \
+    X( 1.22414410087942923482e-05) \
+    X( 3.03359607401630166279e-05) \
+    X( 4.82430370786643698930e-05) \
+    X( 6.59563788094303331657e-05) \
+    X( 8.34698423199615796228e-05) \
+    X( 1.00777433106333784039e-04) \
+    X( 1.17873307195481496850e-04) \
+    X( 1.34751772483674884346e-04) \
+    X( 1.51407289991337552218e-04) \
+    X( 1.67834475034225882872e-04) \
+    X( 1.84028098311239825778e-04) \
+    X( 1.99983086909011169297e-04) \
+    X( 2.15694525223608961004e-04) \
+    X( 2.31157655799539194473e-04) \
+    X( 2.46367880086458945071e-04) \
+    X( 2.61320759113890506518e-04) \
+    X( 2.76012014084471178285e-04) \
+    X( 2.90437526885940853344e-04) \
+    X( 3.04593340522622661477e-04) \
+    X( 3.18475659466672001308e-04) \
+    X( 3.32080849929764377465e-04) \
+    X( 3.45405440055728798956e-04) \
+    X( 3.58446120034815369788e-04) \
+    X( 3.71199742140139986053e-04) \
+    X( 3.83663320687053425832e-04) \
+    X( 3.95834031916090828447e-04) \
+    X( 4.07709213800306149479e-04) \
+    X( 4.19286365777668133727e-04) \
+    X( 4.30563148409382728376e-04) \
+    X( 4.41537382964913725693e-04) \
+    X( 4.52207050934656925797e-04) \
+    X( 4.62570293470961546242e-04) \
+    X( 4.72625410758635230730e-04) \
+    X( 4.82370861315684551149e-04) \
+    X( 4.91805261225328150740e-04) \
+    X( 5.00927383300294468485e-04) \
+    X( 5.09736156180340470138e-04) \
+    X( 5.18230663364083014855e-04) \
+    X( 5.26410142176160977465e-04) \
+    X( 5.34273982670858136115e-04) \
+    X( 5.41821726473215733132e-04) \
+    X( 5.49053065558819199977e-04) \
+    X( 5.55967840973343140065e-04) \
+    X( 5.62566041493084596781e-04) \
+    X( 5.68847802227587348751e-04) \
+    X( 5.74813403165606124842e-04) \
+    X( 5.80463267665585255090e-04) \
+    X( 5.85797960891953992807e-04) \
+    X( 5.90818188198352634011e-04) \
+    X( 5.95524793459205619046e-04) \
+    X( 5.99918757350793364382e-04) \
+    X( 6.04001195583171897330e-04) \
+    X( 6.07773357084216074402e-04) \
+    X( 6.11236622137123529822e-04) \
+    X( 6.14392500472671181100e-04) \
+    X( 6.17242629317575641247e-04) \
+    X( 6.19788771400296852575e-04) \
+    X( 6.22032812915646266330e-04) \
+    X( 6.23976761449542352556e-04) \
+    X( 6.25622743865282679096e-04) \
+    X( 6.26973004152734866845e-04) \
+    X( 6.28029901241785953013e-04) \
+    X( 6.28795906781460817864e-04) \
+    X( 6.29273602886090081127e-04) \
+    X( 6.29465679849935955126e-04) \
+    X( 6.29374933831637162034e-04) \
+    X( 6.29004264509917614644e-04) \
+    X( 6.28356672711923979618e-04) \
+    X( 6.27435258015602670238e-04) \
+    X( 6.26243216327530610385e-04) \
+    X( 6.24783837437580067548e-04) \
+    X( 6.23060502551831571320e-04) \
+    X( 6.21076681805128117189e-04) \
+    X( 6.18835931754663313292e-04) \
+    X( 6.16341892855999597296e-04) \
+    X( 6.13598286922899423257e-04) \
+    X( 6.10608914572360016171e-04) \
+    X( 6.07377652656219848941e-04) \
+    X( 6.03908451680720608987e-04) \
+    X( 6.00205333215381750360e-04) \
+    X( 5.96272387292547546150e-04) \
+    X( 5.92113769798962869678e-04) \
+    X( 5.87733699860716260477e-04) \
+    X( 5.83136457222883410056e-04) \
+    X( 5.78326379625196070923e-04) \
+    X( 5.73307860175058681823e-04) \
+    X( 5.68085344719199331932e-04) \
+    X( 5.62663329215264671791e-04) \
+    X( 5.57046357104629347515e-04) \
+    X( 5.51239016687691835844e-04) \
+    X( 5.45245938502918582949e-04) \
+    X( 5.39071792710859535452e-04) \
+    X( 5.32721286484389919269e-04) \
+    X( 5.26199161406370888652e-04) \
+    X( 5.19510190875949965511e-04) \
+    X( 5.12659177524647379116e-04) \
+    X( 5.05650950643461694588e-04) \
+    X( 4.98490363622070692395e-04) \
+    X( 4.91182291401325650700e-04) \
+    X( 4.83731627940122419548e-04) \
+    X( 4.76143283697776802978e-04) \
+    X( 4.68422183132952726740e-04) \
+    X( 4.60573262220249240485e-04) \
+    X( 4.52601465985464203410e-04) \
+    X( 4.44511746060588389465e-04) \
+    X( 4.36309058259498746754e-04) \
+    X( 4.27998360175392566791e-04) \
+    X( 4.19584608800889610671e-04) \
+    X( 4.11072758171783069880e-04) \
+    X( 4.02467757035333936928e-04) \
+    X( 3.93774546544049656484e-04) \
+    X( 3.84998057975832470683e-04) \
+    X( 3.76143210481313700240e-04) \
+    X( 3.67214908859312392543e-04) \
+    X( 3.58218041361136620669e-04) \
+    X( 3.49157477524604336044e-04) \
+    X( 3.40038066038525694287e-04) \
+    X( 3.30864632638427479810e-04) \
+    X( 3.21641978034209344382e-04) \
+    X( 3.12374875870502510550e-04) \
+    X( 3.03068070720368721877e-04) \
+    X( 2.93726276113044930307e-04) \
+    X( 2.84354172596324122988e-04) \
+    X( 2.74956405834251703824e-04) \
+    X( 2.65537584740686090270e-04) \
+    X( 2.56102279649332684359e-04) \
+    X( 2.46655020520732712157e-04) \
+    X( 2.37200295186851598233e-04) \
+    X( 2.27742547633623577692e-04) \
+    X( 2.18286176322046336163e-04) \
+    X( 2.08835532548216017655e-04) \
+    X( 1.99394918842769620351e-04) \
+    X( 1.89968587410093434423e-04) \
+    X( 1.80560738607737464008e-04) \
+    X( 1.71175519466368710516e-04) \
+    X( 1.61817022250571095152e-04) \
+    X( 1.52489283060860649410e-04) \
+    X( 1.43196280477158617963e-04) \
+    X( 1.33941934244020521144e-04) \
+    X( 1.24730103997818122337e-04) \
+    X( 1.15564588036148766046e-04) \
+    X( 1.06449122129624024050e-04) \
+    X( 9.73873783762444747338e-05) \
+    X( 8.83829640984437603628e-05) \
+    X( 7.94394207830501368397e-05) \
+    X( 7.05602230641164422306e-05) \
+    X( 6.17487777488439845697e-05) \
+    X( 5.30084228865277819307e-05) \
+    X( 4.43424268807018922721e-05) \
+    X( 3.57539876443504868529e-05) \
+    X( 2.72462317982963840894e-05) \
+    X( 1.88222139126731892130e-05) \
+    X( 1.04849157914673770899e-05) \
+    X( 2.23724580001398245952e-06) \
+    X(-5.91796176458841909860e-06) \
+    X(-1.39779472603022615363e-05) \
+    X(-2.19400262443108254274e-05) \
+    X(-2.98015899747312779436e-05) \
+    X(-3.75601058699388188874e-05) \
+    X(-4.52131179258346812058e-05) \
+    X(-5.27582470911579511194e-05) \
+    X(-6.01931916011169823111e-05) \
+    X(-6.75157272696155086192e-05) \
+    X(-7.47237077402686759994e-05) \
+    X(-8.18150646965978259242e-05) \
+    X(-8.87878080315813176041e-05) \
+    X(-9.56400259770174112402e-05) \
+    X(-1.02369885192932295447e-04) \
+    X(-1.08975630817447491838e-04) \
+    X(-1.15455586477445233109e-04) \
+    X(-1.21808154260462635915e-04) \
+    X(-1.28031814648165977134e-04) \
+    X(-1.34125126411867404445e-04) \
+    X(-1.40086726470483718130e-04) \
+    X(-1.45915329711446663599e-04) \
+    X(-1.51609728774925367391e-04) \
+    X(-1.57168793801964925671e-04) \
+    X(-1.62591472146915872604e-04) \
+    X(-1.67876788054762332352e-04) \
+    X(-1.73023842303760092562e-04) \
+    X(-1.78031811814023872061e-04) \
+    X(-1.82899949222519527144e-04) \
+    X(-1.87627582425063416539e-04) \
+    X(-1.92214114085866635134e-04) \
+    X(-1.96659021115234305434e-04) \
+    X(-2.00961854115964548605e-04) \
+    X(-2.05122236799067813760e-04) \
+    X(-2.09139865369424642018e-04) \
+    X(-2.13014507881963919287e-04) \
+    X(-2.16746003569016719827e-04) \
+    X(-2.20334262139455170628e-04) \
+    X(-2.23779263050288623272e-04) \
+    X(-2.27081054751326671731e-04) \
+    X(-2.30239753903598189230e-04) \
+    X(-2.33255544572162539776e-04) \
+    X(-2.36128677394024743099e-04) \
+    X(-2.38859468721759089912e-04) \
+    X(-2.41448299743606627134e-04) \
+    X(-2.43895615580664562507e-04) \
+    X(-2.46201924361897988517e-04) \
+    X(-2.48367796277648787261e-04) \
+    X(-2.50393862612362249915e-04) \
+    X(-2.52280814757210175570e-04) \
+    X(-2.54029403203337271477e-04) \
+    X(-2.55640436516424906718e-04) \
+    X(-2.57114780293308988878e-04) \
+    X(-2.58453356101321892260e-04) \
+    X(-2.59657140401130335366e-04) \
+    X(-2.60727163453730896234e-04) \
+    X(-2.61664508212373382850e-04) \
+    X(-2.62470309200077975623e-04) \
+    X(-2.63145751373508769710e-04) \
+    X(-2.63692068973905575490e-04) \
+    X(-2.64110544365773612825e-04) \
+    X(-2.64402506864084673854e-04) \
+    X(-2.64569331550674807438e-04) \
+    X(-2.64612438080565591254e-04) \
+    X(-2.64533289478916812908e-04) \
+    X(-2.64333390929326621406e-04) \
+    X(-2.64014288554176887285e-04) \
+    X(-2.63577568187730454374e-04) \
+    X(-2.63024854142685936189e-04) \
+    X(-2.62357807970878796362e-04) \
+    X(-2.61578127218826830911e-04) \
+    X(-2.60687544178804346540e-04) \
+    X(-2.59687824636131118095e-04) \
+    X(-2.58580766613355161020e-04) \
+    X(-2.57368199111998000473e-04) \
+    X(-2.56051980852535184582e-04) \
+    X(-2.54633999013272917245e-04) \
+    X(-2.53116167968770410229e-04) \
+    X(-2.51500428028467203686e-04) \
+    X(-2.49788744176148520739e-04) \
+    X(-2.47983104810888498049e-04) \
+    X(-2.46085520490098991209e-04) \
+    X(-2.44098022675305284133e-04) \
+    X(-2.42022662481256641692e-04) \
+    X(-2.39861509428983846149e-04) \
+    X(-2.37616650203396260988e-04) \
+    X(-2.35290187416002671578e-04) \
+    X(-2.32884238373345356290e-04) \
+    X(-2.30400933851706944807e-04) \
+    X(-2.27842416878660760553e-04) \
+    X(-2.25210841522004905167e-04) \
+    X(-2.22508371686640725982e-04) \
+    X(-2.19737179919906623887e-04) \
+    X(-2.16899446225907947382e-04) \
+    X(-2.13997356889345798732e-04) \
+    X(-2.11033103309352538255e-04) \
+    X(-2.08008880843819519632e-04) \
+    X(-2.04926887664708660573e-04) \
+    X(-2.01789323624807442155e-04) \
+    X(-1.98598389136399967663e-04) \
+    X(-1.95356284062287273917e-04) \
+    X(-1.92065206619610498147e-04) \
+    X(-1.88727352296894345393e-04) \
+    X(-1.85344912784731391314e-04) \
+    X(-1.81920074920499755819e-04) \
+    X(-1.78455019647530454055e-04) \
+    X(-1.74951920989073971512e-04) \
+    X(-1.71412945037461607323e-04) \
+    X(-1.67840248958807175192e-04) \
+    X(-1.64235980013589989322e-04) \
+    X(-1.60602274593463965847e-04) \
+    X(-1.56941257274607583660e-04) \
+    X(-1.53255039887926981963e-04) \
+    X(-1.49545720606400077326e-04) \
+    X(-1.45815383049865629223e-04) \
+    X(-1.42066095407511174204e-04) \
+    X(-1.38299909578337953649e-04) \
+    X(-1.34518860329830815736e-04) \
+    X(-1.30724964475093245915e-04) \
+    X(-1.26920220068654472992e-04) \
+    X(-1.23106605621173758290e-04) \
+    X(-1.19286079333219134950e-04) \
+    X(-1.15460578348350841244e-04) \
+    X(-1.11632018025632952099e-04) \
+    X(-1.07802291231779830637e-04) \
+    X(-1.03973267653065606659e-04) \
+    X(-1.00146793127148565233e-04) \
+    X(-9.63246889949230804435e-05) \
+    X(-9.25087514725346873358e-05) \
+    X(-8.87007510436452450671e-05) \
+    X(-8.49024318720545515026e-05) \
+    X(-8.11155112347393549661e-05) \
+    X(-7.73416789754019609908e-05) \
+    X(-7.35825969785674924512e-05) \
+    X(-6.98398986642887023612e-05) \
+    X(-6.61151885034750767074e-05) \
+    X(-6.24100415538899748772e-05) \
+    X(-5.87260030168200428450e-05) \
+    X(-5.50645878143974986741e-05) \
+    X(-5.14272801876128782695e-05) \
+    X(-4.78155333149380714058e-05) \
+    X(-4.42307689515766361233e-05) \
+    X(-4.06743770892715146635e-05) \
+    X(-3.71477156366324749162e-05) \
+    X(-3.36521101199027279356e-05) \
+    X(-3.01888534041130525139e-05) \
+    X(-2.67592054345224943665e-05) \
+    X(-2.33643929982665948157e-05) \
+    X(-2.00056095060906951114e-05) \
+    X(-1.66840147940797201324e-05) \
+    X(-1.34007349452439661363e-05) \
+    X(-1.01568621308437851693e-05) \
+    X(-6.95345447128813701427e-06) \
+    X(-3.79153591650250810366e-06) \
+    X(-6.72096145553293655593e-07) \
+    X( 2.40390951459279597616e-06) \
+    X( 5.43556015137456058426e-06) \
+    X( 8.42196931017640123499e-06) \
+    X( 1.13622850193110927676e-05) \
+    X( 1.42556897966238257746e-05) \
+    X( 1.71014006379341248229e-05) \
+    X( 1.98986689875390831126e-05) \
+    X( 2.26467806909793172563e-05) \
+    X( 2.53450559303131682314e-05) \
+    X( 2.79928491421220740245e-05) \
+    X( 3.05895489185053302676e-05) \
+    X( 3.31345778912925430443e-05) \
+    X( 3.56273925997451632237e-05) \
+    X( 3.80674833419947510364e-05) \
+    X( 4.04543740105068599521e-05) \
+    X( 4.27876219118044463113e-05) \
+    X( 4.50668175707753267513e-05) \
+    X( 4.72915845198089502860e-05) \
+    X( 4.94615790730713200283e-05) \
+    X( 5.15764900862005805371e-05) \
+    X( 5.36360387017334339240e-05) \
+    X( 5.56399780805481871900e-05) \
+    X( 5.75880931196438774090e-05) \
+    X( 5.94802001565561985590e-05) \
+    X( 6.13161466607366493955e-05) \
+    X( 6.30958109121965409621e-05) \
+    X( 6.48191016677504891876e-05) \
+    X( 6.64859578151715343739e-05) \
+    X( 6.80963480156043240521e-05) \
+    X( 6.96502703345347587470e-05) \
+    X( 7.11477518616810702089e-05) \
+    X( 7.25888483201263885920e-05) \
+    X( 7.39736436650163245096e-05) \
+    X( 7.53022496721903708853e-05) \
+    X( 7.65748055170595645635e-05) \
+    X( 7.77914773440878826866e-05) \
+    X( 7.89524578272120806021e-05) \
+    X( 8.00579657215541123884e-05) \
+    X( 8.11082454067584148567e-05) \
+    X( 8.21035664223097817662e-05) \
+    X( 8.30442229951717527346e-05) \
+    X( 8.39305335600990616227e-05) \
+    X( 8.47628402729624154692e-05) \
+    X( 8.55415085174379832356e-05) \
+    X( 8.62669264054029689666e-05) \
+    X( 8.69395042713942022743e-05) \
+    X( 8.75596741614536786501e-05) \
+    X( 8.81278893167311284636e-05) \
+    X( 8.86446236521661512422e-05) \
+    X( 8.91103712306026604075e-05) \
+    X( 8.95256457326717546962e-05) \
+    X( 8.98909799227875892661e-05) \
+    X( 9.02069251115862640782e-05) \
+    X( 9.04740506151490363976e-05) \
+    X( 9.06929432113401867103e-05) \
+    X( 9.08642065935940279782e-05) \
+    X( 9.09884608224771455898e-05) \
+    X( 9.10663417753510066833e-05) \
+    X( 9.10985005944656069544e-05) \
+    X( 9.10856031337957275460e-05) \
+    X( 9.10283294049456589850e-05) \
+    X( 9.09273730224310103125e-05) \
+    X( 9.07834406486567112131e-05) \
+    X( 9.05972514388884682737e-05) \
+    X( 9.03695364865346147717e-05) \
+    X( 9.01010382690298824038e-05) \
+    X( 8.97925100946232214449e-05) \
+    X( 8.94447155503604388049e-05) \
+    X( 8.90584279515538464710e-05) \
+    X( 8.86344297930203114553e-05) \
+    X( 8.81735122023717546660e-05) \
+    X( 8.76764743956322256668e-05) \
+    X( 8.71441231354561004216e-05) \
+    X( 8.65772721922116491981e-05) \
+    X( 8.59767418081955635050e-05) \
+    X( 8.53433581652348287718e-05) \
+    X( 8.46779528559294970011e-05) \
+    X( 8.39813623587842351167e-05) \
+    X( 8.32544275174723505482e-05) \
+    X( 8.24979930244696123580e-05) \
+    X( 8.17129069092911340059e-05) \
+    X( 8.09000200315580515319e-05) \
+    X( 8.00601855791177764851e-05) \
+    X( 7.91942585714318722121e-05) \
+    X( 7.83030953684469709260e-05) \
+    X( 7.73875531851490379041e-05) \
+    X( 7.64484896120066966278e-05) \
+    X( 7.54867621414943666810e-05) \
+    X( 7.45032277008856680736e-05) \
+    X( 7.34987421914997258445e-05) \
+    X( 7.24741600345781298914e-05) \
+    X( 7.14303337239639759421e-05) \
+    X( 7.03681133857495075701e-05) \
+    X( 6.92883463450485250238e-05) \
+    X( 6.81918767000556897513e-05) \
+    X( 6.70795449035298084342e-05) \
+    X( 6.59521873518545653477e-05) \
+    X( 6.48106359818019012913e-05) \
+    X( 6.36557178751403541801e-05) \
+    X( 6.24882548712000070136e-05) \
+    X( 6.13090631875229413088e-05) \
+    X( 6.01189530487050480105e-05) \
+    X( 5.89187283235398522627e-05) \
+    X( 5.77091861705600261078e-05) \
+    X( 5.64911166920768371556e-05) \
+    X( 5.52653025968012133018e-05) \
+    X( 5.40325188711331935503e-05) \
+    X( 5.27935324591918643858e-05) \
+    X( 5.15491019516612150597e-05) \
+    X( 5.02999772835162253098e-05) \
+    X( 4.90468994406823114189e-05) \
+    X( 4.77906001756943685883e-05) \
+    X( 4.65318017323872241855e-05) \
+    X( 4.52712165796745444508e-05) \
+    X( 4.40095471544385224527e-05) \
+    X( 4.27474856135762158195e-05) \
+    X( 4.14857135952114382585e-05) \
+    X( 4.02249019891050019768e-05) \
+    X( 3.89657107162695045101e-05) \
+    X( 3.77087885178019617646e-05) \
+    X( 3.64547727529321324196e-05) \
+    X( 3.52042892062907349744e-05) \
+    X( 3.39579519043854685862e-05) \
+    X( 3.27163629412759540162e-05) \
+    X( 3.14801123134230239524e-05) \
+    X( 3.02497777637023744978e-05) \
+    X( 2.90259246345387218443e-05) \
+    X( 2.78091057301432964695e-05) \
+    X( 2.65998611878025348972e-05) \
+    X( 2.53987183581919854364e-05) \
+    X( 2.42061916946511448772e-05) \
+    X( 2.30227826513813061706e-05) \
+    X( 2.18489795905047869758e-05) \
+    X( 2.06852576979222047276e-05) \
+    X( 1.95320789079097866306e-05) \
+    X( 1.83898918363816234168e-05) \
+    X( 1.72591317227478167385e-05) \
+    X( 1.61402203802856600485e-05) \
+    X( 1.50335661549492530784e-05) \
+    X( 1.39395638925266073790e-05) \
+    X( 1.28585949140593193966e-05) \
+    X( 1.17910269994264146578e-05) \
+    X( 1.07372143790027249535e-05) \
+    X( 9.69749773328629209753e-06) \
+    X( 8.67220420039572420566e-06) \
+    X( 7.66164739132314657512e-06) \
+    X( 6.66612741284622437347e-06) \
+    X( 5.68593089796976951548e-06) \
+    X( 4.72133104379410701050e-06) \
+    X( 3.77258765668374723169e-06) \
+    X( 2.83994720461857994069e-06) \
+    X( 1.92364287659795633360e-06) \
+    X( 1.02389464897677183691e-06) \
+    X( 1.40909358598783243636e-07) \
+    X(-7.25119217400925882488e-07) \
+    X(-1.57401027526573751796e-06) \
+    X(-2.40559589188401177682e-06) \
+    X(-3.21972092580435969379e-06) \
+    X(-4.01624291213239929447e-06) \
+    X(-4.79503195145223449727e-06) \
+    X(-5.55597059291959898474e-06) \
+    X(-6.29895371166915398527e-06) \
+    X(-7.02388838068995278969e-06) \
+    X(-7.73069373730662337714e-06) \
+    X(-8.41930084443043260571e-06) \
+    X(-9.08965254672049638874e-06) \
+    X(-9.74170332181420186798e-06) \
+    X(-1.03754191267770145960e-05) \
+    X(-1.09907772399306088372e-05) \
+    X(-1.15877660982095854786e-05) \
+    X(-1.21663851302071818753e-05) \
+    X(-1.27266445850638015879e-05) \
+    X(-1.32685653573596831328e-05) \
+    X(-1.37921788081646564831e-05) \
+    X(-1.42975265824070264185e-05) \
+    X(-1.47846604227169150120e-05) \
+    X(-1.52536419799077777845e-05) \
+    X(-1.57045426202454864190e-05) \
+    X(-1.61374432296745794440e-05) \
+    X(-1.65524340151509907705e-05) \
+    X(-1.69496143032443776877e-05) \
+    X(-1.73290923361651281922e-05) \
+    X(-1.76909850653765942752e-05) \
+    X(-1.80354179429455134585e-05) \
+    X(-1.83625247107888849940e-05) \
+    X(-1.86724471879742999741e-05) \
+    X(-1.89653350562250020523e-05) \
+    X(-1.92413456437866339777e-05) \
+    X(-1.95006437078064384194e-05) \
+    X(-1.97434012153796016272e-05) \
+    X(-1.99697971234102591856e-05) \
+    X(-2.01800171574394671614e-05) \
+    X(-2.03742535895865872536e-05) \
+    X(-2.05527050157544749519e-05) \
+    X(-2.07155761322383869926e-05) \
+    X(-2.08630775118898238230e-05) \
+    X(-2.09954253799722451970e-05) \
+    X(-2.11128413898529763743e-05) \
+    X(-2.12155523986690494219e-05) \
+    X(-2.13037902431062623279e-05) \
+    X(-2.13777915154254429865e-05) \
+    X(-2.14377973398712400380e-05) \
+    X(-2.14840531495946086989e-05) \
+    X(-2.15168084642204138245e-05) \
+    X(-2.15363166681862903517e-05) \
+    X(-2.15428347899803886579e-05) \
+    X(-2.15366232824005027408e-05) \
+    X(-2.15179458039577262574e-05) \
+    X(-2.14870690015422825217e-05) \
+    X(-2.14442622944694083432e-05) \
+    X(-2.13897976600211963056e-05) \
+    X(-2.13239494205938423077e-05) \
+    X(-2.12469940325636042692e-05) \
+    X(-2.11592098769767039874e-05) \
+    X(-2.10608770521689021838e-05) \
+    X(-2.09522771684173563140e-05) \
+    X(-2.08336931447246940868e-05) \
+    X(-2.07054090078323760555e-05) \
+    X(-2.05677096935581607638e-05) \
+    X(-2.04208808505498906150e-05) \
+    X(-2.02652086465450858026e-05) \
+    X(-2.01009795772225878085e-05) \
+    X(-1.99284802777307897448e-05) \
+    X(-1.97479973369733553508e-05) \
+    X(-1.95598171147313057406e-05) \
+    X(-1.93642255616965921713e-05) \
+    X(-1.91615080424908975211e-05) \
+    X(-1.89519491617392180451e-05) \
+    X(-1.87358325932659067312e-05) \
+    X(-1.85134409124775290410e-05) \
+    X(-1.82850554319945745078e-05) \
+    X(-1.80509560405904254164e-05) \
+    X(-1.78114210454942761765e-05) \
+    X(-1.75667270181107023892e-05) \
+    X(-1.73171486432067083623e-05) \
+    X(-1.70629585716134836285e-05) \
+    X(-1.68044272764881711800e-05) \
+    X(-1.65418229131769521309e-05) \
+    X(-1.62754111827191523261e-05) \
+    X(-1.60054551990284544996e-05) \
+    X(-1.57322153597849753270e-05) \
+    X(-1.54559492210684566130e-05) \
+    X(-1.51769113757617390406e-05) \
+    X(-1.48953533357483810943e-05) \
+    X(-1.46115234179280960335e-05) \
+    X(-1.43256666340692667526e-05) \
+    X(-1.40380245845161517285e-05) \
+    X(-1.37488353557644599467e-05) \
+    X(-1.34583334219182035850e-05) \
+    X(-1.31667495500361276861e-05) \
+    X(-1.28743107093750131593e-05) \
+    X(-1.25812399845332226092e-05) \
+    X(-1.22877564924967183814e-05) \
+    X(-1.19940753035859587103e-05) \
+    X(-1.17004073663007361519e-05) \
+    X(-1.14069594360560160192e-05) \
+    X(-1.11139340078022052344e-05) \
+    X(-1.08215292525168970740e-05) \
+    X(-1.05299389575568482923e-05) \
+    X(-1.02393524708539662493e-05) \
+    X(-9.94995464893742348120e-06) \
+    X(-9.66192580876271611343e-06) \
+    X(-9.37544168332491989210e-06) \
+    X(-9.09067338103246418157e-06) \
+    X(-8.80778734881422739372e-06) \
+    X(-8.52694533893248795902e-06) \
+    X(-8.24830437947059051977e-06) \
+    X(-7.97201674846333152320e-06) \
+    X(-7.69822995163491404110e-06) \
+    X(-7.42708670370925303302e-06) \
+    X(-7.15872491325360909230e-06) \
+    X(-6.89327767101633304933e-06) \
+    X(-6.63087324171573705124e-06) \
+    X(-6.37163505923899323223e-06) \
+    X(-6.11568172520321447157e-06) \
+    X(-5.86312701083429459631e-06) \
+    X(-5.61407986211404469277e-06) \
+    X(-5.36864440814655013182e-06) \
+    X(-5.12691997269171846217e-06) \
+    X(-4.88900108881444233564e-06) \
+    X(-4.65497751659457443244e-06) \
+    X(-4.42493426384305196255e-06) \
+    X(-4.19895160976678087265e-06) \
+    X(-3.97710513152554464493e-06) \
+    X(-3.75946573362158312445e-06) \
+    X(-3.54609968006129461300e-06) \
+    X(-3.33706862922910230812e-06) \
+    X(-3.13242967141053148128e-06) \
+    X(-2.93223536890220278037e-06) \
+    X(-2.73653379864365903313e-06) \
+    X(-2.54536859730841838172e-06) \
+    X(-2.35877900878616331091e-06) \
+    X(-2.17679993399191934131e-06) \
+    X(-1.99946198293410626841e-06) \
+    X(-1.82679152897453787459e-06) \
+    X(-1.65881076521146377169e-06) \
+    X(-1.49553776291791911430e-06) \
+    X(-1.33698653196547020166e-06) \
+    X(-1.18316708316432299485e-06) \
+    X(-1.03408549244911473199e-06) \
+    X(-8.89743966841013678409e-07) \
+    X(-7.50140912114827378233e-07) \
+    X(-6.15271002100918799020e-07) \
+    X(-4.85125249549975873449e-07) \
+    X(-3.59691078491283933177e-07) \
+    X(-2.38952398011216803052e-07) \
+    X(-1.22889677382464548894e-07)
+
+#define LSRAC__FILTER_F32(coefficient) coefficient##f,
+#define LSRAC__FILTER_F64(coefficient) coefficient,
+
+const lsrac_filter_t lsrac_filter = {
+    128,
+    {
+        LSRAC__FILTER_COEFFICIENTS(LSRAC__FILTER_F32)
+    },
+};
+
+const lsrac_filter_f64_t lsrac_filter_f64 = {
     128,
     {
-         8.31472372954840555082e-01f,
-         8.31414005540308198583e-01f,
-         8.31238918266223869580e-01f,
-         8.30947156036480505392e-01f,
-         8.30538793675450581766e-01f,
-         8.30013935904800659316e-01f,
-         8.29372717311066987023e-01f,
-         8.28615302303967515840e-01f,
-         8.27741885065490623496e-01f,
-         8.26752689489751890761e-01f,
-         8.25647969113678215081e-01f,
-         8.24428007038499943704e-01f,
-         8.23093115842108757896e-01f,
-         8.21643637482293187624e-01f,
-         8.20079943190897053817e-01f,
-         8.18402433358933589780e-01f,
-         8.16611537412689103554e-01f,
-         8.14707713680854150873e-01f,
-         8.12691449252757824873e-01f,
-         8.10563259827706050764e-01f,
-         8.08323689555523805517e-01f,
-         8.05973310868314363198e-01f,
-         8.03512724303517833491e-01f,
-         8.00942558318331943035e-01f,
-         7.98263469095534694553e-01f,
-         7.95476140340800830231e-01f,
-         7.92581283071560838138e-01f,
-         7.89579635397499868255e-01f,
-         7.86471962292734527722e-01f,
-         7.83259055359786127148e-01f,
-         7.79941732585400893107e-01f,
-         7.76520838088307852054e-01f,
-         7.72997241859018080490e-01f,
-         7.69371839491718167992e-01f,
-         7.65645551908390675777e-01f,
-         7.61819325075220210586e-01f,
-         7.57894129711408459649e-01f,
-         7.53870960990470018181e-01f,
-         7.49750838234153449413e-01f,
-         7.45534804599028211314e-01f,
-         7.41223926755909090502e-01f,
-         7.36819294562192195208e-01f,
-         7.32322020727209643809e-01f,
-         7.27733240470738174110e-01f,
-         7.23054111174766811487e-01f,
-         7.18285812028632841830e-01f,
-         7.13429543667664534112e-01f,
-         7.08486527805442301009e-01f,
-         7.03458006859804640953e-01f,
-         6.98345243572719653891e-01f,
-         6.93149520624175785599e-01f,
-         6.87872140240182283755e-01f,
-         6.82514423795047564525e-01f,
-         6.77077711408058502407e-01f,
-         6.71563361534684655219e-01f,
-         6.65972750552474845875e-01f,
-         6.60307272341742135247e-01f,
-         6.54568337861228477514e-01f,
-         6.48757374718860524432e-01f,
-         6.42875826737744904271e-01f,
-         6.36925153517562181449e-01f,
-         6.30906829991492501541e-01f,
-         6.24822345978837789815e-01f,
-         6.18673205733470954470e-01f,
-         6.12460927488293727095e-01f,
-         6.06187042995817604307e-01f,
-         5.99853097065060292259e-01f,
-         5.93460647094893878339e-01f,
-         5.87011262603992944875e-01f,
-         5.80506524757569142281e-01f,
-         5.73948025891025337408e-01f,
-         5.67337369030688098981e-01f,
-         5.60676167411809700525e-01f,
-         5.53966043993961543279e-01f,
-         5.47208630974010734604e-01f,
-         5.40405569296826038261e-01f,
-         5.33558508163880174102e-01f,
-         5.26669104539922661168e-01f,
-         5.19739022657876970079e-01f,
-         5.12769933522119303326e-01f,
-         5.05763514410336290084e-01f,
-         4.98721448374081555155e-01f,
-         4.91645423738241937883e-01f,
-         4.84537133599546865348e-01f,
-         4.77398275324308896117e-01f,
-         4.70230550045545592219e-01f,
-         4.63035662159660077464e-01f,
-         4.55815318822846149427e-01f,
-         4.48571229447379538069e-01f,
-         4.41305105197960123586e-01f,
-         4.34018658488283970431e-01f,
-         4.26713602477997000495e-01f,
-         4.19391650570203500248e-01f,
-         4.12054515909689722530e-01f,
-         4.04703910882034223473e-01f,
-         3.97341546613763640927e-01f,
-         3.89969132473721613596e-01f,
-         3.82588375575806771689e-01f,
-         3.75200980283257823356e-01f,
-         3.67808647714624070701e-01f,
-         3.60413075251609871241e-01f,
-         3.53015956048925771960e-01f,
-         3.45618978546330835044e-01f,
-         3.38223825983006376461e-01f,
-         3.30832175914426429575e-01f,
-         3.23445699731881031180e-01f,
-         3.16066062184803764357e-01f,
-         3.08694920906066150312e-01f,
-         3.01333925940378832831e-01f,
-         2.93984719275965256102e-01f,
-         2.86648934379644393378e-01f,
-         2.79328195735489559492e-01f,
-         2.72024118387182545220e-01f,
-         2.64738307484245039003e-01f,
-         2.57472357832259801658e-01f,
-         2.50227853447243409057e-01f,
-         2.43006367114305704691e-01f,
-         2.35809459950733935063e-01f,
-         2.28638680973647728800e-01f,
-         2.21495566672345989279e-01f,
-         2.14381640585498134399e-01f,
-         2.07298412883298144305e-01f,
-         2.00247379954717363848e-01f,
-         1.93230023999986955108e-01f,
-         1.86247812628430653437e-01f,
-         1.79302198461779749294e-01f,
-         1.72394618743085786816e-01f,
-         1.65526494951356295537e-01f,
-         1.58699232422028796430e-01f,
-         1.51914219973401071195e-01f,
-         1.45172829539132269838e-01f,
-         1.38476415806921215879e-01f,
-         1.31826315863480453272e-01f,
-         1.25223848845901208904e-01f,
-         1.18670315599523901184e-01f,
-         1.12166998342411894374e-01f,
-         1.05715160336527447260e-01f,
-         9.93160455657086521652e-02f,
-         9.29708784205405536216e-02f,
-         8.66808633902153846673e-02f,
-         8.04471847614677826321e-02f,
-         7.42710063246745516574e-02f,
-         6.81534710872001986415e-02f,
-         6.20957009940759641076e-02f,
-         5.60987966560835549235e-02f,
-         5.01638370853247708703e-02f,
-         4.42918794383505357026e-02f,
-         3.84839587669171534490e-02f,
-         3.27410877764400740086e-02f,
-         2.70642565922108620236e-02f,
-         2.14544325334371267788e-02f,
-         1.59125598951669576520e-02f,
-         1.04395597381551803740e-02f,
-         5.03632968672305773861e-03f,
-        -2.96256265336385191805e-04f,
-        -5.55734794075828358179e-03f,
-        -1.07461191566687631893e-02f,
-        -1.58617678942645466689e-02f,
-        -2.09035164602743607498e-02f,
-        -2.58706116401622790435e-02f,
-        -3.07623248430414844568e-02f,
-        -3.55779522382659724178e-02f,
-        -4.03168148836769782428e-02f,
-        -4.49782588454727128013e-02f,
-        -4.95616553096875425699e-02f,
-        -5.40664006852556791594e-02f,
-        -5.84919166986474642345e-02f,
-        -6.28376504800633867154e-02f,
-        -6.71030746411782619276e-02f,
-        -7.12876873444269476554e-02f,
-        -7.53910123638282386738e-02f,
-        -7.94125991373483691715e-02f,
-        -8.33520228108008270906e-02f,
-        -8.72088842732959695914e-02f,
-        -9.09828101842390379872e-02f,
-        -9.46734529918955292072e-02f,
-        -9.82804909435327500589e-02f,
-        -1.01803628087157427284e-01f,
-        -1.05242594264867719844e-01f,
-        -1.08597145097841310535e-01f,
-        -1.11867061962988789681e-01f,
-        -1.15052151961296145188e-01f,
-        -1.18152247877890054228e-01f,
-        -1.21167208133862752684e-01f,
-        -1.24096916729885473063e-01f,
-        -1.26941283181660202750e-01f,
-        -1.29700242447243679900e-01f,
-        -1.32373754846295377252e-01f,
-        -1.34961805971292009287e-01f,
-        -1.37464406590764143257e-01f,
-        -1.39881592544604443917e-01f,
-        -1.42213424631507739937e-01f,
-        -1.44459988488595730827e-01f,
-        -1.46621394463294696386e-01f,
-        -1.48697777477524800682e-01f,
-        -1.50689296884269657850e-01f,
-        -1.52596136316595465399e-01f,
-        -1.54418503529190731527e-01f,
-        -1.56156630232500315270e-01f,
-        -1.57810771919529219121e-01f,
-        -1.59381207685401427021e-01f,
-        -1.60868240039743037872e-01f,
-        -1.62272194711985145998e-01f,
-        -1.63593420449666626659e-01f,
-        -1.64832288809824062392e-01f,
-        -1.65989193943563151379e-01f,
-        -1.67064552373901109572e-01f,
-        -1.68058802766975601273e-01f,
-        -1.68972405696717037360e-01f,
-        -1.69805843403086798027e-01f,
-        -1.70559619543971530131e-01f,
-        -1.71234258940853617537e-01f,
-        -1.71830307318344255307e-01f,
-        -1.72348331037702334756e-01f,
-        -1.72788916824434257702e-01f,
-        -1.73152671490098081231e-01f,
-        -1.73440221648409775845e-01f,
-        -1.73652213425782242506e-01f,
-        -1.73789312166397952319e-01f,
-        -1.73852202131942051855e-01f,
-        -1.73841586196111674845e-01f,
-        -1.73758185534021086793e-01f,
-        -1.73602739306629005878e-01f,
-        -1.73376004340306061335e-01f,
-        -1.73078754801670009478e-01f,
-        -1.72711781867818603420e-01f,
-        -1.72275893392080048372e-01f,
-        -1.71771913565416961545e-01f,
-        -1.71200682573611373538e-01f,
-        -1.70563056250360139954e-01f,
-        -1.69859905726417126370e-01f,
-        -1.69092117074913228514e-01f,
-        -1.68260590952989147473e-01f,
-        -1.67366242239875284703e-01f,
-        -1.66409999671557895518e-01f,
-        -1.65392805472166642966e-01f,
-        -1.64315614982222552021e-01f,
-        -1.63179396283883837437e-01f,
-        -1.61985129823331186483e-01f,
-        -1.60733808030429803360e-01f,
-        -1.59426434935813571281e-01f,
-        -1.58064025785527417778e-01f,
-        -1.56647606653372045704e-01f,
-        -1.55178214051094831571e-01f,
-        -1.53656894536566474008e-01f,
-        -1.52084704320088470730e-01f,
-        -1.50462708868975059140e-01f,
-        -1.48791982510548842500e-01f,
-        -1.47073608033699704256e-01f,
-        -1.45308676289147314931e-01f,
-        -1.43498285788550977715e-01f,
-        -1.41643542302611558092e-01f,
-        -1.39745558458309881988e-01f,
-        -1.37805453335422323224e-01f,
-        -1.35824352062461073398e-01f,
-        -1.33803385412180564362e-01f,
-        -1.31743689396791985313e-01f,
-        -1.29646404863030306753e-01f,
-        -1.27512677087215337002e-01f,
-        -1.25343655370452389253e-01f,
-        -1.23140492634104758984e-01f,
-        -1.20904345015691472298e-01f,
-        -1.18636371465341922127e-01f,
-        -1.16337733342949820048e-01f,
-        -1.14009594016166518338e-01f,
-        -1.11653118459372716065e-01f,
-        -1.09269472853762789066e-01f,
-        -1.06859824188683741331e-01f,
-        -1.04425339864360325337e-01f,
-        -1.01967187296145456177e-01f,
-        -9.94865335204263567803e-02f,
-        -9.69845448023236023083e-02f,
-        -9.44623862453117940641e-02f,
-        -9.19212214028948121358e-02f,
-        -8.93622118924671249296e-02f,
-        -8.67865170114848205607e-02f,
-        -8.41952933560805999447e-02f,
-        -8.15896944422443981537e-02f,
-        -7.89708703296961439522e-02f,
-        -7.63399672485739477779e-02f,
-        -7.36981272290610500697e-02f,
-        -7.10464877340710454501e-02f,
-        -6.83861812951113146042e-02f,
-        -6.57183351514422919859e-02f,
-        -6.30440708926501142129e-02f,
-        -6.03645041047437408421e-02f,
-        -5.76807440198948140342e-02f,
-        -5.49938931699267691267e-02f,
-        -5.23050470436661057994e-02f,
-        -4.96152937482609926456e-02f,
-        -4.69257136745778041798e-02f,
-        -4.42373791667729082677e-02f,
-        -4.15513541961495605492e-02f,
-        -3.88686940393953503370e-02f,
-        -3.61904449613011935938e-02f,
-        -3.35176439020573244121e-02f,
-        -3.08513181692228674602e-02f,
-        -2.81924851344595717162e-02f,
-        -2.55421519351213023585e-02f,
-        -2.29013151807887539724e-02f,
-        -2.02709606648342685609e-02f,
-        -1.76520630811025022733e-02f,
-        -1.50455857457888787787e-02f,
-        -1.24524803245954687053e-02f,
-        -9.87368656524285036313e-03f,
-        -7.31013203541311037958e-03f,
-        -4.76273186619807602227e-03f,
-        -2.23238850112297869746e-03f,
-         2.80008549183706099625e-04f,
-         2.77358294660976899965e-03f,
-         5.24747175940274562800e-03f,
-         7.70082569017439908660e-03f,
-         1.01328092980087648006e-02f,
-         1.25426012146140665460e-02f,
-         1.49293943544662570388e-02f,
-         1.72923961188884665885e-02f,
-         1.96308285940195309527e-02f,
-         2.19439287426209730936e-02f,
-         2.42309485896793734561e-02f,
-         2.64911554017603391442e-02f,
-         2.87238318600733545660e-02f,
-         3.09282762272103349532e-02f,
-         3.31038025075217068327e-02f,
-         3.52497406010981520486e-02f,
-         3.73654364513253609004e-02f,
-         3.94502521859858221176e-02f,
-         4.15035662518817155542e-02f,
-         4.35247735429537541130e-02f,
-         4.55132855218787699125e-02f,
-         4.74685303351244439196e-02f,
-         4.93899529214478216765e-02f,
-         5.12770151138242716304e-02f,
-         5.31291957347935772660e-02f,
-         5.49459906852194576721e-02f,
-         5.67269130264521220797e-02f,
-         5.84714930558940249039e-02f,
-         6.01792783759655322551e-02f,
-         6.18498339564735599705e-02f,
-         6.34827421903864652641e-02f,
-         6.50776029430226859995e-02f,
-         6.66340335946605799577e-02f,
-         6.81516690765814614483e-02f,
-         6.96301619005592065115e-02f,
-         7.10691821818139612965e-02f,
-         7.24684176554465098175e-02f,
-         7.38275736863740761340e-02f,
-         7.51463732727930683319e-02f,
-         7.64245570431912463194e-02f,
-         7.76618832469397474272e-02f,
-         7.88581277384926976337e-02f,
-         8.00130839552289779837e-02f,
-         8.11265628889681067459e-02f,
-         8.21983930512013155623e-02f,
-         8.32284204320703352442e-02f,
-         8.42165084531432683868e-02f,
-         8.51625379140240473808e-02f,
-         8.60664069328434949702e-02f,
-         8.69280308806818224898e-02f,
-         8.77473423099686122839e-02f,
-         8.85242908769151987114e-02f,
-         8.92588432580306151420e-02f,
-         8.99509830607803234637e-02f,
-         9.06007107284422380511e-02f,
-         9.12080434392217309636e-02f,
-         9.17730149996878741270e-02f,
-         9.22956757325926607782e-02f,
-         9.27760923591415126443e-02f,
-         9.32143478757788968014e-02f,
-         9.36105414255621187669e-02f,
-         9.39647881641913207407e-02f,
-         9.42772191207702781046e-02f,
-         9.45479810533706027664e-02f,
-         9.47772362994778183598e-02f,
-         9.49651626213951355338e-02f,
-         9.51119530466846413441e-02f,
-         9.52178157037280176178e-02f,
-         9.52829736524876819148e-02f,
-         9.53076647105531166160e-02f,
-         9.52921412745576373871e-02f,
-         9.52366701370536278271e-02f,
-         9.51415322989309503177e-02f,
-         9.50070227774735681647e-02f,
-         9.48334504101390751707e-02f,
-         9.46211376541590265532e-02f,
-         9.43704203820504156086e-02f,
-         9.40816476731309581094e-02f,
-         9.37551816011396865758e-02f,
-         9.33913970180541563870e-02f,
-         9.29906813342047527948e-02f,
-         9.25534342947849225647e-02f,
-         9.20800677528557931506e-02f,
-         9.15710054389489019888e-02f,
-         9.10266827273659706599e-02f,
-         9.04475463992783224043e-02f,
-         8.98340544027328158361e-02f,
-         8.91866756096650198371e-02f,
-         8.85058895700238101867e-02f,
-         8.77921862631190763615e-02f,
-         8.70460658462897246546e-02f,
-         8.62680384010083983748e-02f,
-         8.54586236765221690659e-02f,
-         8.46183508311429133375e-02f,
-         8.37477581712920277068e-02f,
-         8.28473928884114751980e-02f,
-         8.19178107938471483651e-02f,
-         8.09595760518180135312e-02f,
-         7.99732609105757996648e-02f,
-         7.89594454318716387764e-02f,
-         7.79187172188340326784e-02f,
-         7.68516711423724852015e-02f,
-         7.57589090662164482692e-02f,
-         7.46410395707000073884e-02f,
-         7.34986776754032733461e-02f,
-         7.23324445607601979047e-02f,
-         7.11429672887474440213e-02f,
-         6.99308785227581580779e-02f,
-         6.86968162467783832748e-02f,
-         6.74414234839716131287e-02f,
-         6.61653480147834510694e-02f,
-         6.48692420946761771905e-02f,
-         6.35537621716019962559e-02f,
-         6.22195686033254202751e-02f,
-         6.08673253747022482973e-02f,
-         5.94976998150253330588e-02f,
-         5.81113623155428762890e-02f,
-         5.67089860472591994478e-02f,
-         5.52912466791220663653e-02f,
-         5.38588220967053943333e-02f,
-         5.24123921214928872869e-02f,
-         5.09526382308646275110e-02f,
-         4.94802432788957607945e-02f,
-         4.79958912180662375380e-02f,
-         4.65002668219884549017e-02f,
-         4.49940554092515265783e-02f,
-         4.34779425684853407241e-02f,
-         4.19526138847447563340e-02f,
-         4.04187546673120054463e-02f,
-         3.88770496790168534895e-02f,
-         3.73281828671714888124e-02f,
-         3.57728370962169389680e-02f,
-         3.42116938821758476141e-02f,
-         3.26454331290065291604e-02f,
-         3.10747328669506231447e-02f,
-         2.95002689929673225788e-02f,
-         2.79227150133440210622e-02f,
-         2.63427417885741359249e-02f,
-         2.47610172805882329528e-02f,
-         2.31782063024293799591e-02f,
-         2.15949702704538760989e-02f,
-         2.00119669591453143431e-02f,
-         1.84298502586232419709e-02f,
-         1.68492699349288496680e-02f,
-         1.52708713931675090641e-02f,
-         1.36952954435869880129e-02f,
-         1.21231780706691841254e-02f,
-         1.05551502053105091677e-02f,
-         8.99183750016553651196e-03f,
-         7.43386010822696258193e-03f,
-         5.88183246471273707412e-03f,
-         4.33636307232945251988e-03f,
-         2.79805428998205086427e-03f,
-         1.26750212499337003291e-03f,
-        -2.54703971099550386531e-04f,
-        -1.76798130311027175757e-03f,
-        -3.27175412906725469539e-03f,
-        -4.76545385331804925710e-03f,
-        -6.24851921581533794464e-03f,
-        -7.72039647752874400727e-03f,
-        -9.18053960192777122884e-03f,
-        -1.06284104324833178490e-02f,
-        -1.20634788661366718077e-02f,
-        -1.34852230226875247771e-02f,
-        -1.48931294100519973078e-02f,
-        -1.62866930853476296615e-02f,
-        -1.76654178117594401476e-02f,
-        -1.90288162111466874205e-02f,
-        -2.03764099123495759369e-02f,
-        -2.17077296951579609696e-02f,
-        -2.30223156299061669505e-02f,
-        -2.43197172126588360974e-02f,
-        -2.55994934959561624976e-02f,
-        -2.68612132150869431513e-02f,
-        -2.81044549098614510063e-02f,
-        -2.93288070418574950415e-02f,
-        -3.05338681071131295974e-02f,
-        -3.17192467442452205595e-02f,
-        -3.28845618379712614776e-02f,
-        -3.40294426180154721551e-02f,
-        -3.51535287533818185945e-02f,
-        -3.62564704419792716017e-02f,
-        -3.73379284955845242022e-02f,
-        -3.83975744201309962533e-02f,
-        -3.94350904913155775322e-02f,
-        -4.04501698255130062720e-02f,
-        -4.14425164459938585870e-02f,
-        -4.24118453444415760556e-02f,
-        -4.33578825377650758921e-02f,
-        -4.42803651202084772032e-02f,
-        -4.51790413107587551789e-02f,
-        -4.60536704958539877541e-02f,
-        -4.69040232673985507672e-02f,
-        -4.77298814560914094751e-02f,
-        -4.85310381600771723054e-02f,
-        -4.93072977689298017068e-02f,
-        -5.00584759829825892696e-02f,
-        -5.07843998280173986037e-02f,
-        -5.14849076653303427964e-02f,
-        -5.21598491971914657306e-02f,
-        -5.28090854677170859488e-02f,
-        -5.34324888591782357072e-02f,
-        -5.40299430837655400572e-02f,
-        -5.46013431708381041796e-02f,
-        -5.51465954496810906171e-02f,
-        -5.56656175277993395256e-02f,
-        -5.61583382647804357779e-02f,
-        -5.66246977417538960298e-02f,
-        -5.70646472264832865795e-02f,
-        -5.74781491341238848225e-02f,
-        -5.78651769836829588112e-02f,
-        -5.82257153502198851469e-02f,
-        -5.85597598128258789441e-02f,
-        -5.88673168984241990120e-02f,
-        -5.91484040214318093631e-02f,
-        -5.94030494193287308957e-02f,
-        -5.96312920841784027681e-02f,
-        -5.98331816901454746627e-02f,
-        -6.00087785170606569096e-02f,
-        -6.01581533700810480725e-02f,
-        -6.02813874954959694197e-02f,
-        -6.03785724927326447609e-02f,
-        -6.04498102226119424230e-02f,
-        -6.04952127119116611631e-02f,
-        -6.05149020542914278797e-02f,
-        -6.05090103076376881197e-02f,
-        -6.04776793878847099273e-02f,
-        -6.04210609593744951695e-02f,
-        -6.03393163218124903291e-02f,
-        -6.02326162938837256222e-02f,
-        -6.01011410935896536745e-02f,
-        -5.99450802153716350018e-02f,
-        -5.97646323040843391317e-02f,
-        -5.95600050258849322837e-02f,
-        -5.93314149361059764431e-02f,
-        -5.90790873441773764507e-02f,
-        -5.88032561756684640786e-02f,
-        -5.85041638315173181950e-02f,
-        -5.81820610445198463379e-02f,
-        -5.78372067331465664064e-02f,
-        -5.74698678527617162759e-02f,
-        -5.70803192443151696800e-02f,
-        -5.66688434805820984153e-02f,
-        -5.62357307100216502471e-02f,
-        -5.57812784983319834287e-02f,
-        -5.53057916677746758127e-02f,
-        -5.48095821343453915020e-02f,
-        -5.42929687428649263015e-02f,
-        -5.37562771000702349644e-02f,
-        -5.31998394057807341695e-02f,
-        -5.26239942822169029513e-02f,
-        -5.20290866015511582754e-02f,
-        -5.14154673117670768523e-02f,
-        -5.07834932609073572141e-02f,
-        -5.01335270197884388943e-02f,
-        -4.94659367032617980353e-02f,
-        -4.87810957901005926018e-02f,
-        -4.80793829415919610204e-02f,
-        -4.73611818189140221236e-02f,
-        -4.66268808993793651418e-02f,
-        -4.58768732916221277929e-02f,
-        -4.51115565498113532672e-02f,
-        -4.43313324869706107401e-02f,
-        -4.35366069874822472774e-02f,
-        -4.27277898188581847783e-02f,
-        -4.19052944428566706558e-02f,
-        -4.10695378260253277092e-02f,
-        -4.02209402497498702544e-02f,
-        -3.93599251198885058400e-02f,
-        -3.84869187760717781921e-02f,
-        -3.76023503007467674308e-02f,
-        -3.67066513280452297319e-02f,
-        -3.58002558525536487832e-02f,
-        -3.48836000380640318119e-02f,
-        -3.39571220263849699039e-02f,
-        -3.30212617462878818553e-02f,
-        -3.20764607226682249563e-02f,
-        -3.11231618859974003277e-02f,
-        -3.01618093821427596390e-02f,
-        -2.91928483826300218251e-02f,
-        -2.82167248954252464221e-02f,
-        -2.72338855763107207109e-02f,
-        -2.62447775409285488646e-02f,
-        -2.52498481775659533444e-02f,
-        -2.42495449607560524530e-02f,
-        -2.32443152657647901516e-02f,
-        -2.22346061840382018537e-02f,
-        -2.12208643396787077773e-02f,
-        -2.02035357070221716080e-02f,
-        -1.91830654293842946256e-02f,
-        -1.81598976390459701524e-02f,
-        -1.71344752785447841659e-02f,
-        -1.61072399233397958729e-02f,
-        -1.50786316059164128556e-02f,
-        -1.40490886413957953571e-02f,
-        -1.30190474547137412242e-02f,
-        -1.19889424094323342185e-02f,
-        -1.09592056382471266657e-02f,
-        -9.93026687525074697183e-03f,
-        -8.90255329001433948211e-03f,
-        -7.87648932354562125724e-03f,
-        -6.85249652618241146540e-03f,
-        -5.83099339747908569642e-03f,
-        -4.81239522814202146106e-03f,
-        -3.79711394406930576734e-03f,
-        -2.78555795254968683455e-03f,
-        -1.77813199067227692071e-03f,
-        -7.75236976000132386663e-04f,
-         2.22730140442126654798e-04f,
-         1.21537651881706244492e-03f,
-         2.20231357271108733539e-03f,
-         3.18315710891246220898e-03f,
-         4.15752746468348553799e-03f,
-         5.12504964248380791986e-03f,
-         6.08535344210042478813e-03f,
-         7.03807359014245199208e-03f,
-         7.98284986685961206465e-03f,
-         8.91932723024580452476e-03f,
-         9.84715593738785290034e-03f,
-         1.07659916630240357766e-02f,
-         1.16754956152756248638e-02f,
-         1.25753346485176220604e-02f,
-         1.34651813733560731662e-02f,
-         1.43447142636787781933e-02f,
-         1.52136177607511777904e-02f,
-         1.60715823743268690360e-02f,
-         1.69183047807457617728e-02f,
-         1.77534879179936204430e-02f,
-         1.85768410776981605925e-02f,
-         1.93880799940382604618e-02f,
-         2.01869269295435888045e-02f,
-         2.09731107577651766649e-02f,
-         2.17463670427963037812e-02f,
-         2.25064381156266125894e-02f,
-         2.32530731473125917841e-02f,
-         2.39860282189490944815e-02f,
-         2.47050663884288181082e-02f,
-         2.54099577539762186418e-02f,
-         2.61004795144461655687e-02f,
-         2.67764160263764816605e-02f,
-         2.74375588577874841845e-02f,
-         2.80837068387202806741e-02f,
-         2.87146661085097808230e-02f,
-         2.93302501597869115513e-02f,
-         2.99302798792087168533e-02f,
-         3.05145835849139068774e-02f,
-         3.10829970607048658437e-02f,
-         3.16353635869560598226e-02f,
-         3.21715339682534032240e-02f,
-         3.26913665577675052742e-02f,
-         3.31947272783659833029e-02f,
-         3.36814896404726560331e-02f,
-         3.41515347566807569990e-02f,
-         3.46047513531298478462e-02f,
-         3.50410357776568884280e-02f,
-         3.54602920047340924858e-02f,
-         3.58624316372060172875e-02f,
-         3.62473739048404727803e-02f,
-         3.66150456597097023748e-02f,
-         3.69653813684179058385e-02f,
-         3.72983231011940682964e-02f,
-         3.76138205178691634178e-02f,
-         3.79118308507581658340e-02f,
-         3.81923188844700278732e-02f,
-         3.84552569326661666804e-02f,
-         3.87006248117945095277e-02f,
-         3.89284098118221136287e-02f,
-         3.91386066639944005252e-02f,
-         3.93312175056476295842e-02f,
-         3.95062518421033306848e-02f,
-         3.96637265056755394799e-02f,
-         3.98036656118202977761e-02f,
-         3.99261005124597820326e-02f,
-         4.00310697465144360585e-02f,
-         4.01186189876763035778e-02f,
-         4.01888009894591641258e-02f,
-         4.02416755275608953313e-02f,
-         4.02773093395744422041e-02f,
-         4.02957760620868618573e-02f,
-         4.02971561652026855072e-02f,
-         4.02815368845340013304e-02f,
-         4.02490121506946865737e-02f,
-         4.01996825163432602857e-02f,
-         4.01336550808131173329e-02f,
-         4.00510434123766412284e-02f,
-         3.99519674681838021790e-02f,
-         3.98365535119223901361e-02f,
-         3.97049340292425986809e-02f,
-         3.95572476409943238340e-02f,
-         3.93936390143226622396e-02f,
-         3.92142587716682866628e-02f,
-         3.90192633977227906761e-02f,
-         3.88088151443859719070e-02f,
-         3.85830819337740632546e-02f,
-         3.83422372593309676581e-02f,
-         3.80864600850902706997e-02f,
-         3.78159347431409609275e-02f,
-         3.75308508293468318096e-02f,
-         3.72314030973733209318e-02f,
-         3.69177913510723085255e-02f,
-         3.65902203352790472701e-02f,
-         3.62488996250740352911e-02f,
-         3.58940435135636018438e-02f,
-         3.55258708982338911042e-02f,
-         3.51446051659309519066e-02f,
-         3.47504740765239503175e-02f,
-         3.43437096453047957523e-02f,
-         3.39245480241803926136e-02f,
-         3.34932293817127510471e-02f,
-         3.30499977820627663383e-02f,
-         3.25951010628938789293e-02f,
-         3.21287907122915217251e-02f,
-         3.16513217447548164674e-02f,
-         3.11629525763171093267e-02f,
-         3.06639448988514501382e-02f,
-         3.01545635536184866710e-02f,
-         2.96350764041116987446e-02f,
-         2.91057542082603579181e-02f,
-         2.85668704900414009706e-02f,
-         2.80187014105628129368e-02f,
-         2.74615256386703497637e-02f,
-         2.68956242211381771345e-02f,
-         2.63212804524964143205e-02f,
-         2.57387797445546746833e-02f,
-         2.51484094956766456030e-02f,
-         2.45504589598617914414e-02f,
-         2.39452191156906725455e-02f,
-         2.33329825351894608321e-02f,
-         2.27140432526683408443e-02f,
-         2.20886966335908999093e-02f,
-         2.14572392435271874778e-02f,
-         2.08199687172471933905e-02f,
-         2.01771836280079629178e-02f,
-         1.95291833570884962312e-02f,
-         1.88762679636269269101e-02f,
-         1.82187380548123403767e-02f,
-         1.75568946564845403124e-02f,
-         1.68910390841945853846e-02f,
-         1.62214728147774996103e-02f,
-         1.55484973584896369464e-02f,
-         1.48724141317607399387e-02f,
-         1.41935243306124080076e-02f,
-         1.35121288047925294795e-02f,
-         1.28285279326754275003e-02f,
-         1.21430214969758445281e-02f,
-         1.14559085613274869858e-02f,
-         1.07674873477713456404e-02f,
-         1.00780551152029641815e-02f,
-         9.38790803882408146641e-03f,
-         8.69734109064560119429e-03f,
-         8.00664792108640895052e-03f,
-         7.31612074171312902482e-03f,
-         6.62605020916498532735e-03f,
-         5.93672531030635993593e-03f,
-         5.24843324865020312286e-03f,
-         4.56145933209378684481e-03f,
-         3.87608686200798923521e-03f,
-         3.19259702372048361982e-03f,
-         2.51126877843176705626e-03f,
-         1.83237875660391988202e-03f,
-         1.15620115285868549186e-03f,
-         4.83007622422852007059e-04f,
-        -1.86932820843070034112e-04f,
-        -8.53353904797455329115e-04f,
-        -1.51599219771675255281e-03f,
-        -2.17458720530792556924e-03f,
-        -2.82888146600037857989e-03f,
-        -3.47862064448672828401e-03f,
-        -4.12355362347965707925e-03f,
-        -4.76343259365718217635e-03f,
-        -5.39801314176371720144e-03f,
-        -6.02705433684159932323e-03f,
-        -6.65031881456398799024e-03f,
-        -7.26757285964317947813e-03f,
-        -7.87858648628854928153e-03f,
-        -8.48313351669007821576e-03f,
-        -9.08099165750268083608e-03f,
-        -9.67194257431004678072e-03f,
-        -1.02557719640449674509e-02f,
-        -1.08322696253466653482e-02f,
-        -1.14012295268339416271e-02f,
-        -1.19624498732761111452e-02f,
-        -1.25157331696445651287e-02f,
-        -1.30608862830260651078e-02f,
-        -1.35977205023845738180e-02f,
-        -1.41260515961539080687e-02f,
-        -1.46456998676501564532e-02f,
-        -1.51564902082884610246e-02f,
-        -1.56582521485937077588e-02f,
-        -1.61508199069943896020e-02f,
-        -1.66340324363880263936e-02f,
-        -1.71077334684716746149e-02f,
-        -1.75717715558275228149e-02f,
-        -1.80260001117568194329e-02f,
-        -1.84702774478586080609e-02f,
-        -1.89044668093441003975e-02f,
-        -1.93284364080869922042e-02f,
-        -1.97420594534034529732e-02f,
-        -2.01452141805614354242e-02f,
-        -2.05377838770183090977e-02f,
-        -2.09196569063852221004e-02f,
-        -2.12907267301215390176e-02f,
-        -2.16508919269584217127e-02f,
-        -2.20000562100566773860e-02f,
-        -2.23381284419012192399e-02f,
-        -2.26650226469371808558e-02f,
-        -2.29806580219539050014e-02f,
-        -2.32849589442222955349e-02f,
-        -2.35778549773940013234e-02f,
-        -2.38592808751701725145e-02f,
-        -2.41291765827496146324e-02f,
-        -2.43874872360661625048e-02f,
-        -2.46341631588262027774e-02f,
-        -2.48691598573592027865e-02f,
-        -2.50924380132932847709e-02f,
-        -2.53039634740697960691e-02f,
-        -2.55037072413113186098e-02f,
-        -2.56916454570593408291e-02f,
-        -2.58677593878966008423e-02f,
-        -2.60320354069717534162e-02f,
-        -2.61844649739453247395e-02f,
-        -2.63250446128731642459e-02f,
-        -2.64537758880496950975e-02f,
-        -2.65706653778289558776e-02f,
-        -2.66757246464459155111e-02f,
-        -2.67689702138592805492e-02f,
-        -2.68504235236379437679e-02f,
-        -2.69201109089152179621e-02f,
-        -2.69780635564342181898e-02f,
-        -2.70243174687087896191e-02f,
-        -2.70589134243261995871e-02f,
-        -2.70818969364167577707e-02f,
-        -2.70933182093176481986e-02f,
-        -2.70932320934577017257e-02f,
-        -2.70816980384915410862e-02f,
-        -2.70587800447114543156e-02f,
-        -2.70245466127663376554e-02f,
-        -2.69790706917171427270e-02f,
-        -2.69224296254590607369e-02f,
-        -2.68547050975419879237e-02f,
-        -2.67759830744198866481e-02f,
-        -2.66863537471611969587e-02f,
-        -2.65859114716531889921e-02f,
-        -2.64747547073322930800e-02f,
-        -2.63529859544745573285e-02f,
-        -2.62207116900796607939e-02f,
-        -2.60780423023825730366e-02f,
-        -2.59250920240284947471e-02f,
-        -2.57619788639449828760e-02f,
-        -2.55888245379471308827e-02f,
-        -2.54057543981124761556e-02f,
-        -2.52128973609604678519e-02f,
-        -2.50103858344739478359e-02f,
-        -2.47983556439997539222e-02f,
-        -2.45769459570643403201e-02f,
-        -2.43462992071435090080e-02f,
-        -2.41065610164222128564e-02f,
-        -2.38578801175844575078e-02f,
-        -2.36004082746693114037e-02f,
-        -2.33343002030331689300e-02f,
-        -2.30597134884559483436e-02f,
-        -2.27768085054302904524e-02f,
-        -2.24857483346725776918e-02f,
-        -2.21866986798954189675e-02f,
-        -2.18798277838799307138e-02f,
-        -2.15653063438876642366e-02f,
-        -2.12433074264517691987e-02f,
-        -2.09140063815867055519e-02f,
-        -2.05775807564556566243e-02f,
-        -2.02342102085360346642e-02f,
-        -1.98840764183222142025e-02f,
-        -1.95273630016047500257e-02f,
-        -1.91642554213670816832e-02f,
-        -1.87949408993371563925e-02f,
-        -1.84196083272362247374e-02f,
-        -1.80384481777610752862e-02f,
-        -1.76516524153425696797e-02f,
-        -1.72594144067167720724e-02f,
-        -1.68619288313498413845e-02f,
-        -1.64593915917550098760e-02f,
-        -1.60519997237402040069e-02f,
-        -1.56399513066264282679e-02f,
-        -1.52234453734734331148e-02f,
-        -1.48026818213531103502e-02f,
-        -1.43778613217079923037e-02f,
-        -1.39491852308316760523e-02f,
-        -1.35168555005115483686e-02f,
-        -1.30810745888681710658e-02f,
-        -1.26420453714316226301e-02f,
-        -1.21999710524887047813e-02f,
-        -1.17550550767402828961e-02f,
-        -1.13075010413035727252e-02f,
-        -1.08575126080952908542e-02f,
-        -1.04052934166326063736e-02f,
-        -9.95104699728536351566e-03f,
-        -9.49497668501652312967e-03f,
-        -9.03728553364356763933e-03f,
-        -8.57817623065582068875e-03f,
-        -8.11785101262214349449e-03f,
-        -7.65651158122056946231e-03f,
-        -7.19435901992488725798e-03f,
-        -6.73159371137851351291e-03f,
-        -6.26841525548942068990e-03f,
-        -5.80502238827697216589e-03f,
-        -5.34161290150089295564e-03f,
-        -4.87838356310490647849e-03f,
-        -4.41553003850264462471e-03f,
-        -3.95324681273798422126e-03f,
-        -3.49172711354636287548e-03f,
-        -3.03116283534747218975e-03f,
-        -2.57174446419663202748e-03f,
-        -2.11366100372138449731e-03f,
-        -1.65709990207213789248e-03f,
-        -1.20224697991074881177e-03f,
-        -7.49286359465203312402e-04f,
-        -2.98400394673150758020e-04f,
-         1.50230397559290287587e-04f,
-         5.96427404960260163468e-04f,
-         1.04001398633389997676e-03f,
-         1.48081553681653948010e-03f,
-         1.91865955192711671630e-03f,
-         2.35337569038958404136e-03f,
-         2.78479583570576333731e-03f,
-         3.21275415646031688166e-03f,
-         3.63708716533605539573e-03f,
-         4.05763377682291995208e-03f,
-         4.47423536360066955581e-03f,
-         4.88673581157838838457e-03f,
-         5.29498157357465894235e-03f,
-         5.69882172162047926506e-03f,
-         6.09810799787139853900e-03f,
-         6.49269486411187517899e-03f,
-         6.88243954983998491859e-03f,
-         7.26720209891677272618e-03f,
-         7.64684541476874993227e-03f,
-         8.02123530413159993580e-03f,
-         8.39024051932213063565e-03f,
-         8.75373279902990839019e-03f,
-         9.11158690761618844656e-03f,
-         9.46368067291306243327e-03f,
-         9.80989502251233651264e-03f,
-         1.01501140185368699670e-02f,
-         1.04842248908878447194e-02f,
-         1.08121180689596009528e-02f,
-         1.11336872118183785596e-02f,
-         1.14488292368375710328e-02f,
-         1.17574443467867335855e-02f,
-         1.20594360553697797084e-02f,
-         1.23547112112087492664e-02f,
-         1.26431800202723137322e-02f,
-         1.29247560667452802280e-02f,
-         1.31993563323394361153e-02f,
-         1.34669012140451026943e-02f,
-         1.37273145403230718842e-02f,
-         1.39805235857388930609e-02f,
-         1.42264590840399576116e-02f,
-         1.44650552396788801418e-02f,
-         1.46962497377853603536e-02f,
-         1.49199837525900817770e-02f,
-         1.51362019543059365262e-02f,
-         1.53448525144697818512e-02f,
-         1.55458871097522988158e-02f,
-         1.57392609242401407266e-02f,
-         1.59249326501989980909e-02f,
-         1.61028644873237487822e-02f,
-         1.62730221404839558996e-02f,
-         1.64353748159745995105e-02f,
-         1.65898952162792344411e-02f,
-         1.67365595333573702330e-02f,
-         1.68753474404654685292e-02f,
-         1.70062420825228405308e-02f,
-         1.71292300650343690127e-02f,
-         1.72443014415816948948e-02f,
-         1.73514496998961910423e-02f,
-         1.74506717465267233158e-02f,
-         1.75419678901157470585e-02f,
-         1.76253418232991503067e-02f,
-         1.77008006032431768062e-02f,
-         1.77683546308354950449e-02f,
-         1.78280176285450023266e-02f,
-         1.78798066169677284665e-02f,
-         1.79237418900749095885e-02f,
-         1.79598469891815541721e-02f,
-         1.79881486756524357207e-02f,
-         1.80086769023645003329e-02f,
-         1.80214647839439801036e-02f,
-         1.80265485657978320744e-02f,
-         1.80239675919585257136e-02f,
-         1.80137642717629609113e-02f,
-         1.79959840453853894826e-02f,
-         1.79706753482452019632e-02f,
-         1.79378895743111561878e-02f,
-         1.78976810383233188306e-02f,
-         1.78501069369546815080e-02f,
-         1.77952273089348571300e-02f,
-         1.77331049941585293384e-02f,
-         1.76638055918014250101e-02f,
-         1.75873974174670689996e-02f,
-         1.75039514593883366311e-02f,
-         1.74135413337067820883e-02f,
-         1.73162432388551425222e-02f,
-         1.72121359090659648006e-02f,
-         1.71013005670323306462e-02f,
-         1.69838208757447130248e-02f,
-         1.68597828895295613616e-02f,
-         1.67292750043147309125e-02f,
-         1.65923879071472879509e-02f,
-         1.64492145249898746862e-02f,
-         1.62998499728209574056e-02f,
-         1.61443915010654574782e-02f,
-         1.59829384423819872985e-02f,
-         1.58155921578329479449e-02f,
-         1.56424559824643004402e-02f,
-         1.54636351703211580993e-02f,
-         1.52792368389266484952e-02f,
-         1.50893699132506348831e-02f,
-         1.48941450691946284529e-02f,
-         1.46936746766213478105e-02f,
-         1.44880727419542387757e-02f,
-         1.42774548503756936596e-02f,
-         1.40619381076500047506e-02f,
-         1.38416410815988405458e-02f,
-         1.36166837432563775367e-02f,
-         1.33871874077307433104e-02f,
-         1.31532746747999255282e-02f,
-         1.29150693692685249875e-02f,
-         1.26726964811125480254e-02f,
-         1.24262821054400597609e-02f,
-         1.21759533822933443264e-02f,
-         1.19218384363212748234e-02f,
-         1.16640663163469111840e-02f,
-         1.14027669348586990772e-02f,
-         1.11380710074510391738e-02f,
-         1.08701099922405512027e-02f,
-         1.05990160292857588803e-02f,
-         1.03249218800347264402e-02f,
-         1.00479608668283364181e-02f,
-         9.76826681248407595326e-03f,
-         9.48597397998680001707e-03f,
-         9.20121701231205180171e-03f,
-         8.91413087240663405686e-03f,
-         8.62485078335300560382e-03f,
-         8.33351216874106057175e-03f,
-         8.04025059327335284154e-03f,
-         7.74520170362733365033e-03f,
-         7.44850116959968472363e-03f,
-         7.15028462555652392224e-03f,
-         6.85068761221313375642e-03f,
-         6.54984551876693164157e-03f,
-         6.24789352540736173808e-03f,
-         5.94496654622468298501e-03f,
-         5.64119917254172174859e-03f,
-         5.33672561668945780872e-03f,
-         5.03167965625017643561e-03f,
-         4.72619457878821046942e-03f,
-         4.42040312709122713147e-03f,
-         4.11443744494245557813e-03f,
-         3.80842902344421868274e-03f,
-         3.50250864791438413365e-03f,
-         3.19680634537424174582e-03f,
-         2.89145133264915015631e-03f,
-         2.58657196509964968506e-03f,
-         2.28229568600325869593e-03f,
-         1.97874897660506266980e-03f,
-         1.67605730685465247574e-03f,
-         1.37434508684857771554e-03f,
-         1.07373561899400072825e-03f,
-         7.74351050912206037222e-04f,
-         4.76312329096932108620e-04f,
-         1.79739153344913828647e-04f,
-        -1.15250068026150436743e-04f,
-        -4.08538262157430215240e-04f,
-        -7.00009734810518881830e-04f,
-        -9.89550212697529359140e-04f,
-        -1.27704688496522110984e-03f,
-        -1.56238844381914230262e-03f,
-        -1.84546512427596291067e-03f,
-        -2.12616874302977649017e-03f,
-        -2.40439273642179809562e-03f,
-        -2.68003219750039467159e-03f,
-        -2.95298391216083011210e-03f,
-        -3.22314639435426720723e-03f,
-        -3.49041992035452591087e-03f,
-        -3.75470656207426648626e-03f,
-        -4.01591021941965966441e-03f,
-        -4.27393665167596914500e-03f,
-        -4.52869350791463860101e-03f,
-        -4.78009035641408387002e-03f,
-        -5.02803871308742881402e-03f,
-        -5.27245206890878791856e-03f,
-        -5.51324591633307794364e-03f,
-        -5.75033777470175880286e-03f,
-        -5.98364721463032038506e-03f,
-        -6.21309588137129026331e-03f,
-        -6.43860751714846711591e-03f,
-        -6.66010798245885143193e-03f,
-        -6.87752527633716734257e-03f,
-        -7.09078955558135361203e-03f,
-        -7.29983315293484570641e-03f,
-        -7.50459059422442856246e-03f,
-        -7.70499861445137022159e-03f,
-        -7.90099617283428028169e-03f,
-        -8.09252446680348673513e-03f,
-        -8.27952694494581836748e-03f,
-        -8.46194931890021165288e-03f,
-        -8.63973957420479179992e-03f,
-        -8.81284798009584514900e-03f,
-        -8.98122709826090423468e-03f,
-        -9.14483179054685624276e-03f,
-        -9.30361922562642808254e-03f,
-        -9.45754888462495800494e-03f,
-        -9.60658256571109842037e-03f,
-        -9.75068438765514661215e-03f,
-        -9.88982079235872779677e-03f,
-        -1.00239605463608785763e-02f,
-        -1.01530747413246837108e-02f,
-        -1.02771367935108499936e-02f,
-        -1.03961224422430293518e-02f,
-        -1.05100097473716045521e-02f,
-        -1.06187790857425311958e-02f,
-        -1.07224131466778661165e-02f,
-        -1.08208969264758890494e-02f,
-        -1.09142177219381259629e-02f,
-        -1.10023651229317290939e-02f,
-        -1.10853310039956218930e-02f,
-        -1.11631095149994884197e-02f,
-        -1.12356970708646971419e-02f,
-        -1.13030923403568215463e-02f,
-        -1.13652962339602110059e-02f,
-        -1.14223118908440956359e-02f,
-        -1.14741446649318026840e-02f,
-        -1.15208021100836454503e-02f,
-        -1.15622939644049946284e-02f,
-        -1.15986321336910645080e-02f,
-        -1.16298306740207010868e-02f,
-        -1.16559057735113307669e-02f,
-        -1.16768757332475214827e-02f,
-        -1.16927609473963332182e-02f,
-        -1.17035838825226608945e-02f,
-        -1.17093690561177760784e-02f,
-        -1.17101430143551586693e-02f,
-        -1.17059343090872795129e-02f,
-        -1.16967734740980097013e-02f,
-        -1.16826930006248379257e-02f,
-        -1.16637273121658596037e-02f,
-        -1.16399127385864407935e-02f,
-        -1.16112874895409699111e-02f,
-        -1.15778916272246922003e-02f,
-        -1.15397670384720374415e-02f,
-        -1.14969574062164479888e-02f,
-        -1.14495081803284975280e-02f,
-        -1.13974665478479546959e-02f,
-        -1.13408814026266253211e-02f,
-        -1.12798033143984600957e-02f,
-        -1.12142844972935168402e-02f,
-        -1.11443787778127377519e-02f,
-        -1.10701415622809114236e-02f,
-        -1.09916298037944538957e-02f,
-        -1.09089019686816925125e-02f,
-        -1.08220180024931385970e-02f,
-        -1.07310392955389764802e-02f,
-        -1.06360286479915983754e-02f,
-        -1.05370502345710423397e-02f,
-        -1.04341695688310136247e-02f,
-        -1.03274534670632443106e-02f,
-        -1.02169700118386209270e-02f,
-        -1.01027885152025192345e-02f,
-        -9.98497948154308812008e-03f,
-        -9.86361457015006402871e-03f,
-        -9.73876655748246930488e-03f,
-        -9.61050929916365190286e-03f,
-        -9.47891769172138146105e-03f,
-        -9.34406763409175583623e-03f,
-        -9.20603598890469380922e-03f,
-        -9.06490054356958417647e-03f,
-        -8.92073997117914622990e-03f,
-        -8.77363379124968326139e-03f,
-        -8.62366233031589164704e-03f,
-        -8.47090668239862398803e-03f,
-        -8.31544866936306283078e-03f,
-        -8.15737080118616487978e-03f,
-        -7.99675623615058242533e-03f,
-        -7.83368874098351944402e-03f,
-        -7.66825265095798756787e-03f,
-        -7.50053282997436773782e-03f,
-        -7.33061463064018075525e-03f,
-        -7.15858385436481461928e-03f,
-        -6.98452671148786126409e-03f,
-        -6.80852978145714965441e-03f,
-        -6.63067997307481386826e-03f,
-        -6.45106448482760802543e-03f,
-        -6.26977076531890029770e-03f,
-        -6.08688647381931853542e-03f,
-        -5.90249944095203298716e-03f,
-        -5.71669762953000513278e-03f,
-        -5.52956909556100162373e-03f,
-        -5.34120194943696596085e-03f,
-        -5.15168431732329797079e-03f,
-        -4.96110430276443595266e-03f,
-        -4.76954994852103134756e-03f,
-        -4.57710919865432410564e-03f,
-        -4.38386986087277181340e-03f,
-        -4.18991956915663876782e-03f,
-        -3.99534574667439676410e-03f,
-        -3.80023556900675307108e-03f,
-        -3.60467592769156538676e-03f,
-        -3.40875339410503987864e-03f,
-        -3.21255418369197943973e-03f,
-        -3.01616412055992575564e-03f,
-        -2.81966860245005685598e-03f,
-        -2.62315256609809257030e-03f,
-        -2.42670045299875130826e-03f,
-        -2.23039617558575898118e-03f,
-        -2.03432308384080993632e-03f,
-        -1.83856393234277533909e-03f,
-        -1.64320084776991355742e-03f,
-        -1.44831529686655904529e-03f,
-        -1.25398805488530435195e-03f,
-        -1.06029917451672204415e-03f,
-        -8.67327955316482155854e-04f,
-        -6.75152913641518712638e-04f,
-        -4.83851753104545291573e-04f,
-        -2.93501335557769932588e-04f,
-        -1.04177652615230481180e-04f,
-         8.40442022771478958144e-05f,
-         2.71090061213828637746e-04f,
-         4.56886708636217294885e-04f,
-         6.41361907564611910364e-04f,
-         8.24444425246958221068e-04f,
-         1.00606405821750295726e-03f,
-         1.18615165675600578790e-03f,
-         1.36463914874257485378e-03f,
-         1.54145956289825905236e-03f,
-         1.71654705140769636706e-03f,
-         1.88983691191461173828e-03f,
-         2.06126560888645086675e-03f,
-         2.23077079434063144103e-03f,
-         2.39829132792830895110e-03f,
-         2.56376729636941056573e-03f,
-         2.72714003223500402184e-03f,
-         2.88835213207216685155e-03f,
-         3.04734747386685260462e-03f,
-         3.20407123384176817371e-03f,
-         3.35846990258462183704e-03f,
-         3.51049130050470068257e-03f,
-         3.66008459261367522647e-03f,
-         3.80720030262936314294e-03f,
-         3.95179032639856198800e-03f,
-         4.09380794463911311387e-03f,
-         4.23320783499702736619e-03f,
-         4.36994608342004212803e-03f,
-         4.50398019484403704799e-03f,
-         4.63526910319382156461e-03f,
-         4.76377318069614620610e-03f,
-         4.88945424650618146178e-03f,
-         5.01227557464674778470e-03f,
-         5.13220190126144337750e-03f,
-         5.24919943118207308480e-03f,
-         5.36323584381190321402e-03f,
-         5.47428029832571112767e-03f,
-         5.58230343818897148389e-03f,
-         5.68727739499729628703e-03f,
-         5.78917579163970574818e-03f,
-         5.88797374478673089110e-03f,
-         5.98364786670789981782e-03f,
-         6.07617626642060343345e-03f,
-         6.16553855017385084303e-03f,
-         6.25171582127166582804e-03f,
-         6.33469067923863194541e-03f,
-         6.41444721833308011821e-03f,
-         6.49097102541174898749e-03f,
-         6.56424917715103632687e-03f,
-         6.63427023662958338657e-03f,
-         6.70102424927795491810e-03f,
-         6.76450273820044644529e-03f,
-         6.82469869887525251023e-03f,
-         6.88160659323871527759e-03f,
-         6.93522234316026366108e-03f,
-         6.98554332331408935064e-03f,
-         7.03256835345506155222e-03f,
-         7.07629769010476809138e-03f,
-         7.11673301765615093362e-03f,
-         7.15387743890304877992e-03f,
-         7.18773546500291789924e-03f,
-         7.21831300488032408247e-03f,
-         7.24561735407938580650e-03f,
-         7.26965718307318129604e-03f,
-         7.29044252503875406940e-03f,
-         7.30798476310635155423e-03f,
-         7.32229661709144288850e-03f,
-         7.33339212971884264747e-03f,
-         7.34128665234775375920e-03f,
-         7.34599683020745793799e-03f,
-         7.34754058715258225737e-03f,
-         7.34593710994830336597e-03f,
-         7.34120683209452638829e-03f,
-         7.33337141719967496728e-03f,
-         7.32245374191355016119e-03f,
-         7.30847787843014878861e-03f,
-         7.29146907657012011139e-03f,
-         7.27145374545387114529e-03f,
-         7.24845943477565521351e-03f,
-         7.22251481568945107037e-03f,
-         7.19364966131744686118e-03f,
-         7.16189482689201083881e-03f,
-         7.12728222954231872138e-03f,
-         7.08984482773655864257e-03f,
-         7.04961660039112210374e-03f,
-         7.00663252565801673161e-03f,
-         6.96092855940177307472e-03f,
-         6.91254161337735619636e-03f,
-         6.86150953312070904788e-03f,
-         6.80787107556324582597e-03f,
-         6.75166588638215301593e-03f,
-         6.69293447709806265528e-03f,
-         6.63171820193170571955e-03f,
-         6.56805923443159328512e-03f,
-         6.50200054388410785683e-03f,
-         6.43358587151825807998e-03f,
-         6.36285970651646794888e-03f,
-         6.28986726184373092646e-03f,
-         6.21465444990643503531e-03f,
-         6.13726785805332464285e-03f,
-         6.05775472392990760317e-03f,
-         5.97616291069856791357e-03f,
-         5.89254088213594148099e-03f,
-         5.80693767761965816410e-03f,
-         5.71940288701587758180e-03f,
-         5.62998662548002196115e-03f,
-         5.53873950818146131014e-03f,
-         5.44571262496510149348e-03f,
-         5.35095751496040238082e-03f,
-         5.25452614115022934027e-03f,
-         5.15647086491062122543e-03f,
-         5.05684442053339500839e-03f,
-         4.95569988974256699088e-03f,
-         4.85309067621648645985e-03f,
-         4.74907048012647350216e-03f,
-         4.64369327270371719946e-03f,
-         4.53701327084515566163e-03f,
-         4.42908491176951992635e-03f,
-         4.31996282773485212186e-03f,
-         4.20970182082771107734e-03f,
-         4.09835683783572966160e-03f,
-         3.98598294521311340144e-03f,
-         3.87263530415101094040e-03f,
-         3.75836914576165720403e-03f,
-         3.64323974638825019007e-03f,
-         3.52730240304928790995e-03f,
-         3.41061240902878646739e-03f,
-         3.29322502962129748730e-03f,
-         3.17519547804233142826e-03f,
-         3.05657889151338601694e-03f,
-         2.93743030753160130203e-03f,
-         2.81780464033296821486e-03f,
-         2.69775665755896121301e-03f,
-         2.57734095713514719389e-03f,
-         2.45661194437134461702e-03f,
-         2.33562380929147129019e-03f,
-         2.21443050420279223534e-03f,
-         2.09308572151161147862e-03f,
-         1.97164287179554201940e-03f,
-         1.85015506213867531038e-03f,
-         1.72867507473943343883e-03f,
-         1.60725534579748128607e-03f,
-         1.48594794468843234732e-03f,
-         1.36480455343317803527e-03f,
-         1.24387644646943291808e-03f,
-         1.12321447073277739387e-03f,
-         1.00286902605367005473e-03f,
-         8.82890045877847201225e-04f,
-         7.63326978315998568199e-04f,
-         6.44228767529792380013e-04f,
-         5.25643835459782418976e-04f,
-         4.07620063901896608968e-04f,
-         2.90204776937506045247e-04f,
-         1.73444723723805766706e-04f,
-         5.73860616484244659592e-05f,
-        -5.79256601447129809831e-05f,
-        -1.72445516855139978872e-04f,
-        -2.86129223744603178401e-04f,
-        -3.98933151471683798521e-04f,
-        -5.10814341036775051638e-04f,
-        -6.21730518333987194034e-04f,
-        -7.31640108305292775383e-04f,
-        -8.40502248693749103720e-04f,
-        -9.48276803391555388537e-04f,
-        -1.05492437538016840815e-03f,
-        -1.16040631925863960139e-03f,
-        -1.26468475335793167046e-03f,
-        -1.36772257143744795961e-03f,
-        -1.46948345396231690001e-03f,
-        -1.56993187895820992227e-03f,
-        -1.66903313244173671925e-03f,
-        -1.76675331842487395514e-03f,
-        -1.86305936849075486246e-03f,
-        -1.95791905094055886799e-03f,
-        -2.05130097950870097026e-03f,
-        -2.14317462164644121497e-03f,
-        -2.23351030637205421117e-03f,
-        -2.32227923168745655630e-03f,
-        -2.40945347156019864382e-03f,
-        -2.49500598247101752769e-03f,
-        -2.57891060952624437755e-03f,
-        -2.66114209213571661222e-03f,
-        -2.74167606925580006200e-03f,
-        -2.82048908419860059130e-03f,
-        -2.89755858900738426376e-03f,
-        -2.97286294839969704451e-03f,
-        -3.04638144327833843006e-03f,
-        -3.11809427381250833106e-03f,
-        -3.18798256208930414976e-03f,
-        -3.25602835433819615824e-03f,
-        -3.32221462272949338845e-03f,
-        -3.38652526674922864716e-03f,
-        -3.44894511415224942069e-03f,
-        -3.50945992149601917673e-03f,
-        -3.56805637425754813494e-03f,
-        -3.62472208653601482564e-03f,
-        -3.67944560034401835918e-03f,
-        -3.73221638449032109761e-03f,
-        -3.78302483305743104600e-03f,
-        -3.83186226347697993233e-03f,
-        -3.87872091420681094562e-03f,
-        -3.92359394201303914723e-03f,
-        -3.96647541886111301701e-03f,
-        -4.00736032841956212047e-03f,
-        -4.04624456218095809173e-03f,
-        -4.08312491520368761599e-03f,
-        -4.11799908147960237043e-03f,
-        -4.15086564893147550587e-03f,
-        -4.18172409404541419592e-03f,
-        -4.21057477614258761356e-03f,
-        -4.23741893129556731340e-03f,
-        -4.26225866589410255086e-03f,
-        -4.28509694986558761776e-03f,
-        -4.30593760955555893838e-03f,
-        -4.32478532027361865092e-03f,
-        -4.34164559851025946141e-03f,
-        -4.35652479383043678834e-03f,
-        -4.36943008044940375129e-03f,
-        -4.38036944849687272935e-03f,
-        -4.38935169497548655082e-03f,
-        -4.39638641441941844384e-03f,
-        -4.40148398925969356471e-03f,
-        -4.40465557990201740657e-03f,
-        -4.40591311452397972614e-03f,
-        -4.40526927859759102890e-03f,
-        -4.40273750414399336200e-03f,
-        -4.39833195872687317957e-03f,
-        -4.39206753419116562726e-03f,
-        -4.38395983515392842489e-03f,
-        -4.37402516725410826781e-03f,
-        -4.36228052516814471251e-03f,
-        -4.34874358039834783829e-03f,
-        -4.33343266884099378305e-03f,
-        -4.31636677814128347924e-03f,
-        -4.29756553484226828249e-03f,
-        -4.27704919133478460302e-03f,
-        -4.25483861261575103258e-03f,
-        -4.23095526286197242544e-03f,
-        -4.20542119182673330285e-03f,
-        -4.17825902106652539991e-03f,
-        -4.14949193000528453179e-03f,
-        -4.11914364184333848390e-03f,
-        -4.08723840931864319803e-03f,
-        -4.05380100032764340012e-03f,
-        -4.01885668341308427420e-03f,
-        -3.98243121312639048598e-03f,
-        -3.94455081527187324114e-03f,
-        -3.90524217204034265055e-03f,
-        -3.86453240703949710971e-03f,
-        -3.82244907022857112119e-03f,
-        -3.77902012276458334344e-03f,
-        -3.73427392176791782957e-03f,
-        -3.68823920501411533363e-03f,
-        -3.64094507555994461798e-03f,
-        -3.59242098631046497328e-03f,
-        -3.54269672453505143905e-03f,
-        -3.49180239633924225512e-03f,
-        -3.43976841109999795926e-03f,
-        -3.38662546587152699790e-03f,
-        -3.33240452976901182711e-03f,
-        -3.27713682833726460339e-03f,
-        -3.22085382791172753977e-03f,
-        -3.16358721997866921757e-03f,
-        -3.10536890554190866259e-03f,
-        -3.04623097950279270868e-03f,
-        -2.98620571506079835605e-03f,
-        -2.92532554814109750294e-03f,
-        -2.86362306185669341502e-03f,
-        -2.80113097101106212072e-03f,
-        -2.73788210664884781517e-03f,
-        -2.67390940066071719841e-03f,
-        -2.60924587044905360173e-03f,
-        -2.54392460366138209102e-03f,
-        -2.47797874299740972931e-03f,
-        -2.41144147109654920225e-03f,
-        -2.34434599551184728525e-03f,
-        -2.27672553377682423265e-03f,
-        -2.20861329857108918892e-03f,
-        -2.14004248299099744321e-03f,
-        -2.07104624593109319652e-03f,
-        -2.00165769758243626206e-03f,
-        -1.93190988505322330110e-03f,
-        -1.86183577811795423693e-03f,
-        -1.79146825509988766485e-03f,
-        -1.72084008889326943795e-03f,
-        -1.64998393312966343087e-03f,
-        -1.57893230849462818527e-03f,
-        -1.50771758919912264932e-03f,
-        -1.43637198961127387532e-03f,
-        -1.36492755105304883201e-03f,
-        -1.29341612876705033125e-03f,
-        -1.22186937905778840625e-03f,
-        -1.15031874661246304344e-03f,
-        -1.07879545200534983015e-03f,
-        -1.00733047939059738862e-03f,
-        -9.35954564387392199190e-04f,
-        -8.64698182161781326270e-04f,
-        -7.93591535709335898878e-04f,
-        -7.22664544342259342231e-04f,
-        -6.51946832385152269008e-04f,
-        -5.81467718082645003419e-04f,
-        -5.11256202723101406751e-04f,
-        -4.41340959980976682391e-04f,
-        -3.71750325482115011495e-04f,
-        -3.02512286594312090893e-04f,
-        -2.33654472446860898751e-04f,
-        -1.65204144181543805632e-04f,
-        -9.71881854382950145007e-05f,
-        -2.96330930778333087529e-05f,
-         3.74350318557888840534e-05f,
-         1.03990492930665522531e-04f,
-         1.70008006877860913661e-04f,
-         2.35462711895771908792e-04f,
-         3.00330175705594570618e-04f,
-         3.64586403356421419591e-04f,
-         4.28207844777551787079e-04f,
-         4.91171402077186748311e-04f,
-         5.53454436585029511952e-04f,
-         6.15034775638214118408e-04f,
-         6.75890719108685204992e-04f,
-         7.36001045671158494674e-04f,
-         7.95345018810736208159e-04f,
-         8.53902392568785988461e-04f,
-         9.11653417026953884206e-04f,
-         9.68578843528107927274e-04f,
-         1.02465992963409239201e-03f,
-         1.07987844381954517861e-03f,
-         1.13421666990184857697e-03f,
-         1.18765741120669863183e-03f,
-         1.24018399446962118877e-03f,
-         1.29178027347317181048e-03f,
-         1.34243063242041153760e-03f,
-         1.39211998904448393775e-03f,
-         1.44083379745542361494e-03f,
-         1.48855805072399061464e-03f,
-         1.53527928320389963832e-03f,
-         1.58098457259274222282e-03f,
-         1.62566154173287799080e-03f,
-         1.66929836015300469068e-03f,
-         1.71188374535185877309e-03f,
-         1.75340696382495094506e-03f,
-         1.79385783183615881223e-03f,
-         1.83322671593499951850e-03f,
-         1.87150453322187351919e-03f,
-         1.90868275136241117781e-03f,
-         1.94475338835288632730e-03f,
-         1.97970901203875114180e-03f,
-         2.01354273938795765367e-03f,
-         2.04624823552140497340e-03f,
-         2.07781971250251560127e-03f,
-         2.10825192788842950831e-03f,
-         2.13754018304492627786e-03f,
-         2.16568032122775241954e-03f,
-         2.19266872543273649843e-03f,
-         2.21850231601753312277e-03f,
-         2.24317854809751244041e-03f,
-         2.26669540871874157159e-03f,
-         2.28905141381085521987e-03f,
-         2.31024560492300908704e-03f,
-         2.33027754574556848419e-03f,
-         2.34914731842113299123e-03f,
-         2.36685551964774167771e-03f,
-         2.38340325657774047483e-03f,
-         2.39879214251553785076e-03f,
-         2.41302429241780800814e-03f,
-         2.42610231819949092105e-03f,
-         2.43802932384921434983e-03f,
-         2.44880890035772524199e-03f,
-         2.45844512046309356806e-03f,
-         2.46694253321619750424e-03f,
-         2.47430615837057783779e-03f,
-         2.48054148060029584083e-03f,
-         2.48565444354972896537e-03f,
-         2.48965144371932805070e-03f,
-         2.49253932419119233338e-03f,
-         2.49432536819870756192e-03f,
-         2.49501729254406187306e-03f,
-         2.49462324086802481049e-03f,
-         2.49315177677595679884e-03f,
-         2.49061187682437026880e-03f,
-         2.48701292337218105022e-03f,
-         2.48236469730101589823e-03f,
-         2.47667737060877201499e-03f,
-         2.46996149888082565729e-03f,
-         2.46222801364318543901e-03f,
-         2.45348821460201170497e-03f,
-         2.44375376177385136151e-03f,
-         2.43303666751100867299e-03f,
-         2.42134928842652587602e-03f,
-         2.40870431722312039469e-03f,
-         2.39511477443066006163e-03f,
-         2.38059400005651662299e-03f,
-         2.36515564515335941637e-03f,
-         2.34881366330883401689e-03f,
-         2.33158230206161314751e-03f,
-         2.31347609424828503169e-03f,
-         2.29450984928561332182e-03f,
-         2.27469864439260342423e-03f,
-         2.25405781575686164908e-03f,
-         2.23260294964972971082e-03f,
-         2.21034987349466626252e-03f,
-         2.18731464689328946802e-03f,
-         2.16351355261355186160e-03f,
-         2.13896308754443764677e-03f,
-         2.11367995362164717843e-03f,
-         2.08768104872860673846e-03f,
-         2.06098345757712827012e-03f,
-         2.03360444257223585765e-03f,
-         2.00556143466523338278e-03f,
-         1.97687202419953838434e-03f,
-         1.94755395175337346625e-03f,
-         1.91762509898370150235e-03f,
-         1.88710347947544372464e-03f,
-         1.85600722960030926380e-03f,
-         1.82435459938927956557e-03f,
-         1.79216394342290039413e-03f,
-         1.75945371174334418141e-03f,
-         1.72624244079242210488e-03f,
-         1.69254874437936271916e-03f,
-         1.65839130468247841071e-03f,
-         1.62378886328829906069e-03f,
-         1.58876021227249563002e-03f,
-         1.55332418532590395277e-03f,
-         1.51749964892962602506e-03f,
-         1.48130549358308134279e-03f,
-         1.44476062508820820261e-03f,
-         1.40788395589385340219e-03f,
-         1.37069439650360901800e-03f,
-         1.33321084695073701146e-03f,
-         1.29545218834344489506e-03f,
-         1.25743727448406820806e-03f,
-         1.21918492356532437090e-03f,
-         1.18071390994699786103e-03f,
-         1.14204295601606406994e-03f,
-         1.10319072413361980722e-03f,
-         1.06417580867146756643e-03f,
-         1.02501672814153568618e-03f,
-         9.85731917420752321024e-04f,
-         9.46339720074761028661e-04f,
-         9.06858380782653099826e-04f,
-         8.67306037865940180828e-04f,
-         8.27700715924154601863e-04f,
-         7.88060318579825755218e-04f,
-         7.48402621335140681366e-04f,
-         7.08745264542995573667e-04f,
-         6.69105746494616255432e-04f,
-         6.29501416626196083105e-04f,
-         5.89949468846577432593e-04f,
-         5.50466934988384673337e-04f,
-         5.11070678384569518186e-04f,
-         4.71777387572266644969e-04f,
-         4.32603570126133903009e-04f,
-         3.93565546622840108093e-04f,
-         3.54679444738640930936e-04f,
-         3.15961193481461178213e-04f,
-         2.77426517559644606348e-04f,
-         2.39090931888283949464e-04f,
-         2.00969736235134577339e-04f,
-         1.63078010007227617185e-04f,
-         1.25430607179671989044e-04f,
-         8.80421513676910678318e-05f,
-         5.09270310433270975443e-05f,
-         1.40993948977051206995e-05f,
-        -2.24268526499689963992e-05f,
-        -5.86380557959355767418e-05f,
-        -9.45208115468090933828e-05f,
-        -1.30061973765318488264e-04f,
-        -1.65248657065980185041e-04f,
-        -2.00068240560348736649e-04f,
-        -2.34508371450769772170e-04f,
-        -2.68556968472767403858e-04f,
-        -3.02202225185153135114e-04f,
-        -3.35432613107714699702e-04f,
-        -3.68236884706315019053e-04f,
-        -4.00604076224976460123e-04f,
-        -4.32523510365022737217e-04f,
-        -4.63984798811095579957e-04f,
-        -4.94977844604242624843e-04f,
-        -5.25492844361963827582e-04f,
-        -5.55520290345540247376e-04f,
-        -5.85050972374773735341e-04f,
-        -6.14075979590610184985e-04f,
-        -6.42586702065795259929e-04f,
-        -6.70574832264203037069e-04f,
-        -6.98032366349193725621e-04f,
-        -7.24951605341828033552e-04f,
-        -7.51325156129156322866e-04f,
-        -7.77145932323820387393e-04f,
-        -8.02407154975299293648e-04f,
-        -8.27102353133903219450e-04f,
-        -8.51225364268258727699e-04f,
-        -8.74770334537431802288e-04f,
-        -8.97731718918501797773e-04f,
-        -9.20104281190827605862e-04f,
-        -9.41883093778050233848e-04f,
-        -9.63063537449165905750e-04f,
-        -9.83641300879760935652e-04f,
-        -1.00361238007481306557e-03f,
-        -1.02297307765449128208e-03f,
-        -1.04172000200423238610e-03f,
-        -1.05985006629069969386e-03f,
-        -1.07736048734502422482e-03f,
-        -1.09424878441514257174e-03f,
-        -1.11051277778848088776e-03f,
-        -1.12615058728708443934e-03f,
-        -1.14116063063659394818e-03f,
-        -1.15554162171100749217e-03f,
-        -1.16929256865495575027e-03f,
-        -1.18241277188544584124e-03f,
-        -1.19490182197486941203e-03f,
-        -1.20675959741726535404e-03f,
-        -1.21798626227982297217e-03f,
-        -1.22858226374166065384e-03f,
-        -1.23854832952187280184e-03f,
-        -1.24788546519901061629e-03f,
-        -1.25659495142406364872e-03f,
-        -1.26467834102919943727e-03f,
-        -1.27213745603428412742e-03f,
-        -1.27897438455362244883e-03f,
-        -1.28519147760499177768e-03f,
-        -1.29079134582336268501e-03f,
-        -1.29577685608154116216e-03f,
-        -1.30015112802015094483e-03f,
-        -1.30391753048923449490e-03f,
-        -1.30707967790388737521e-03f,
-        -1.30964142651636395419e-03f,
-        -1.31160687060702277167e-03f,
-        -1.31298033859659005196e-03f,
-        -1.31376638908218385492e-03f,
-        -1.31396980679961724973e-03f,
-        -1.31359559851441281067e-03f,
-        -1.31264898884408520024e-03f,
-        -1.31113541601419526274e-03f,
-        -1.30906052755070225271e-03f,
-        -1.30643017591116055581e-03f,
-        -1.30325041405731484843e-03f,
-        -1.29952749097163636725e-03f,
-        -1.29526784712039586857e-03f,
-        -1.29047810986578645812e-03f,
-        -1.28516508882973415524e-03f,
-        -1.27933577121191956356e-03f,
-        -1.27299731706460124078e-03f,
-        -1.26615705452684046764e-03f,
-        -1.25882247502064623448e-03f,
-        -1.25100122841167137044e-03f,
-        -1.24270111813698665680e-03f,
-        -1.23393009630251375940e-03f,
-        -1.22469625875265661526e-03f,
-        -1.21500784011470538623e-03f,
-        -1.20487320882053006339e-03f,
-        -1.19430086210808427544e-03f,
-        -1.18329942100529298017e-03f,
-        -1.17187762529875026674e-03f,
-        -1.16004432848981092231e-03f,
-        -1.14780849274044756403e-03f,
-        -1.13517918381147498753e-03f,
-        -1.12216556599544479457e-03f,
-        -1.10877689704675665670e-03f,
-        -1.09502252311132830878e-03f,
-        -1.08091187365826806380e-03f,
-        -1.06645445641585442931e-03f,
-        -1.05165985231426076241e-03f,
-        -1.03653771043727446592e-03f,
-        -1.02109774298538512859e-03f,
-        -1.00534972025243104707e-03f,
-        -9.89303465618205854493e-04f,
-        -9.72968850559070386023e-04f,
-        -9.56355789678956110487e-04f,
-        -9.39474235762757228438e-04f,
-        -9.22334174854466432199e-04f,
-        -9.04945621361946477522e-04f,
-        -8.87318613190598128385e-04f,
-        -8.69463206907894578697e-04f,
-        -8.51389472940857513876e-04f,
-        -8.33107490808391681729e-04f,
-        -8.14627344390523211622e-04f,
-        -7.95959117236444131487e-04f,
-        -7.77112887913182157074e-04f,
-        -7.58098725396869001399e-04f,
-        -7.38926684508335205812e-04f,
-        -7.19606801394884719458e-04f,
-        -7.00149089059903611230e-04f,
-        -6.80563532942129469604e-04f,
-        -6.60860086546161931871e-04f,
-        -6.41048667125920334890e-04f,
-        -6.21139151422514545521e-04f,
-        -6.01141371458319205383e-04f,
-        -5.81065110388481308873e-04f,
-        -5.60920098411564179222e-04f,
-        -5.40716008740645473485e-04f,
-        -5.20462453636329636791e-04f,
-        -5.00168980502928035153e-04f,
-        -4.79845068049252442000e-04f,
-        -4.59500122515179752151e-04f,
-        -4.39143473965308969373e-04f,
-        -4.18784372650737749064e-04f,
-        -3.98431985440370181519e-04f,
-        -3.78095392322528038760e-04f,
-        -3.57783582978218623466e-04f,
-        -3.37505453426840712917e-04f,
-        -3.17269802745462131330e-04f,
-        -2.97085329862539673351e-04f,
-        -2.76960630426857884294e-04f,
-        -2.56904193752789059696e-04f,
-        -2.36924399842341755311e-04f,
-        -2.17029516485020210204e-04f,
-        -1.97227696436049984184e-04f,
-        -1.77526974673721080374e-04f,
-        -1.57935265736364822877e-04f,
-        -1.38460361139671443579e-04f,
-        -1.19109926874780676581e-04f,
-        -9.98915009877096604120e-05f,
-        -8.08124912404658787314e-05f,
-        -6.18801728543761411219e-05f,
-        -4.31016863358901726119e-05f,
-        -2.44840353852607290751e-05f,
-        -6.03408488822807525549e-06f,
-         1.22414410087942923482e-05f,
-         3.03359607401630166279e-05f,
-         4.82430370786643698930e-05f,
-         6.59563788094303331657e-05f,
-         8.34698423199615796228e-05f,
-         1.00777433106333784039e-04f,
-         1.17873307195481496850e-04f,
-         1.34751772483674884346e-04f,
-         1.51407289991337552218e-04f,
-         1.67834475034225882872e-04f,
-         1.84028098311239825778e-04f,
-         1.99983086909011169297e-04f,
-         2.15694525223608961004e-04f,
-         2.31157655799539194473e-04f,
-         2.46367880086458945071e-04f,
-         2.61320759113890506518e-04f,
-         2.76012014084471178285e-04f,
-         2.90437526885940853344e-04f,
-         3.04593340522622661477e-04f,
-         3.18475659466672001308e-04f,
-         3.32080849929764377465e-04f,
-         3.45405440055728798956e-04f,
-         3.58446120034815369788e-04f,
-         3.71199742140139986053e-04f,
-         3.83663320687053425832e-04f,
-         3.95834031916090828447e-04f,
-         4.07709213800306149479e-04f,
-         4.19286365777668133727e-04f,
-         4.30563148409382728376e-04f,
-         4.41537382964913725693e-04f,
-         4.52207050934656925797e-04f,
-         4.62570293470961546242e-04f,
-         4.72625410758635230730e-04f,
-         4.82370861315684551149e-04f,
-         4.91805261225328150740e-04f,
-         5.00927383300294468485e-04f,
-         5.09736156180340470138e-04f,
-         5.18230663364083014855e-04f,
-         5.26410142176160977465e-04f,
-         5.34273982670858136115e-04f,
-         5.41821726473215733132e-04f,
-         5.49053065558819199977e-04f,
-         5.55967840973343140065e-04f,
-         5.62566041493084596781e-04f,
-         5.68847802227587348751e-04f,
-         5.74813403165606124842e-04f,
-         5.80463267665585255090e-04f,
-         5.85797960891953992807e-04f,
-         5.90818188198352634011e-04f,
-         5.95524793459205619046e-04f,
-         5.99918757350793364382e-04f,
-         6.04001195583171897330e-04f,
-         6.07773357084216074402e-04f,
-         6.11236622137123529822e-04f,
-         6.14392500472671181100e-04f,
-         6.17242629317575641247e-04f,
-         6.19788771400296852575e-04f,
-         6.22032812915646266330e-04f,
-         6.23976761449542352556e-04f,
-         6.25622743865282679096e-04f,
-         6.26973004152734866845e-04f,
-         6.28029901241785953013e-04f,
-         6.28795906781460817864e-04f,
-         6.29273602886090081127e-04f,
-         6.29465679849935955126e-04f,
-         6.29374933831637162034e-04f,
-         6.29004264509917614644e-04f,
-         6.28356672711923979618e-04f,
-         6.27435258015602670238e-04f,
-         6.26243216327530610385e-04f,
-         6.24783837437580067548e-04f,
-         6.23060502551831571320e-04f,
-         6.21076681805128117189e-04f,
-         6.18835931754663313292e-04f,
-         6.16341892855999597296e-04f,
-         6.13598286922899423257e-04f,
-         6.10608914572360016171e-04f,
-         6.07377652656219848941e-04f,
-         6.03908451680720608987e-04f,
-         6.00205333215381750360e-04f,
-         5.96272387292547546150e-04f,
-         5.92113769798962869678e-04f,
-         5.87733699860716260477e-04f,
-         5.83136457222883410056e-04f,
-         5.78326379625196070923e-04f,
-         5.73307860175058681823e-04f,
-         5.68085344719199331932e-04f,
-         5.62663329215264671791e-04f,
-         5.57046357104629347515e-04f,
-         5.51239016687691835844e-04f,
-         5.45245938502918582949e-04f,
-         5.39071792710859535452e-04f,
-         5.32721286484389919269e-04f,
-         5.26199161406370888652e-04f,
-         5.19510190875949965511e-04f,
-         5.12659177524647379116e-04f,
-         5.05650950643461694588e-04f,
-         4.98490363622070692395e-04f,
-         4.91182291401325650700e-04f,
-         4.83731627940122419548e-04f,
-         4.76143283697776802978e-04f,
-         4.68422183132952726740e-04f,
-         4.60573262220249240485e-04f,
-         4.52601465985464203410e-04f,
-         4.44511746060588389465e-04f,
-         4.36309058259498746754e-04f,
-         4.27998360175392566791e-04f,
-         4.19584608800889610671e-04f,
-         4.11072758171783069880e-04f,
-         4.02467757035333936928e-04f,
-         3.93774546544049656484e-04f,
-         3.84998057975832470683e-04f,
-         3.76143210481313700240e-04f,
-         3.67214908859312392543e-04f,
-         3.58218041361136620669e-04f,
-         3.49157477524604336044e-04f,
-         3.40038066038525694287e-04f,
-         3.30864632638427479810e-04f,
-         3.21641978034209344382e-04f,
-         3.12374875870502510550e-04f,
-         3.03068070720368721877e-04f,
-         2.93726276113044930307e-04f,
-         2.84354172596324122988e-04f,
-         2.74956405834251703824e-04f,
-         2.65537584740686090270e-04f,
-         2.56102279649332684359e-04f,
-         2.46655020520732712157e-04f,
-         2.37200295186851598233e-04f,
-         2.27742547633623577692e-04f,
-         2.18286176322046336163e-04f,
-         2.08835532548216017655e-04f,
-         1.99394918842769620351e-04f,
-         1.89968587410093434423e-04f,
-         1.80560738607737464008e-04f,
-         1.71175519466368710516e-04f,
-         1.61817022250571095152e-04f,
-         1.52489283060860649410e-04f,
-         1.43196280477158617963e-04f,
-         1.33941934244020521144e-04f,
-         1.24730103997818122337e-04f,
-         1.15564588036148766046e-04f,
-         1.06449122129624024050e-04f,
-         9.73873783762444747338e-05f,
-         8.83829640984437603628e-05f,
-         7.94394207830501368397e-05f,
-         7.05602230641164422306e-05f,
-         6.17487777488439845697e-05f,
-         5.30084228865277819307e-05f,
-         4.43424268807018922721e-05f,
-         3.57539876443504868529e-05f,
-         2.72462317982963840894e-05f,
-         1.88222139126731892130e-05f,
-         1.04849157914673770899e-05f,
-         2.23724580001398245952e-06f,
-        -5.91796176458841909860e-06f,
-        -1.39779472603022615363e-05f,
-        -2.19400262443108254274e-05f,
-        -2.98015899747312779436e-05f,
-        -3.75601058699388188874e-05f,
-        -4.52131179258346812058e-05f,
-        -5.27582470911579511194e-05f,
-        -6.01931916011169823111e-05f,
-        -6.75157272696155086192e-05f,
-        -7.47237077402686759994e-05f,
-        -8.18150646965978259242e-05f,
-        -8.87878080315813176041e-05f,
-        -9.56400259770174112402e-05f,
-        -1.02369885192932295447e-04f,
-        -1.08975630817447491838e-04f,
-        -1.15455586477445233109e-04f,
-        -1.21808154260462635915e-04f,
-        -1.28031814648165977134e-04f,
-        -1.34125126411867404445e-04f,
-        -1.40086726470483718130e-04f,
-        -1.45915329711446663599e-04f,
-        -1.51609728774925367391e-04f,
-        -1.57168793801964925671e-04f,
-        -1.62591472146915872604e-04f,
-        -1.67876788054762332352e-04f,
-        -1.73023842303760092562e-04f,
-        -1.78031811814023872061e-04f,
-        -1.82899949222519527144e-04f,
-        -1.87627582425063416539e-04f,
-        -1.92214114085866635134e-04f,
-        -1.96659021115234305434e-04f,
-        -2.00961854115964548605e-04f,
-        -2.05122236799067813760e-04f,
-        -2.09139865369424642018e-04f,
-        -2.13014507881963919287e-04f,
-        -2.16746003569016719827e-04f,
-        -2.20334262139455170628e-04f,
-        -2.23779263050288623272e-04f,
-        -2.27081054751326671731e-04f,
-        -2.30239753903598189230e-04f,
-        -2.33255544572162539776e-04f,
-        -2.36128677394024743099e-04f,
-        -2.38859468721759089912e-04f,
-        -2.41448299743606627134e-04f,
-        -2.43895615580664562507e-04f,
-        -2.46201924361897988517e-04f,
-        -2.48367796277648787261e-04f,
-        -2.50393862612362249915e-04f,
-        -2.52280814757210175570e-04f,
-        -2.54029403203337271477e-04f,
-        -2.55640436516424906718e-04f,
-        -2.57114780293308988878e-04f,
-        -2.58453356101321892260e-04f,
-        -2.59657140401130335366e-04f,
-        -2.60727163453730896234e-04f,
-        -2.61664508212373382850e-04f,
-        -2.62470309200077975623e-04f,
-        -2.63145751373508769710e-04f,
-        -2.63692068973905575490e-04f,
-        -2.64110544365773612825e-04f,
-        -2.64402506864084673854e-04f,
-        -2.64569331550674807438e-04f,
-        -2.64612438080565591254e-04f,
-        -2.64533289478916812908e-04f,
-        -2.64333390929326621406e-04f,
-        -2.64014288554176887285e-04f,
-        -2.63577568187730454374e-04f,
-        -2.63024854142685936189e-04f,
-        -2.62357807970878796362e-04f,
-        -2.61578127218826830911e-04f,
-        -2.60687544178804346540e-04f,
-        -2.59687824636131118095e-04f,
-        -2.58580766613355161020e-04f,
-        -2.57368199111998000473e-04f,
-        -2.56051980852535184582e-04f,
-        -2.54633999013272917245e-04f,
-        -2.53116167968770410229e-04f,
-        -2.51500428028467203686e-04f,
-        -2.49788744176148520739e-04f,
-        -2.47983104810888498049e-04f,
-        -2.46085520490098991209e-04f,
-        -2.44098022675305284133e-04f,
-        -2.42022662481256641692e-04f,
-        -2.39861509428983846149e-04f,
-        -2.37616650203396260988e-04f,
-        -2.35290187416002671578e-04f,
-        -2.32884238373345356290e-04f,
-        -2.30400933851706944807e-04f,
-        -2.27842416878660760553e-04f,
-        -2.25210841522004905167e-04f,
-        -2.22508371686640725982e-04f,
-        -2.19737179919906623887e-04f,
-        -2.16899446225907947382e-04f,
-        -2.13997356889345798732e-04f,
-        -2.11033103309352538255e-04f,
-        -2.08008880843819519632e-04f,
-        -2.04926887664708660573e-04f,
-        -2.01789323624807442155e-04f,
-        -1.98598389136399967663e-04f,
-        -1.95356284062287273917e-04f,
-        -1.92065206619610498147e-04f,
-        -1.88727352296894345393e-04f,
-        -1.85344912784731391314e-04f,
-        -1.81920074920499755819e-04f,
-        -1.78455019647530454055e-04f,
-        -1.74951920989073971512e-04f,
-        -1.71412945037461607323e-04f,
-        -1.67840248958807175192e-04f,
-        -1.64235980013589989322e-04f,
-        -1.60602274593463965847e-04f,
-        -1.56941257274607583660e-04f,
-        -1.53255039887926981963e-04f,
-        -1.49545720606400077326e-04f,
-        -1.45815383049865629223e-04f,
-        -1.42066095407511174204e-04f,
-        -1.38299909578337953649e-04f,
-        -1.34518860329830815736e-04f,
-        -1.30724964475093245915e-04f,
-        -1.26920220068654472992e-04f,
-        -1.23106605621173758290e-04f,
-        -1.19286079333219134950e-04f,
-        -1.15460578348350841244e-04f,
-        -1.11632018025632952099e-04f,
-        -1.07802291231779830637e-04f,
-        -1.03973267653065606659e-04f,
-        -1.00146793127148565233e-04f,
-        -9.63246889949230804435e-05f,
-        -9.25087514725346873358e-05f,
-        -8.87007510436452450671e-05f,
-        -8.49024318720545515026e-05f,
-        -8.11155112347393549661e-05f,
-        -7.73416789754019609908e-05f,
-        -7.35825969785674924512e-05f,
-        -6.98398986642887023612e-05f,
-        -6.61151885034750767074e-05f,
-        -6.24100415538899748772e-05f,
-        -5.87260030168200428450e-05f,
-        -5.50645878143974986741e-05f,
-        -5.14272801876128782695e-05f,
-        -4.78155333149380714058e-05f,
-        -4.42307689515766361233e-05f,
-        -4.06743770892715146635e-05f,
-        -3.71477156366324749162e-05f,
-        -3.36521101199027279356e-05f,
-        -3.01888534041130525139e-05f,
-        -2.67592054345224943665e-05f,
-        -2.33643929982665948157e-05f,
-        -2.00056095060906951114e-05f,
-        -1.66840147940797201324e-05f,
-        -1.34007349452439661363e-05f,
-        -1.01568621308437851693e-05f,
-        -6.95345447128813701427e-06f,
-        -3.79153591650250810366e-06f,
-        -6.72096145553293655593e-07f,
-         2.40390951459279597616e-06f,
-         5.43556015137456058426e-06f,
-         8.42196931017640123499e-06f,
-         1.13622850193110927676e-05f,
-         1.42556897966238257746e-05f,
-         1.71014006379341248229e-05f,
-         1.98986689875390831126e-05f,
-         2.26467806909793172563e-05f,
-         2.53450559303131682314e-05f,
-         2.79928491421220740245e-05f,
-         3.05895489185053302676e-05f,
-         3.31345778912925430443e-05f,
-         3.56273925997451632237e-05f,
-         3.80674833419947510364e-05f,
-         4.04543740105068599521e-05f,
-         4.27876219118044463113e-05f,
-         4.50668175707753267513e-05f,
-         4.72915845198089502860e-05f,
-         4.94615790730713200283e-05f,
-         5.15764900862005805371e-05f,
-         5.36360387017334339240e-05f,
-         5.56399780805481871900e-05f,
-         5.75880931196438774090e-05f,
-         5.94802001565561985590e-05f,
-         6.13161466607366493955e-05f,
-         6.30958109121965409621e-05f,
-         6.48191016677504891876e-05f,
-         6.64859578151715343739e-05f,
-         6.80963480156043240521e-05f,
-         6.96502703345347587470e-05f,
-         7.11477518616810702089e-05f,
-         7.25888483201263885920e-05f,
-         7.39736436650163245096e-05f,
-         7.53022496721903708853e-05f,
-         7.65748055170595645635e-05f,
-         7.77914773440878826866e-05f,
-         7.89524578272120806021e-05f,
-         8.00579657215541123884e-05f,
-         8.11082454067584148567e-05f,
-         8.21035664223097817662e-05f,
-         8.30442229951717527346e-05f,
-         8.39305335600990616227e-05f,
-         8.47628402729624154692e-05f,
-         8.55415085174379832356e-05f,
-         8.62669264054029689666e-05f,
-         8.69395042713942022743e-05f,
-         8.75596741614536786501e-05f,
-         8.81278893167311284636e-05f,
-         8.86446236521661512422e-05f,
-         8.91103712306026604075e-05f,
-         8.95256457326717546962e-05f,
-         8.98909799227875892661e-05f,
-         9.02069251115862640782e-05f,
-         9.04740506151490363976e-05f,
-         9.06929432113401867103e-05f,
-         9.08642065935940279782e-05f,
-         9.09884608224771455898e-05f,
-         9.10663417753510066833e-05f,
-         9.10985005944656069544e-05f,
-         9.10856031337957275460e-05f,
-         9.10283294049456589850e-05f,
-         9.09273730224310103125e-05f,
-         9.07834406486567112131e-05f,
-         9.05972514388884682737e-05f,
-         9.03695364865346147717e-05f,
-         9.01010382690298824038e-05f,
-         8.97925100946232214449e-05f,
-         8.94447155503604388049e-05f,
-         8.90584279515538464710e-05f,
-         8.86344297930203114553e-05f,
-         8.81735122023717546660e-05f,
-         8.76764743956322256668e-05f,
-         8.71441231354561004216e-05f,
-         8.65772721922116491981e-05f,
-         8.59767418081955635050e-05f,
-         8.53433581652348287718e-05f,
-         8.46779528559294970011e-05f,
-         8.39813623587842351167e-05f,
-         8.32544275174723505482e-05f,
-         8.24979930244696123580e-05f,
-         8.17129069092911340059e-05f,
-         8.09000200315580515319e-05f,
-         8.00601855791177764851e-05f,
-         7.91942585714318722121e-05f,
-         7.83030953684469709260e-05f,
-         7.73875531851490379041e-05f,
-         7.64484896120066966278e-05f,
-         7.54867621414943666810e-05f,
-         7.45032277008856680736e-05f,
-         7.34987421914997258445e-05f,
-         7.24741600345781298914e-05f,
-         7.14303337239639759421e-05f,
-         7.03681133857495075701e-05f,
-         6.92883463450485250238e-05f,
-         6.81918767000556897513e-05f,
-         6.70795449035298084342e-05f,
-         6.59521873518545653477e-05f,
-         6.48106359818019012913e-05f,
-         6.36557178751403541801e-05f,
-         6.24882548712000070136e-05f,
-         6.13090631875229413088e-05f,
-         6.01189530487050480105e-05f,
-         5.89187283235398522627e-05f,
-         5.77091861705600261078e-05f,
-         5.64911166920768371556e-05f,
-         5.52653025968012133018e-05f,
-         5.40325188711331935503e-05f,
-         5.27935324591918643858e-05f,
-         5.15491019516612150597e-05f,
-         5.02999772835162253098e-05f,
-         4.90468994406823114189e-05f,
-         4.77906001756943685883e-05f,
-         4.65318017323872241855e-05f,
-         4.52712165796745444508e-05f,
-         4.40095471544385224527e-05f,
-         4.27474856135762158195e-05f,
-         4.14857135952114382585e-05f,
-         4.02249019891050019768e-05f,
-         3.89657107162695045101e-05f,
-         3.77087885178019617646e-05f,
-         3.64547727529321324196e-05f,
-         3.52042892062907349744e-05f,
-         3.39579519043854685862e-05f,
-         3.27163629412759540162e-05f,
-         3.14801123134230239524e-05f,
-         3.02497777637023744978e-05f,
-         2.90259246345387218443e-05f,
-         2.78091057301432964695e-05f,
-         2.65998611878025348972e-05f,
-         2.53987183581919854364e-05f,
-         2.42061916946511448772e-05f,
-         2.30227826513813061706e-05f,
-         2.18489795905047869758e-05f,
-         2.06852576979222047276e-05f,
-         1.95320789079097866306e-05f,
-         1.83898918363816234168e-05f,
-         1.72591317227478167385e-05f,
-         1.61402203802856600485e-05f,
-         1.50335661549492530784e-05f,
-         1.39395638925266073790e-05f,
-         1.28585949140593193966e-05f,
-         1.17910269994264146578e-05f,
-         1.07372143790027249535e-05f,
-         9.69749773328629209753e-06f,
-         8.67220420039572420566e-06f,
-         7.66164739132314657512e-06f,
-         6.66612741284622437347e-06f,
-         5.68593089796976951548e-06f,
-         4.72133104379410701050e-06f,
-         3.77258765668374723169e-06f,
-         2.83994720461857994069e-06f,
-         1.92364287659795633360e-06f,
-         1.02389464897677183691e-06f,
-         1.40909358598783243636e-07f,
-        -7.25119217400925882488e-07f,
-        -1.57401027526573751796e-06f,
-        -2.40559589188401177682e-06f,
-        -3.21972092580435969379e-06f,
-        -4.01624291213239929447e-06f,
-        -4.79503195145223449727e-06f,
-        -5.55597059291959898474e-06f,
-        -6.29895371166915398527e-06f,
-        -7.02388838068995278969e-06f,
-        -7.73069373730662337714e-06f,
-        -8.41930084443043260571e-06f,
-        -9.08965254672049638874e-06f,
-        -9.74170332181420186798e-06f,
-        -1.03754191267770145960e-05f,
-        -1.09907772399306088372e-05f,
-        -1.15877660982095854786e-05f,
-        -1.21663851302071818753e-05f,
-        -1.27266445850638015879e-05f,
-        -1.32685653573596831328e-05f,
-        -1.37921788081646564831e-05f,
-        -1.42975265824070264185e-05f,
-        -1.47846604227169150120e-05f,
-        -1.52536419799077777845e-05f,
-        -1.57045426202454864190e-05f,
-        -1.61374432296745794440e-05f,
-        -1.65524340151509907705e-05f,
-        -1.69496143032443776877e-05f,
-        -1.73290923361651281922e-05f,
-        -1.76909850653765942752e-05f,
-        -1.80354179429455134585e-05f,
-        -1.83625247107888849940e-05f,
-        -1.86724471879742999741e-05f,
-        -1.89653350562250020523e-05f,
-        -1.92413456437866339777e-05f,
-        -1.95006437078064384194e-05f,
-        -1.97434012153796016272e-05f,
-        -1.99697971234102591856e-05f,
-        -2.01800171574394671614e-05f,
-        -2.03742535895865872536e-05f,
-        -2.05527050157544749519e-05f,
-        -2.07155761322383869926e-05f,
-        -2.08630775118898238230e-05f,
-        -2.09954253799722451970e-05f,
-        -2.11128413898529763743e-05f,
-        -2.12155523986690494219e-05f,
-        -2.13037902431062623279e-05f,
-        -2.13777915154254429865e-05f,
-        -2.14377973398712400380e-05f,
-        -2.14840531495946086989e-05f,
-        -2.15168084642204138245e-05f,
-        -2.15363166681862903517e-05f,
-        -2.15428347899803886579e-05f,
-        -2.15366232824005027408e-05f,
-        -2.15179458039577262574e-05f,
-        -2.14870690015422825217e-05f,
-        -2.14442622944694083432e-05f,
-        -2.13897976600211963056e-05f,
-        -2.13239494205938423077e-05f,
-        -2.12469940325636042692e-05f,
-        -2.11592098769767039874e-05f,
-        -2.10608770521689021838e-05f,
-        -2.09522771684173563140e-05f,
-        -2.08336931447246940868e-05f,
-        -2.07054090078323760555e-05f,
-        -2.05677096935581607638e-05f,
-        -2.04208808505498906150e-05f,
-        -2.02652086465450858026e-05f,
-        -2.01009795772225878085e-05f,
-        -1.99284802777307897448e-05f,
-        -1.97479973369733553508e-05f,
-        -1.95598171147313057406e-05f,
-        -1.93642255616965921713e-05f,
-        -1.91615080424908975211e-05f,
-        -1.89519491617392180451e-05f,
-        -1.87358325932659067312e-05f,
-        -1.85134409124775290410e-05f,
-        -1.82850554319945745078e-05f,
-        -1.80509560405904254164e-05f,
-        -1.78114210454942761765e-05f,
-        -1.75667270181107023892e-05f,
-        -1.73171486432067083623e-05f,
-        -1.70629585716134836285e-05f,
-        -1.68044272764881711800e-05f,
-        -1.65418229131769521309e-05f,
-        -1.62754111827191523261e-05f,
-        -1.60054551990284544996e-05f,
-        -1.57322153597849753270e-05f,
-        -1.54559492210684566130e-05f,
-        -1.51769113757617390406e-05f,
-        -1.48953533357483810943e-05f,
-        -1.46115234179280960335e-05f,
-        -1.43256666340692667526e-05f,
-        -1.40380245845161517285e-05f,
-        -1.37488353557644599467e-05f,
-        -1.34583334219182035850e-05f,
-        -1.31667495500361276861e-05f,
-        -1.28743107093750131593e-05f,
-        -1.25812399845332226092e-05f,
-        -1.22877564924967183814e-05f,
-        -1.19940753035859587103e-05f,
-        -1.17004073663007361519e-05f,
-        -1.14069594360560160192e-05f,
-        -1.11139340078022052344e-05f,
-        -1.08215292525168970740e-05f,
-        -1.05299389575568482923e-05f,
-        -1.02393524708539662493e-05f,
-        -9.94995464893742348120e-06f,
-        -9.66192580876271611343e-06f,
-        -9.37544168332491989210e-06f,
-        -9.09067338103246418157e-06f,
-        -8.80778734881422739372e-06f,
-        -8.52694533893248795902e-06f,
-        -8.24830437947059051977e-06f,
-        -7.97201674846333152320e-06f,
-        -7.69822995163491404110e-06f,
-        -7.42708670370925303302e-06f,
-        -7.15872491325360909230e-06f,
-        -6.89327767101633304933e-06f,
-        -6.63087324171573705124e-06f,
-        -6.37163505923899323223e-06f,
-        -6.11568172520321447157e-06f,
-        -5.86312701083429459631e-06f,
-        -5.61407986211404469277e-06f,
-        -5.36864440814655013182e-06f,
-        -5.12691997269171846217e-06f,
-        -4.88900108881444233564e-06f,
-        -4.65497751659457443244e-06f,
-        -4.42493426384305196255e-06f,
-        -4.19895160976678087265e-06f,
-        -3.97710513152554464493e-06f,
-        -3.75946573362158312445e-06f,
-        -3.54609968006129461300e-06f,
-        -3.33706862922910230812e-06f,
-        -3.13242967141053148128e-06f,
-        -2.93223536890220278037e-06f,
-        -2.73653379864365903313e-06f,
-        -2.54536859730841838172e-06f,
-        -2.35877900878616331091e-06f,
-        -2.17679993399191934131e-06f,
-        -1.99946198293410626841e-06f,
-        -1.82679152897453787459e-06f,
-        -1.65881076521146377169e-06f,
-        -1.49553776291791911430e-06f,
-        -1.33698653196547020166e-06f,
-        -1.18316708316432299485e-06f,
-        -1.03408549244911473199e-06f,
-        -8.89743966841013678409e-07f,
-        -7.50140912114827378233e-07f,
-        -6.15271002100918799020e-07f,
-        -4.85125249549975873449e-07f,
-        -3.59691078491283933177e-07f,
-        -2.38952398011216803052e-07f,
-        -1.22889677382464548894e-07f,
+        LSRAC__FILTER_COEFFICIENTS(LSRAC__FILTER_F64)
     },
 };
 
@@ -9,14 +9,24 @@
 */
 
 #define LSRAC_IMPLEMENTATION
+// make test_nostats builds the tests without the stats hooks, as most programs are built
+#ifndef LSRAC_TEST_NO_STATS
+#define LSRAC_ENABLE_STATS
+#endif
 #include "simple_raw_audio_converter.h"
 
 #define DR_WAV_IMPLEMENTATION
 #include "dr_wav.h"
 
-#include <stdio.h>
+#define LSRAC_BATCH_IMPLEMENTATION
+#include "lsrac_batch.h"
+
+#if defined(__linux__)
+#define LSRAC_SERVICE_IMPLEMENTATION
+#include "lsrac_service.h"
+#endif
 
-static const float f32_to_s16 = 32767.0f;      // cast<r32>(SHRT_MAX);
+#include <stdio.h>
 
 static bool is_little_endian() 
 {
@@ -168,9 +178,9 @@ int32_t write_wav_f32(
 
     float * data_samples = reinterpret_cast<float *>(data);
 
-    for (size_t i = 0; i < 2*samples; ++i) {
-        converted_data[i] = static_cast<int16_t>(data_samples[i] * f32_to_s16);
-    }
+    lsrac_output_stage_t output_stage;
+    lsrac_output_stage_init(&output_stage, 1.0f, LSRAC_OUTPUT_DITHER);
+    lsrac_output_stage_process(&output_stage, converted_data, LSRAC_FORMAT_S16, data_samples, samples, 2);
 
     int32_t res = write_wav_s16(
         reinterpret_cast<s16_stereo_sample *>(converted_data), 
@@ -184,6 +194,94 @@ int32_t write_wav_f32(
 }
 
 
+static int32_t test_allocation_count = 0;
+
+static void * test_counting_alloc(void * user_data, size_t size, size_t alignment)
+{
+    (void)user_data;
+    test_allocation_count++;
+    return aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+}
+
+static void test_counting_free(void * user_data, void * ptr)
+{
+    (void)user_data;
+    free(ptr);
+}
+
+struct chunk_to_stream_context {
+    lsrac_stream_t * stream;
+    float *          dst_data;
+    uint64_t         dst_frames;
+    uint64_t         dst_written;
+    uint64_t         samples_seen;
+};
+
+static drwav_bool32 chunk_to_stream(void * user_data, const float * samples, drwav_uint64 sample_count, unsigned int channels, unsigned int sample_rate)
+{
+    (void)sample_rate;
+
+    chunk_to_stream_context * context = static_cast<chunk_to_stream_context *>(user_data);
+
+    uint64_t written = 0;
+    uint64_t read = 0;
+    lsrac_stream_process(
+            context->stream,
+            context->dst_data + context->dst_written * channels, context->dst_frames - context->dst_written, &written,
+            samples,                                             sample_count / channels,                    &read);
+
+    context->dst_written += written;
+    context->samples_seen += sample_count;
+
+    return read == sample_count / channels;
+}
+
+// Counts the samples handed over and stops reading at the second chunk
+static drwav_bool32 chunk_stop_at_second(void * user_data, const float * samples, drwav_uint64 sample_count, unsigned int channels, unsigned int sample_rate)
+{
+    (void)samples;
+    (void)channels;
+    (void)sample_rate;
+
+    uint64_t * counts = static_cast<uint64_t *>(user_data);
+    counts[0] += 1;
+    counts[1] += sample_count;
+
+    return counts[0] < 2;
+}
+
+// Builds a wav file of ADPCM blocks of noise with valid headers
+static void make_adpcm_wav(std::vector<uint8_t> & file, uint16_t tag, uint16_t channels, uint32_t block_align, uint32_t block_count, uint32_t * seed)
+{
+    uint32_t header_bytes = tag == DR_WAVE_FORMAT_ADPCM ? 7 : 4;
+    uint32_t data_bytes = block_align * block_count;
+
+    file.assign(48 + data_bytes, 0);
+    uint8_t * p = file.data();
+    uint32_t fields[] = { 36 + data_bytes, 20, data_bytes };
+    memcpy(p + 0, "RIFF", 4); memcpy(p + 4, &fields[0], 4); memcpy(p + 8, "WAVEfmt ", 8); memcpy(p + 16, &fields[1], 4);
+    uint16_t fmt[10] = { tag, channels, 22050 & 0xFFFF, 0, 0, 0, static_cast<uint16_t>(block_align), 4, 2, 0 };
+    memcpy(p + 20, fmt, sizeof(fmt));
+    memcpy(p + 40, "data", 4); memcpy(p + 44, &fields[2], 4);
+
+    for (uint32_t i = 0; i < data_bytes; ++i) {
+        *seed = *seed * 1664525u + 1013904223u;
+        p[48 + i] = static_cast<uint8_t>(*seed >> 24);
+    }
+    for (uint32_t b = 0; b < block_count; ++b) {
+        uint8_t * block = p + 48 + b * block_align;
+        for (uint16_t c = 0; c < channels; ++c) {
+            if (tag == DR_WAVE_FORMAT_ADPCM) {
+                block[c] %= 7;                                  // predictor
+                block[channels + 2 * c + 1] &= 0x0F;            // delta
+            } else {
+                block[header_bytes * c + 2] %= 89;              // step index
+            }
+        }
+    }
+}
+
+
 int main()
 {
     unsigned int channels;
@@ -576,6 +674,2462 @@ int main()
         test_number++;
     }
 
+    {
+        /*
+         *  TEST: chunked stream conversion with caller provided memory
+         */
+
+        lsrac_allocator_t counting_allocator;
+        counting_allocator.alloc     = test_counting_alloc;
+        counting_allocator.free      = test_counting_free;
+        counting_allocator.alignment = 0;
+        counting_allocator.user_data = NULL;
+
+        bool test_ok = true;
+
+        lsrac_plan_t plan;
+        if (lsrac_plan_init(&plan, sample_rate, 48000, channels, &counting_allocator) != LSRAC_RET_VAL_OK) {
+            test_ok = false;
+        }
+
+        uint64_t dst_frames = static_cast<uint64_t>(samples_per_channel) * 48000 / sample_rate + 1;
+
+        float * whole_dst_data = reinterpret_cast<float *>(malloc(dst_frames * channels * sizeof(float)));
+        float * chunked_dst_data = reinterpret_cast<float *>(malloc(dst_frames * channels * sizeof(float)));
+
+        uint64_t whole_written = 0;
+
+        {
+            // Everything in one call, stream memory from the counting allocator
+            lsrac_stream_t stream;
+            if (lsrac_stream_init(&stream, &plan, NULL) != LSRAC_RET_VAL_OK) {
+                test_ok = false;
+            }
+
+            int32_t allocations_before = test_allocation_count;
+
+            uint64_t written = 0;
+            uint64_t read = 0;
+            lsrac_stream_process(&stream, whole_dst_data, dst_frames, &written, sample_data, samples_per_channel, &read);
+            whole_written += written;
+            if (read != static_cast<uint64_t>(samples_per_channel)) {
+                test_ok = false;
+            }
+            lsrac_stream_flush(&stream, whole_dst_data + whole_written * channels, dst_frames - whole_written, &written);
+            whole_written += written;
+
+            if (test_allocation_count != allocations_before) {
+                test_ok = false;
+            }
+
+            lsrac_stream_uninit(&stream);
+        }
+
+        if (whole_written != (static_cast<uint64_t>(samples_per_channel) * plan.dst_rate + plan.src_rate - 1) / plan.src_rate) {
+            test_ok = false;
+        }
+
+        uint64_t chunked_written = 0;
+
+        {
+            // Odd sized chunks, stream memory from a fixed workspace
+            size_t workspace_size = lsrac_stream_workspace_size(&plan);
+            void * workspace = malloc(workspace_size);
+
+            lsrac_arena_t arena;
+            lsrac_arena_init(&arena, workspace, workspace_size);
+            lsrac_allocator_t arena_allocator = lsrac_arena_allocator(&arena);
+
+            lsrac_stream_t stream;
+            if (lsrac_stream_init(&stream, &plan, &arena_allocator) != LSRAC_RET_VAL_OK) {
+                test_ok = false;
+            }
+
+            uint64_t src_position = 0;
+            uint64_t chunk = 1;
+
+            while (src_position < static_cast<uint64_t>(samples_per_channel)) {
+                uint64_t src_count = static_cast<uint64_t>(samples_per_channel) - src_position;
+                if (src_count > chunk) {
+                    src_count = chunk;
+                }
+
+                uint64_t written = 0;
+                uint64_t read = 0;
+                lsrac_stream_process(
+                        &stream,
+                        chunked_dst_data + chunked_written * channels, 7,         &written,
+                        sample_data + src_position * channels,         src_count, &read);
+                chunked_written += written;
+                src_position += read;
+
+                chunk = (chunk * 7 + 3) % 997 + 1;
+            }
+
+            uint64_t written = 0;
+            do {
+                lsrac_stream_flush(&stream, chunked_dst_data + chunked_written * channels, 5, &written);
+                chunked_written += written;
+            } while (written == 5);
+
+            lsrac_stream_uninit(&stream);
+            free(workspace);
+        }
+
+        if (chunked_written != whole_written) {
+            test_ok = false;
+        }
+
+        for (size_t i = 0; i < whole_written * channels && test_ok; ++i) {
+            if (whole_dst_data[i] != chunked_dst_data[i]) {
+                test_ok = false;
+            }
+        }
+
+        {
+            // Constant input gives constant output, including at the edges
+            float src_data[300];
+            float dst_data[2 * ARRAY_COUNT(src_data)];
+
+            for (size_t i = 0; i < ARRAY_COUNT(src_data); ++i) {
+                src_data[i] = 0.5f;
+            }
+
+            uint32_t rates[][2] = { { 16000, 48000 }, { 48000, 16000 }, { 44100, 48000 }, { 48000, 44100 } };
+
+            for (size_t r = 0; r < ARRAY_COUNT(rates); ++r) {
+                lsrac_plan_t constant_plan;
+                lsrac_plan_init(&constant_plan, rates[r][0], rates[r][1], 1, NULL);
+
+                lsrac_stream_t stream;
+                lsrac_stream_init(&stream, &constant_plan, NULL);
+
+                uint64_t written = 0;
+                uint64_t total_written = 0;
+                lsrac_stream_process(&stream, dst_data, ARRAY_COUNT(dst_data), &written, src_data, ARRAY_COUNT(src_data), NULL);
+                total_written += written;
+                lsrac_stream_flush(&stream, dst_data + total_written, ARRAY_COUNT(dst_data) - total_written, &written);
+                total_written += written;
+
+                for (size_t i = 0; i < total_written; ++i) {
+                    if (fabsf(dst_data[i] - 0.5f) > 0.000001f) {
+                        test_ok = false;
+                    }
+                }
+
+                lsrac_stream_uninit(&stream);
+                lsrac_plan_uninit(&constant_plan);
+            }
+        }
+
+        if (test_ok) {
+            printf("Test %d: successful\n", test_number);
+        } else {
+            printf("Test %d: FAIL\n", test_number);
+        }
+
+        test_number++;
+
+        free(whole_dst_data);
+        free(chunked_dst_data);
+        lsrac_plan_uninit(&plan);
+    }
+
+    {
+        /*
+         *  TEST: stream pool matches individual streams
+         */
+
+        const uint32_t pool_streams = 37;
+        const uint32_t block_frames = 160;
+        const uint32_t blocks = 20;
+
+        bool test_ok = true;
+
+        lsrac_plan_t plan;
+        lsrac_plan_init(&plan, 16000, 48000, 1, NULL);
+
+        lsrac_pool_t pool;
+        if (lsrac_pool_init(&pool, &plan, pool_streams, block_frames, NULL) != LSRAC_RET_VAL_OK) {
+            test_ok = false;
+        }
+
+        float * src_data = reinterpret_cast<float *>(malloc(pool_streams * block_frames * blocks * sizeof(float)));
+        uint64_t max_dst_frames = lsrac_pool_max_dst_frames(&pool) * blocks;
+        float * pool_dst_data = reinterpret_cast<float *>(malloc(pool_streams * max_dst_frames * sizeof(float)));
+        float * stream_dst_data = reinterpret_cast<float *>(malloc(max_dst_frames * sizeof(float)));
+
+        for (uint32_t s = 0; s < pool_streams; ++s) {
+            uint32_t index = 0;
+            if (lsrac_pool_add_stream(&pool, &index) != LSRAC_RET_VAL_OK || index != s) {
+                test_ok = false;
+            }
+            for (uint32_t i = 0; i < block_frames * blocks; ++i) {
+                src_data[s * block_frames * blocks + i] = 0.5f * sinf(static_cast<float>(i) * 0.01f * static_cast<float>(s + 1));
+            }
+        }
+
+        uint64_t pool_written = 0;
+
+        for (uint32_t b = 0; b < blocks; ++b) {
+            const float * src_pointers[pool_streams];
+            float * dst_pointers[pool_streams];
+
+            for (uint32_t s = 0; s < pool_streams; ++s) {
+                src_pointers[s] = src_data + s * block_frames * blocks + b * block_frames;
+                dst_pointers[s] = pool_dst_data + s * max_dst_frames + pool_written;
+            }
+
+            uint64_t written = 0;
+            if (lsrac_pool_process_all(&pool, dst_pointers, src_pointers, &written) != LSRAC_RET_VAL_OK) {
+                test_ok = false;
+            }
+            pool_written += written;
+        }
+
+        // The pool starts from silence, individual streams from a truncated filter
+        uint64_t warm_up = 3 * plan.half_width;
+
+        for (uint32_t s = 0; s < pool_streams && test_ok; ++s) {
+            lsrac_stream_t stream;
+            lsrac_stream_init(&stream, &plan, NULL);
+
+            uint64_t written = 0;
+            lsrac_stream_process(&stream, stream_dst_data, max_dst_frames, &written, src_data + s * block_frames * blocks, block_frames * blocks, NULL);
+
+            if (written != pool_written) {
+                test_ok = false;
+            }
+
+            for (uint64_t i = warm_up; i < written && i < pool_written; ++i) {
+                if (fabsf(stream_dst_data[i] - pool_dst_data[s * max_dst_frames + i]) > 0.00001f) {
+                    test_ok = false;
+                }
+            }
+
+            lsrac_stream_uninit(&stream);
+        }
+
+        if (lsrac_pool_remove_stream(&pool, 3) != LSRAC_RET_VAL_OK ||
+            lsrac_pool_remove_stream(&pool, 3) == LSRAC_RET_VAL_OK) {
+            test_ok = false;
+        }
+
+        if (test_ok) {
+            printf("Test %d: successful\n", test_number);
+        } else {
+            printf("Test %d: FAIL\n", test_number);
+        }
+
+        test_number++;
+
+        free(src_data);
+        free(pool_dst_data);
+        free(stream_dst_data);
+        lsrac_pool_uninit(&pool);
+
+        // Streams start from silence, edge policies that need the first frames are refused
+        uint32_t refused_edges[] = { LSRAC_EDGE_REFLECT, LSRAC_EDGE_CLAMP };
+        for (size_t k = 0; k < ARRAY_COUNT(refused_edges); ++k) {
+            lsrac_plan_set_edge(&plan, refused_edges[k]);
+            if (lsrac_pool_init(&pool, &plan, pool_streams, block_frames, NULL) != LSRAC_RET_VAL_ARGUMENT_ERROR) {
+                test_ok = false;
+            }
+        }
+
+        lsrac_plan_uninit(&plan);
+    }
+
+    {
+        /*
+         *  TEST: dr_wav sample format conversions match the scalar formulas
+         */
+
+        const size_t count = 1037;
+
+        bool test_ok = true;
+
+        drwav_uint8 * bytes = reinterpret_cast<drwav_uint8 *>(malloc(count * 4));
+        float * floats = reinterpret_cast<float *>(malloc(count * sizeof(float)));
+        float * f32_out = reinterpret_cast<float *>(malloc(count * sizeof(float)));
+        drwav_int16 * s16_out = reinterpret_cast<drwav_int16 *>(malloc(count * sizeof(drwav_int16)));
+        drwav_int32 * s32_out = reinterpret_cast<drwav_int32 *>(malloc(count * sizeof(drwav_int32)));
+
+        uint32_t random_state = 12345;
+        for (size_t i = 0; i < count * 4; ++i) {
+            random_state = random_state * 1664525u + 1013904223u;
+            bytes[i] = static_cast<drwav_uint8>(random_state >> 24);
+        }
+        for (size_t i = 0; i < count; ++i) {
+            random_state = random_state * 1664525u + 1013904223u;
+            floats[i] = (static_cast<float>(random_state >> 8) / 8388608.0f - 1.0f) * 1.25f;
+        }
+        floats[0] = -0.0f;
+        floats[1] = 1.0f;
+        floats[2] = -1.0f;
+
+        const drwav_int16 * s16_in = reinterpret_cast<const drwav_int16 *>(bytes);
+        const drwav_int32 * s32_in = reinterpret_cast<const drwav_int32 *>(bytes);
+
+        // Odd start offsets and lengths exercise the unaligned and scalar tail paths
+        for (size_t offset = 0; offset < 3; ++offset) {
+            size_t n = count - 4 - offset * 5;
+
+            drwav_u8_to_f32(f32_out, bytes + offset, n);
+            for (size_t i = 0; i < n; ++i) {
+                if (f32_out[i] != (bytes[offset + i] / 255.0f) * 2 - 1) { test_ok = false; }
+            }
+
+            drwav_s16_to_f32(f32_out, s16_in + offset, n);
+            for (size_t i = 0; i < n; ++i) {
+                if (f32_out[i] != s16_in[offset + i] / 32768.0f) { test_ok = false; }
+            }
+
+            drwav_s24_to_f32(f32_out, bytes + offset * 3, n);
+            drwav_s24_to_s32(s32_out, bytes + offset * 3, n);
+            drwav_s24_to_s16(s16_out, bytes + offset * 3, n);
+            for (size_t i = 0; i < n; ++i) {
+                const drwav_uint8 * b = bytes + (offset + i) * 3;
+                int sample32 = static_cast<int>((static_cast<unsigned int>(b[0]) << 8) | (static_cast<unsigned int>(b[1]) << 16) | (static_cast<unsigned int>(b[2]) << 24));
+                if (f32_out[i] != static_cast<float>(sample32 / 2147483648.0)) { test_ok = false; }
+                if (s32_out[i] != sample32) { test_ok = false; }
+                if (s16_out[i] != static_cast<drwav_int16>(sample32 >> 16)) { test_ok = false; }
+            }
+
+            drwav_s32_to_f32(f32_out, s32_in + offset, n / 4);
+            drwav_s32_to_s16(s16_out, s32_in + offset, n / 4);
+            for (size_t i = 0; i < n / 4; ++i) {
+                if (f32_out[i] != static_cast<float>(s32_in[offset + i] / 2147483648.0)) { test_ok = false; }
+                if (s16_out[i] != static_cast<drwav_int16>(s32_in[offset + i] >> 16)) { test_ok = false; }
+            }
+
+            drwav_u8_to_s16(s16_out, bytes + offset, n);
+            drwav_u8_to_s32(s32_out, bytes + offset, n);
+            for (size_t i = 0; i < n; ++i) {
+                if (s16_out[i] != static_cast<drwav_int16>((bytes[offset + i] - 128) * 256)) { test_ok = false; }
+                if (s32_out[i] != (bytes[offset + i] - 128) * 16777216) { test_ok = false; }
+            }
+
+            drwav_s16_to_s32(s32_out, s16_in + offset, n);
+            for (size_t i = 0; i < n; ++i) {
+                if (s32_out[i] != s16_in[offset + i] * 65536) { test_ok = false; }
+            }
+
+            drwav_f32_to_s16(s16_out, floats + offset, n);
+            drwav_f32_to_s32(s32_out, floats + offset, n);
+            for (size_t i = 0; i < n; ++i) {
+                float x = floats[offset + i];
+                float c = x < -1 ? -1 : (x > 1 ? 1 : x);
+                int scale = signbit(x) ? 32768 : 32767;
+                if (s16_out[i] != static_cast<drwav_int16>(static_cast<int>(c * scale))) { test_ok = false; }
+                if (x >= -1.0f && x < 1.0f && s32_out[i] != static_cast<drwav_int32>(2147483648.0 * x)) { test_ok = false; }
+            }
+
+            drwav_alaw_to_f32(f32_out, bytes + offset, n);
+            drwav_alaw_to_s32(s32_out, bytes + offset, n);
+            drwav_alaw_to_s16(s16_out, bytes + offset, n);
+            for (size_t i = 0; i < n; ++i) {
+                if (f32_out[i] != s16_out[i] / 32768.0f || s32_out[i] != s16_out[i] * 65536) { test_ok = false; }
+            }
+
+            drwav_mulaw_to_f32(f32_out, bytes + offset, n);
+            drwav_mulaw_to_s32(s32_out, bytes + offset, n);
+            drwav_mulaw_to_s16(s16_out, bytes + offset, n);
+            for (size_t i = 0; i < n; ++i) {
+                if (f32_out[i] != s16_out[i] / 32768.0f || s32_out[i] != s16_out[i] * 65536) { test_ok = false; }
+            }
+        }
+
+        if (test_ok) {
+            printf("Test %d: successful\n", test_number);
+        } else {
+            printf("Test %d: FAIL\n", test_number);
+        }
+
+        test_number++;
+
+        free(bytes);
+        free(floats);
+        free(f32_out);
+        free(s16_out);
+        free(s32_out);
+    }
+
+    {
+        /*
+         *  TEST: chunked wav reading straight into a stream
+         */
+
+        bool test_ok = true;
+
+        lsrac_plan_t plan;
+        lsrac_plan_init(&plan, sample_rate, 22050, channels, NULL);
+
+        uint64_t dst_frames = static_cast<uint64_t>(samples_per_channel) * 22050 / sample_rate + 2;
+
+        float * reference_dst_data = reinterpret_cast<float *>(malloc(dst_frames * channels * sizeof(float)));
+        float * chunked_dst_data = reinterpret_cast<float *>(malloc(dst_frames * channels * sizeof(float)));
+
+        uint64_t reference_written = 0;
+
+        {
+            lsrac_stream_t stream;
+            lsrac_stream_init(&stream, &plan, NULL);
+            lsrac_stream_process(&stream, reference_dst_data, dst_frames, &reference_written, sample_data, samples_per_channel, NULL);
+            lsrac_stream_uninit(&stream);
+        }
+
+        {
+            lsrac_stream_t stream;
+            lsrac_stream_init(&stream, &plan, NULL);
+
+            // Odd sized so that it gets rounded down to whole frames
+            float chunk_buffer[1001];
+
+            chunk_to_stream_context context;
+            context.stream       = &stream;
+            context.dst_data     = chunked_dst_data;
+            context.dst_frames   = dst_frames;
+            context.dst_written  = 0;
+            context.samples_seen = 0;
+
+            drwav_uint64 samples_read = 0;
+            if (!drwav_open_and_read_file_chunked_f32("test.wav", chunk_buffer, ARRAY_COUNT(chunk_buffer), chunk_to_stream, &context, &samples_read)) {
+                test_ok = false;
+            }
+
+            if (samples_read != total_sample_count ||
+                context.samples_seen != total_sample_count ||
+                context.dst_written != reference_written) {
+                test_ok = false;
+            }
+
+            for (size_t i = 0; i < reference_written * channels && test_ok; ++i) {
+                if (reference_dst_data[i] != chunked_dst_data[i]) {
+                    test_ok = false;
+                }
+            }
+
+            lsrac_stream_uninit(&stream);
+        }
+
+        // The chunk whose callback stops reading counts as handed over
+        {
+            float chunk_buffer[1000];
+            uint64_t counts[2] = { 0, 0 };
+
+            drwav * wav = drwav_open_file("test.wav");
+            if (wav == NULL ||
+                drwav_read_chunked_f32(wav, chunk_buffer, ARRAY_COUNT(chunk_buffer), chunk_stop_at_second, counts) != counts[1] ||
+                counts[0] != 2) {
+                test_ok = false;
+            }
+            drwav_close(wav);
+        }
+
+        if (test_ok) {
+            printf("Test %d: successful\n", test_number);
+        } else {
+            printf("Test %d: FAIL\n", test_number);
+        }
+
+        test_number++;
+
+        free(reference_dst_data);
+        free(chunked_dst_data);
+        lsrac_plan_uninit(&plan);
+    }
+
+    {
+        /*
+         *  TEST: equal rate copies with all kinds of strides
+         */
+
+        float src_data[9 * 41];
+        float dst_data[9 * 41];
+
+        bool test_ok = true;
+
+        for (size_t i = 0; i < ARRAY_COUNT(src_data); ++i) {
+            src_data[i] = static_cast<float>(i);
+        }
+
+        for (uint64_t src_stride = 1; src_stride <= 9; ++src_stride) {
+            for (uint64_t dst_stride = 1; dst_stride <= 9; ++dst_stride) {
+                for (uint64_t samples = 1; samples <= 41; samples += 4) {
+
+                    for (size_t i = 0; i < ARRAY_COUNT(dst_data); ++i) {
+                        dst_data[i] = -1.0f;
+                    }
+
+                    // The last sample sits at the very end of the source buffer
+                    float * src = src_data + ARRAY_COUNT(src_data) - (samples - 1) * src_stride - 1;
+
+                    int32_t conversion_result = lsrac_convert_audio(
+                            dst_data + 1,                src,
+                            samples,                     samples,
+                            dst_stride * sizeof(float),  src_stride * sizeof(float),
+                            0,                           0);
+                    if (conversion_result != LSRAC_RET_VAL_OK) {
+                        test_ok = false;
+                    }
+
+                    for (size_t i = 0; i + 1 < ARRAY_COUNT(dst_data); ++i) {
+                        bool written = i % dst_stride == 0 && i / dst_stride < samples;
+                        float expected = written ? src[src_stride * (i / dst_stride)] : -1.0f;
+                        if (dst_data[i + 1] != expected) {
+                            test_ok = false;
+                        }
+                    }
+                    if (dst_data[0] != -1.0f) {
+                        test_ok = false;
+                    }
+                }
+            }
+        }
+
+        if (test_ok) {
+            printf("Test %d: successful\n", test_number);
+        } else {
+            printf("Test %d: FAIL\n", test_number);
+        }
+
+        test_number++;
+    }
+
+    {
+        /*
+         *  TEST: planar, interleaved and strided layouts give the same output
+         */
+
+        const uint32_t channels = 3;
+        const uint64_t src_frames = 3000;
+        const uint64_t dst_capacity = 4000;
+
+        lsrac_plan_t plan;
+        lsrac_plan_init(&plan, 44100, 48000, channels, nullptr);
+
+        float * interleaved_src = static_cast<float *>(malloc(sizeof(float) * src_frames * channels));
+        float * planar_src = static_cast<float *>(malloc(sizeof(float) * src_frames * channels));
+        float * reference_dst = static_cast<float *>(malloc(sizeof(float) * dst_capacity * channels));
+        float * strided_dst = static_cast<float *>(malloc(sizeof(float) * dst_capacity * 8));
+
+        for (uint64_t i = 0; i < src_frames; ++i) {
+            for (uint32_t c = 0; c < channels; ++c) {
+                float value = static_cast<float>(sin(0.01 * (c + 1) * static_cast<double>(i)));
+                interleaved_src[i * channels + c] = value;
+                planar_src[c * src_frames + i] = value;
+            }
+        }
+
+        bool test_ok = true;
+
+        lsrac_stream_t stream;
+        lsrac_stream_init(&stream, &plan, nullptr);
+
+        uint64_t reference_written = 0;
+        uint64_t written = 0;
+        lsrac_stream_process(&stream, reference_dst, dst_capacity, &written, interleaved_src, src_frames, nullptr);
+        reference_written += written;
+        lsrac_stream_flush(&stream, reference_dst + reference_written * channels, dst_capacity - reference_written, &written);
+        reference_written += written;
+
+        // Planar input, output with a different stride for every channel
+        lsrac_stream_reset(&stream);
+
+        void * planar_channels[] = { planar_src, planar_src + src_frames, planar_src + 2 * src_frames };
+
+        lsrac_buffer_t src;
+        lsrac_buffer_planar(&src, planar_channels, channels, LSRAC_FORMAT_F32);
+
+        lsrac_buffer_t dst;
+        dst.channels = channels;
+        dst.format = LSRAC_FORMAT_F32;
+        dst.channel_data[0] = strided_dst;                      dst.stride[0] = 1;
+        dst.channel_data[1] = strided_dst + dst_capacity;       dst.stride[1] = 3;
+        dst.channel_data[2] = strided_dst + 4 * dst_capacity;   dst.stride[2] = 4;
+
+        for (size_t i = 0; i < dst_capacity * 8; ++i) {
+            strided_dst[i] = -2.0f;
+        }
+
+        uint64_t strided_written = 0;
+        uint64_t read = 0;
+
+        while (read < src_frames) {
+            uint64_t chunk = src_frames - read < 97 ? src_frames - read : 97;
+            uint64_t chunk_read = 0;
+            if (lsrac_stream_process_buffers(&stream, &dst, dst_capacity - strided_written, &written, &src, chunk, &chunk_read) != LSRAC_RET_VAL_OK) {
+                test_ok = false;
+                break;
+            }
+            lsrac_buffer_advance(&src, chunk_read);
+            lsrac_buffer_advance(&dst, written);
+            read += chunk_read;
+            strided_written += written;
+        }
+        lsrac_stream_flush_buffers(&stream, &dst, dst_capacity - strided_written, &written);
+        strided_written += written;
+
+        if (strided_written != reference_written) {
+            test_ok = false;
+        }
+
+        for (uint64_t i = 0; i < reference_written && test_ok; ++i) {
+            if (strided_dst[i] != reference_dst[i * channels + 0] ||
+                strided_dst[dst_capacity + 3 * i] != reference_dst[i * channels + 1] ||
+                strided_dst[4 * dst_capacity + 4 * i] != reference_dst[i * channels + 2]) {
+                test_ok = false;
+            }
+            // Samples between the strided ones are left alone
+            if (strided_dst[dst_capacity + 3 * i + 1] != -2.0f ||
+                strided_dst[4 * dst_capacity + 4 * i + 3] != -2.0f) {
+                test_ok = false;
+            }
+        }
+
+        if (lsrac_stream_process_buffers(&stream, &dst, 1, nullptr, nullptr, 1, nullptr) != LSRAC_RET_VAL_ARGUMENT_ERROR) {
+            test_ok = false;
+        }
+
+        lsrac_stream_uninit(&stream);
+
+        if (test_ok) {
+            printf("Test %d: successful\n", test_number);
+        } else {
+            printf("Test %d: FAIL\n", test_number);
+        }
+
+        test_number++;
+
+        free(interleaved_src);
+        free(planar_src);
+        free(reference_dst);
+        free(strided_dst);
+        lsrac_plan_uninit(&plan);
+    }
+
+    {
+        /*
+         *  TEST: channel mix inside the resampler matches resampling and mixing afterwards
+         */
+
+        const float downmix_gains[] = {
+            1.0f, 0.0f, 0.7071f, 0.5f, 0.7071f, 0.0f,
+            0.0f, 1.0f, 0.7071f, 0.5f, 0.0f,    0.7071f
+        };
+        const float upmix_gains[] = { 0.8f, -0.6f };
+
+        struct {
+            uint32_t      src_rate;
+            uint32_t      dst_rate;
+            uint32_t      channels;
+            uint32_t      dst_channels;
+            const float * gains;
+            int32_t       mix_first;
+        } cases[] = {
+            { 44100, 48000, 6, 2, downmix_gains, 1 },
+            { 48000, 44100, 1, 2, upmix_gains,   0 },
+        };
+
+        const uint64_t src_frames = 2000;
+        const uint64_t dst_capacity = 2500;
+
+        bool test_ok = true;
+
+        for (size_t k = 0; k < ARRAY_COUNT(cases); ++k) {
+            uint32_t channels = cases[k].channels;
+            uint32_t dst_channels = cases[k].dst_channels;
+
+            float * src = static_cast<float *>(malloc(sizeof(float) * src_frames * channels));
+            float * unmixed = static_cast<float *>(malloc(sizeof(float) * dst_capacity * channels));
+            float * mixed = static_cast<float *>(malloc(sizeof(float) * dst_capacity * dst_channels));
+
+            for (uint64_t i = 0; i < src_frames * channels; ++i) {
+                src[i] = static_cast<float>(sin(0.037 * static_cast<double>(i)));
+            }
+
+            lsrac_plan_t plan;
+            lsrac_plan_init(&plan, cases[k].src_rate, cases[k].dst_rate, channels, nullptr);
+
+            lsrac_stream_t stream;
+            lsrac_stream_init(&stream, &plan, nullptr);
+
+            uint64_t unmixed_written = 0;
+            uint64_t written = 0;
+            lsrac_stream_process(&stream, unmixed, dst_capacity, &written, src, src_frames, nullptr);
+            unmixed_written += written;
+            lsrac_stream_flush(&stream, unmixed + unmixed_written * channels, dst_capacity - unmixed_written, &written);
+            unmixed_written += written;
+
+            lsrac_stream_uninit(&stream);
+
+            if (lsrac_plan_set_mix(&plan, dst_channels, cases[k].gains) != LSRAC_RET_VAL_OK ||
+                plan.mix_first != cases[k].mix_first) {
+                test_ok = false;
+            }
+
+            lsrac_stream_init(&stream, &plan, nullptr);
+
+            uint64_t mixed_written = 0;
+            lsrac_stream_process(&stream, mixed, dst_capacity, &written, src, src_frames, nullptr);
+            mixed_written += written;
+            lsrac_stream_flush(&stream, mixed + mixed_written * dst_channels, dst_capacity - mixed_written, &written);
+            mixed_written += written;
+
+            lsrac_stream_uninit(&stream);
+
+            if (mixed_written != unmixed_written) {
+                test_ok = false;
+            }
+
+            for (uint64_t i = 0; i < mixed_written && test_ok; ++i) {
+                for (uint32_t d = 0; d < dst_channels; ++d) {
+                    float expected = 0.0f;
+                    for (uint32_t c = 0; c < channels; ++c) {
+                        expected += cases[k].gains[d * channels + c] * unmixed[i * channels + c];
+                    }
+                    if (fabsf(expected - mixed[i * dst_channels + d]) > 1e-5f) {
+                        test_ok = false;
+                    }
+                }
+            }
+
+            free(src);
+            free(unmixed);
+            free(mixed);
+            lsrac_plan_uninit(&plan);
+        }
+
+        if (test_ok) {
+            printf("Test %d: successful\n", test_number);
+        } else {
+            printf("Test %d: FAIL\n", test_number);
+        }
+
+        test_number++;
+    }
+
+    {
+        /*
+         *  TEST: output stage, integer output written by the stream and dither/noise shaping
+         */
+
+        const uint32_t channels = 2;
+        const uint64_t src_frames = 1500;
+        const uint64_t dst_capacity = 2000;
+
+        lsrac_plan_t plan;
+        lsrac_plan_init(&plan, 32000, 48000, channels, nullptr);
+
+        float * src = static_cast<float *>(malloc(sizeof(float) * src_frames * channels));
+        float * reference = static_cast<float *>(malloc(sizeof(float) * dst_capacity * channels));
+        int16_t * s16_dst = static_cast<int16_t *>(malloc(sizeof(int16_t) * dst_capacity * channels));
+        uint8_t * s24_dst = static_cast<uint8_t *>(malloc(3 * dst_capacity));
+
+        for (uint64_t i = 0; i < src_frames * channels; ++i) {
+            src[i] = 0.9f * static_cast<float>(sin(0.021 * static_cast<double>(i)));
+        }
+
+        bool test_ok = true;
+
+        lsrac_stream_t stream;
+        lsrac_stream_init(&stream, &plan, nullptr);
+
+        uint64_t reference_written = 0;
+        uint64_t written = 0;
+        lsrac_stream_process(&stream, reference, dst_capacity, &written, src, src_frames, nullptr);
+        reference_written += written;
+        lsrac_stream_flush(&stream, reference + reference_written * channels, dst_capacity - reference_written, &written);
+        reference_written += written;
+
+        // Interleaved s16 with a gain that clips
+        lsrac_stream_reset(&stream);
+        lsrac_stream_set_output(&stream, 2.0f, 0);
+
+        lsrac_buffer_t src_buffer;
+        lsrac_buffer_interleaved(&src_buffer, src, channels, LSRAC_FORMAT_F32);
+
+        lsrac_buffer_t dst_buffer;
+        lsrac_buffer_interleaved(&dst_buffer, s16_dst, channels, LSRAC_FORMAT_S16);
+
+        uint64_t s16_written = 0;
+        lsrac_stream_process_buffers(&stream, &dst_buffer, dst_capacity, &written, &src_buffer, src_frames, nullptr);
+        s16_written += written;
+        lsrac_buffer_advance(&dst_buffer, written);
+        lsrac_stream_flush_buffers(&stream, &dst_buffer, dst_capacity - s16_written, &written);
+        s16_written += written;
+
+        bool clipped = false;
+
+        for (uint64_t i = 0; i < reference_written * channels && test_ok; ++i) {
+            float expected = floorf(reference[i] * 2.0f * 32767.0f + 0.5f);
+            if (expected > 32767.0f) {
+                expected = 32767.0f;
+                clipped = true;
+            } else if (expected < -32767.0f) {
+                expected = -32767.0f;
+                clipped = true;
+            }
+            if (static_cast<float>(s16_dst[i]) != expected) {
+                test_ok = false;
+            }
+        }
+
+        if (s16_written != reference_written || !clipped) {
+            test_ok = false;
+        }
+
+        // Packed 24 bit with only the right channel written through a planar buffer
+        lsrac_stream_reset(&stream);
+        lsrac_stream_set_output(&stream, 1.0f, 0);
+
+        uint8_t discarded[3];
+        dst_buffer.channels = channels;
+        dst_buffer.format = LSRAC_FORMAT_S24;
+        dst_buffer.channel_data[0] = discarded;    dst_buffer.stride[0] = 0;
+        dst_buffer.channel_data[1] = s24_dst;      dst_buffer.stride[1] = 1;
+
+        uint64_t s24_written = 0;
+        lsrac_stream_process_buffers(&stream, &dst_buffer, dst_capacity, &written, &src_buffer, src_frames, nullptr);
+        s24_written += written;
+        lsrac_buffer_advance(&dst_buffer, written);
+        lsrac_stream_flush_buffers(&stream, &dst_buffer, dst_capacity - s24_written, &written);
+        s24_written += written;
+
+        for (uint64_t i = 0; i < s24_written && test_ok; ++i) {
+            int32_t sample = static_cast<int32_t>(static_cast<uint32_t>(s24_dst[3 * i]) << 8 |
+                                                  static_cast<uint32_t>(s24_dst[3 * i + 1]) << 16 |
+                                                  static_cast<uint32_t>(s24_dst[3 * i + 2]) << 24) >> 8;
+            if (static_cast<float>(sample) != floorf(reference[i * channels + 1] * 8388607.0f + 0.5f)) {
+                test_ok = false;
+            }
+        }
+
+        lsrac_stream_uninit(&stream);
+
+        // A constant a fraction of an LSB: dithered output averages to it, and with noise
+        // shaping the running sum of the error stays bounded (no low frequency error).
+        {
+            const size_t count = 48000;
+            const float level = 0.3f / 32767.0f;
+
+            float * constant = static_cast<float *>(malloc(sizeof(float) * count));
+            int16_t * quantized = static_cast<int16_t *>(malloc(sizeof(int16_t) * count));
+
+            for (size_t i = 0; i < count; ++i) {
+                constant[i] = level;
+            }
+
+            lsrac_output_stage_t stage;
+
+            lsrac_output_stage_init(&stage, 1.0f, 0);
+            lsrac_output_stage_process(&stage, quantized, LSRAC_FORMAT_S16, constant, count, 1);
+            for (size_t i = 0; i < count; ++i) {
+                if (quantized[i] != 0) {
+                    test_ok = false;
+                }
+            }
+
+            lsrac_output_stage_init(&stage, 1.0f, LSRAC_OUTPUT_DITHER);
+            lsrac_output_stage_process(&stage, quantized, LSRAC_FORMAT_S16, constant, count, 1);
+            double sum = 0.0;
+            for (size_t i = 0; i < count; ++i) {
+                sum += quantized[i];
+            }
+            if (fabs(sum / count - 0.3) > 0.02) {
+                test_ok = false;
+            }
+
+            lsrac_output_stage_init(&stage, 1.0f, LSRAC_OUTPUT_DITHER | LSRAC_OUTPUT_NOISE_SHAPING);
+            lsrac_output_stage_process(&stage, quantized, LSRAC_FORMAT_S16, constant, count, 1);
+            double error_sum = 0.0;
+            for (size_t i = 0; i < count; ++i) {
+                error_sum += quantized[i] - 0.3;
+                if (fabs(error_sum) > 5.0) {
+                    test_ok = false;
+                }
+            }
+
+            free(constant);
+            free(quantized);
+        }
+
+        if (test_ok) {
+            printf("Test %d: successful\n", test_number);
+        } else {
+            printf("Test %d: FAIL\n", test_number);
+        }
+
+        test_number++;
+
+        free(src);
+        free(reference);
+        free(s16_dst);
+        free(s24_dst);
+        lsrac_plan_uninit(&plan);
+    }
+
+    {
+        /*
+         *  TEST: batch conversion on a work stealing pool, files split into segments
+         */
+
+        const uint64_t small_frames = 5000;
+
+        int16_t * small_data = static_cast<int16_t *>(malloc(sizeof(int16_t) * 2 * small_frames));
+        for (uint64_t i = 0; i < 2 * small_frames; ++i) {
+            small_data[i] = static_cast<int16_t>(20000.0 * sin(0.05 * static_cast<double>(i)));
+        }
+        write_wav_s16(reinterpret_cast<s16_stereo_sample *>(small_data), small_frames, "test_batch_in.wav", 22050);
+        free(small_data);
+
+        lsrac_batch_job_t jobs[3];
+        memset(jobs, 0, sizeof(jobs));
+
+        jobs[0].src_path   = "test.wav";
+        jobs[0].dst_path   = "test_batch_1.wav";
+        jobs[0].dst_rate   = 44100;
+        jobs[0].dst_format = LSRAC_FORMAT_F32;
+        jobs[0].gain       = 1.0f;
+
+        jobs[1].src_path   = "test_batch_in.wav";
+        jobs[1].dst_path   = "test_batch_2.wav";
+        jobs[1].dst_rate   = 48000;
+        jobs[1].dst_format = LSRAC_FORMAT_S16;
+        jobs[1].gain       = 0.5f;
+
+        jobs[2].src_path   = "test_batch_missing.wav";
+        jobs[2].dst_path   = "test_batch_3.wav";
+        jobs[2].dst_rate   = 48000;
+        jobs[2].dst_format = LSRAC_FORMAT_S16;
+        jobs[2].gain       = 1.0f;
+
+        lsrac_batch_options_t options;
+        lsrac_batch_default_options(&options);
+        options.threads        = 4;
+        options.segment_frames = 20000;
+        options.chunk_frames   = 4096;
+
+        lsrac_batch_stats_t stats;
+        int32_t batch_result = lsrac_batch_run(jobs, ARRAY_COUNT(jobs), &options, &stats);
+
+        bool test_ok = batch_result == LSRAC_RET_VAL_ERROR &&
+                       jobs[0].result == LSRAC_RET_VAL_OK &&
+                       jobs[1].result == LSRAC_RET_VAL_OK &&
+                       jobs[2].result != LSRAC_RET_VAL_OK &&
+                       jobs[0].segments > 10 &&
+                       stats.jobs_ok == 2 &&
+                       stats.jobs_failed == 1 &&
+                       stats.src_frames == jobs[0].src_frames + jobs[1].src_frames;
+
+        for (size_t k = 0; k < 2 && test_ok; ++k) {
+            unsigned int src_channels;
+            unsigned int src_rate;
+            drwav_uint64 src_samples;
+            float * src = drwav_open_and_read_file_f32(jobs[k].src_path, &src_channels, &src_rate, &src_samples);
+
+            // The same conversion in one pass through a single stream
+            lsrac_plan_t plan;
+            lsrac_plan_init(&plan, src_rate, jobs[k].dst_rate, src_channels, nullptr);
+
+            lsrac_stream_t stream;
+            lsrac_stream_init(&stream, &plan, nullptr);
+            lsrac_stream_set_output(&stream, jobs[k].gain, 0);
+
+            uint64_t src_frames = src_samples / src_channels;
+            uint64_t dst_capacity = src_frames * jobs[k].dst_rate / src_rate + 16;
+            float * reference = static_cast<float *>(malloc(sizeof(float) * dst_capacity * src_channels));
+
+            uint64_t reference_written = 0;
+            uint64_t written = 0;
+            lsrac_stream_process(&stream, reference, dst_capacity, &written, src, src_frames, nullptr);
+            reference_written += written;
+            lsrac_stream_flush(&stream, reference + reference_written * src_channels, dst_capacity - reference_written, &written);
+            reference_written += written;
+
+            lsrac_stream_uninit(&stream);
+            lsrac_plan_uninit(&plan);
+
+            unsigned int dst_channels;
+            unsigned int dst_rate;
+            drwav_uint64 dst_samples;
+
+            if (jobs[k].dst_format == LSRAC_FORMAT_F32) {
+                float * dst = drwav_open_and_read_file_f32(jobs[k].dst_path, &dst_channels, &dst_rate, &dst_samples);
+                if (dst == nullptr || dst_samples != reference_written * src_channels || dst_rate != jobs[k].dst_rate) {
+                    test_ok = false;
+                }
+                for (uint64_t i = 0; i < dst_samples && test_ok; ++i) {
+                    if (dst[i] != reference[i]) {
+                        test_ok = false;
+                    }
+                }
+                drwav_free(dst);
+            } else {
+                int16_t * expected = static_cast<int16_t *>(malloc(sizeof(int16_t) * reference_written * src_channels));
+                lsrac_output_stage_t stage;
+                lsrac_output_stage_init(&stage, 1.0f, 0);
+                lsrac_output_stage_process(&stage, expected, LSRAC_FORMAT_S16, reference, reference_written, src_channels);
+
+                int16_t * dst = drwav_open_and_read_file_s16(jobs[k].dst_path, &dst_channels, &dst_rate, &dst_samples);
+                if (dst == nullptr || dst_samples != reference_written * src_channels || dst_rate != jobs[k].dst_rate) {
+                    test_ok = false;
+                }
+                for (uint64_t i = 0; i < dst_samples && test_ok; ++i) {
+                    if (dst[i] != expected[i]) {
+                        test_ok = false;
+                    }
+                }
+                drwav_free(dst);
+                free(expected);
+            }
+
+            if (jobs[k].dst_frames != reference_written) {
+                test_ok = false;
+            }
+
+            free(reference);
+            drwav_free(src);
+        }
+
+        if (test_ok) {
+            printf("Test %d: successful (%.1f Mframes/s, %d tasks, %d stolen)\n",
+                   test_number, stats.frames_per_second * 1e-6, static_cast<int>(stats.tasks), static_cast<int>(stats.steals));
+        } else {
+            printf("Test %d: FAIL\n", test_number);
+        }
+
+        test_number++;
+    }
+
+    {
+        /*
+         *  TEST: quality presets shorten the filter and stay close to the full filter
+         */
+
+        const uint64_t src_frames = 8000;
+        const uint64_t dst_capacity = 9000;
+        const float max_error[] = { 0.0f, 2e-4f, 2e-3f, 2e-2f, 2e-2f };
+
+        float * src = static_cast<float *>(malloc(sizeof(float) * src_frames));
+        float * reference = static_cast<float *>(malloc(sizeof(float) * dst_capacity));
+        float * dst = static_cast<float *>(malloc(sizeof(float) * dst_capacity));
+
+        for (uint64_t i = 0; i < src_frames; ++i) {
+            src[i] = static_cast<float>(0.8 * sin(2.0 * 3.14159265358979 * 1000.0 * static_cast<double>(i) / 44100.0));
+        }
+
+        bool test_ok = true;
+        int32_t previous_half_width = 0;
+        uint64_t reference_written = 0;
+
+        for (uint32_t quality = LSRAC_QUALITY_BEST; quality <= LSRAC_QUALITY_PREVIEW; ++quality) {
+            lsrac_plan_t plan;
+            lsrac_plan_init(&plan, 44100, 48000, 1, nullptr);
+
+            if (lsrac_plan_set_quality(&plan, quality) != LSRAC_RET_VAL_OK ||
+                (quality != LSRAC_QUALITY_BEST && plan.half_width >= previous_half_width)) {
+                test_ok = false;
+            }
+            previous_half_width = plan.half_width;
+
+            lsrac_stream_t stream;
+            lsrac_stream_init(&stream, &plan, nullptr);
+
+            float * out = quality == LSRAC_QUALITY_BEST ? reference : dst;
+
+            uint64_t total = 0;
+            uint64_t written = 0;
+            lsrac_stream_process(&stream, out, dst_capacity, &written, src, src_frames, nullptr);
+            total += written;
+            lsrac_stream_flush(&stream, out + total, dst_capacity - total, &written);
+            total += written;
+
+            if (quality == LSRAC_QUALITY_BEST) {
+                reference_written = total;
+            } else if (total != reference_written) {
+                test_ok = false;
+            }
+
+            // Away from the edges, where the truncated filters differ the most
+            for (uint64_t i = 200; i + 200 < total && quality != LSRAC_QUALITY_BEST; ++i) {
+                if (fabsf(out[i] - reference[i]) > max_error[quality]) {
+                    test_ok = false;
+                }
+            }
+
+            lsrac_stream_uninit(&stream);
+            lsrac_plan_uninit(&plan);
+        }
+
+        if (test_ok) {
+            printf("Test %d: successful\n", test_number);
+        } else {
+            printf("Test %d: FAIL\n", test_number);
+        }
+
+        test_number++;
+
+        free(src);
+        free(reference);
+        free(dst);
+    }
+
+#if defined(__linux__)
+    {
+        /*
+         *  TEST: conversions through the local service, end to end over its socket
+         */
+
+        const char * socket_path = "test_service.sock";
+
+        lsrac_service_t service;
+        bool test_ok = lsrac_service_start(&service, socket_path, 2) == LSRAC_RET_VAL_OK;
+
+        struct {
+            uint32_t src_rate;
+            uint32_t dst_rate;
+            uint32_t channels;
+            uint32_t quality;
+        } cases[] = {
+            { 44100, 48000, 2, LSRAC_QUALITY_BEST },
+            { 48000, 16000, 1, LSRAC_QUALITY_MEDIUM },
+            { 8000,  44100, 3, LSRAC_QUALITY_FAST },
+        };
+
+        const uint64_t src_frames = 3000;
+
+        // Three clients at once, each running every case twice (the second time with
+        // a warm plan, and through the copying convenience call)
+        std::atomic<int> failures(0);
+        std::vector<std::thread> clients;
+
+        for (int c = 0; c < 3 && test_ok; ++c) {
+            clients.emplace_back([&, c] {
+                lsrac_client_t client;
+                if (lsrac_client_connect(&client, socket_path) != LSRAC_RET_VAL_OK) {
+                    failures++;
+                    return;
+                }
+
+                for (int round = 0; round < 2; ++round) {
+                    for (size_t k = 0; k < ARRAY_COUNT(cases); ++k) {
+                        uint32_t channels = cases[k].channels;
+                        uint64_t dst_capacity = src_frames * cases[k].dst_rate / cases[k].src_rate + 16;
+
+                        std::vector<float> src(src_frames * channels);
+                        for (size_t i = 0; i < src.size(); ++i) {
+                            src[i] = static_cast<float>(sin(0.01 * (c + 1) * static_cast<double>(i)));
+                        }
+
+                        // Local reference
+                        lsrac_plan_t plan;
+                        lsrac_plan_init(&plan, cases[k].src_rate, cases[k].dst_rate, channels, nullptr);
+                        lsrac_plan_set_quality(&plan, cases[k].quality);
+
+                        lsrac_stream_t stream;
+                        lsrac_stream_init(&stream, &plan, nullptr);
+
+                        std::vector<float> reference(dst_capacity * channels);
+                        uint64_t reference_written = 0;
+                        uint64_t written = 0;
+                        lsrac_stream_process(&stream, reference.data(), dst_capacity, &written, src.data(), src_frames, nullptr);
+                        reference_written += written;
+                        lsrac_stream_flush(&stream, reference.data() + reference_written * channels, dst_capacity - reference_written, &written);
+                        reference_written += written;
+
+                        lsrac_stream_uninit(&stream);
+
+                        std::vector<float> result(dst_capacity * channels);
+                        uint64_t dst_frames = 0;
+                        int32_t conversion_result;
+
+                        if (round == 0) {
+                            float * shared_src;
+                            float * shared_dst;
+                            lsrac_client_reserve(&client, src_frames, dst_capacity, channels, &shared_src, &shared_dst);
+                            memcpy(shared_src, src.data(), sizeof(float) * src.size());
+                            conversion_result = lsrac_client_convert_reserved(
+                                    &client, cases[k].src_rate, cases[k].dst_rate, channels, cases[k].quality,
+                                    src_frames, dst_capacity, &dst_frames);
+                            memcpy(result.data(), shared_dst, sizeof(float) * dst_frames * channels);
+                        } else {
+                            conversion_result = lsrac_client_convert(
+                                    &client, cases[k].src_rate, cases[k].dst_rate, channels, cases[k].quality,
+                                    src.data(), src_frames, result.data(), dst_capacity, &dst_frames);
+                        }
+
+                        if (conversion_result != LSRAC_RET_VAL_OK ||
+                            dst_frames != reference_written ||
+                            dst_frames != lsrac_plan_dst_frames(&plan, src_frames) ||
+                            memcmp(result.data(), reference.data(), sizeof(float) * dst_frames * channels) != 0) {
+                            failures++;
+                        }
+
+                        // Output that does not fit the destination is refused, not cut off
+                        if (round == 0 &&
+                            lsrac_client_convert_reserved(&client, cases[k].src_rate, cases[k].dst_rate, channels, cases[k].quality,
+                                                          src_frames, dst_frames - 1, &dst_frames) != LSRAC_RET_VAL_ARGUMENT_ERROR) {
+                            failures++;
+                        }
+
+                        lsrac_plan_uninit(&plan);
+                    }
+                }
+
+                // Requests that do not fit the shared memory are refused
+                uint64_t dst_frames = 0;
+                if (lsrac_client_convert_reserved(&client, 44100, 48000, 2, LSRAC_QUALITY_BEST, 1ull << 40, 16, &dst_frames) != LSRAC_RET_VAL_ARGUMENT_ERROR) {
+                    failures++;
+                }
+
+                // Memory the client could still shrink is refused: a plain file cannot be sealed
+                if (c == 0) {
+                    const char * unsealed_path = "test_service_unsealed.bin";
+                    int unsealed = open(unsealed_path, O_RDWR | O_CREAT | O_TRUNC, 0600);
+                    unlink(unsealed_path);
+
+                    lsrac_client_reserve(&client, 100, 200, 1, nullptr, nullptr);
+
+                    int sealed = client.memory_fd;
+                    client.memory_fd = unsealed;
+                    client.memory_shared = 0;
+
+                    if (unsealed < 0 ||
+                        ftruncate(unsealed, static_cast<off_t>(client.memory_size)) != 0 ||
+                        lsrac_client_convert_reserved(&client, 44100, 48000, 1, LSRAC_QUALITY_BEST, 100, 200, &dst_frames) != LSRAC_RET_VAL_ARGUMENT_ERROR) {
+                        failures++;
+                    }
+
+                    // The sealed memory is accepted again
+                    client.memory_fd = sealed;
+                    client.memory_shared = 0;
+                    if (lsrac_client_convert_reserved(&client, 44100, 48000, 1, LSRAC_QUALITY_BEST, 100, 200, &dst_frames) != LSRAC_RET_VAL_OK) {
+                        failures++;
+                    }
+
+                    if (unsealed >= 0) {
+                        close(unsealed);
+                    }
+                }
+
+                lsrac_client_disconnect(&client);
+            });
+        }
+
+        for (std::thread & client : clients) {
+            client.join();
+        }
+
+        if (failures.load() != 0) {
+            test_ok = false;
+        }
+
+        lsrac_service_stop(&service);
+        unlink(socket_path);
+
+        if (test_ok) {
+            printf("Test %d: successful\n", test_number);
+        } else {
+            printf("Test %d: FAIL\n", test_number);
+        }
+
+        test_number++;
+    }
+#endif
+
+    {
+        /*
+         *  TEST: phase tables give the same output as computing every phase
+         */
+
+        bool test_ok = true;
+
+        uint32_t rates[][2] = { { 44100, 48000 }, { 48000, 44100 }, { 8000, 44100 }, { 48000, 16000 } };
+
+        for (size_t r = 0; r < ARRAY_COUNT(rates) && test_ok; ++r) {
+            lsrac_plan_t plan;
+            lsrac_plan_init(&plan, rates[r][0], rates[r][1], 2, nullptr);
+
+            if (plan.phases == nullptr) {
+                test_ok = false;
+                break;
+            }
+
+            const uint64_t src_frames = 5000;
+            uint64_t dst_capacity = src_frames * rates[r][1] / rates[r][0] + 16;
+
+            std::vector<float> src(src_frames * 2);
+            for (size_t i = 0; i < src.size(); ++i) {
+                src[i] = static_cast<float>(sin(0.003 * static_cast<double>(i * i % 7919)));
+            }
+
+            std::vector<float> outputs[2];
+
+            for (int pass = 0; pass < 2; ++pass) {
+                // The second pass hides the table, as plans with long periods have none
+                lsrac_phase_t * phases = plan.phases;
+                if (pass == 1) {
+                    plan.phases = nullptr;
+                }
+
+                lsrac_stream_t stream;
+                lsrac_stream_init(&stream, &plan, nullptr);
+
+                std::vector<float> & out = outputs[pass];
+                out.resize(dst_capacity * 2);
+
+                uint64_t total = 0;
+                uint64_t written = 0;
+                for (uint64_t offset = 0; offset < src_frames; offset += 777) {
+                    uint64_t count = std::min<uint64_t>(777, src_frames - offset);
+                    lsrac_stream_process(&stream, out.data() + total * 2, dst_capacity - total, &written, src.data() + offset * 2, count, nullptr);
+                    total += written;
+                }
+                lsrac_stream_flush(&stream, out.data() + total * 2, dst_capacity - total, &written);
+                total += written;
+                out.resize(total * 2);
+
+                lsrac_stream_uninit(&stream);
+
+                plan.phases = phases;
+            }
+
+            if (outputs[0].size() != outputs[1].size() ||
+                memcmp(outputs[0].data(), outputs[1].data(), sizeof(float) * outputs[0].size()) != 0) {
+                test_ok = false;
+            }
+
+            lsrac_plan_uninit(&plan);
+        }
+
+        {
+            // A period of 44101 output frames is too long to tabulate
+            lsrac_plan_t plan;
+            lsrac_plan_init(&plan, 44100, 44101, 1, nullptr);
+            if (plan.phases != nullptr) {
+                test_ok = false;
+            }
+            lsrac_plan_uninit(&plan);
+        }
+
+        if (test_ok) {
+            printf("Test %d: successful\n", test_number);
+        } else {
+            printf("Test %d: FAIL\n", test_number);
+        }
+
+        test_number++;
+    }
+
+    {
+        /*
+         *  TEST: rate based conversion of separate ranges, in parallel, lines up with one pass
+         */
+
+        bool test_ok = true;
+
+        const uint32_t src_rate = 44100;
+        const uint32_t dst_rate = 48000;
+        const uint32_t channels = 2;
+        const uint64_t src_total = 30011;
+
+        std::vector<float> src(src_total * channels);
+        for (size_t i = 0; i < src.size(); ++i) {
+            src[i] = static_cast<float>(sin(0.0021 * static_cast<double>(i)) * cos(0.00007 * static_cast<double>(i)));
+        }
+
+        lsrac_plan_t plan;
+        lsrac_plan_init(&plan, src_rate, dst_rate, channels, nullptr);
+
+        uint64_t dst_total = lsrac_plan_dst_frames(&plan, src_total);
+
+        // Reference: one stream over everything
+        std::vector<float> reference(dst_total * channels);
+        {
+            lsrac_stream_t stream;
+            lsrac_stream_init(&stream, &plan, nullptr);
+
+            uint64_t written = 0;
+            uint64_t flushed = 0;
+            lsrac_stream_process(&stream, reference.data(), dst_total, &written, src.data(), src_total, nullptr);
+            lsrac_stream_flush(&stream, reference.data() + written * channels, dst_total - written, &flushed);
+
+            if (written + flushed != dst_total) {
+                test_ok = false;
+            }
+
+            lsrac_stream_uninit(&stream);
+        }
+
+        // Uneven ranges, each converted from a copy of just the source frames it needs
+        uint64_t bounds[] = { 0, 7001, 7002, 19999, dst_total };
+        std::vector<float> result(dst_total * channels);
+        std::atomic<int> failures(0);
+        std::vector<std::thread> threads;
+
+        for (size_t r = 0; r + 1 < ARRAY_COUNT(bounds); ++r) {
+            threads.emplace_back([&, r] {
+                uint64_t dst_first = bounds[r];
+                uint64_t dst_frames = bounds[r + 1] - bounds[r];
+
+                uint64_t src_first;
+                uint64_t src_end;
+                lsrac_plan_src_window(&plan, dst_first, dst_frames, &src_first, &src_end);
+                src_end = std::min(src_end, src_total);
+
+                std::vector<float> window(src.begin() + static_cast<ptrdiff_t>(src_first * channels),
+                                          src.begin() + static_cast<ptrdiff_t>(src_end * channels));
+
+                if (lsrac_convert_rates(result.data() + dst_first * channels, window.data(),
+                                        dst_rate, src_rate, dst_first, src_first,
+                                        dst_frames, src_end - src_first, src_total, channels) != LSRAC_RET_VAL_OK) {
+                    failures++;
+                }
+            });
+        }
+
+        for (std::thread & thread : threads) {
+            thread.join();
+        }
+
+        if (failures.load() != 0 ||
+            memcmp(result.data(), reference.data(), sizeof(float) * result.size()) != 0) {
+            test_ok = false;
+        }
+
+        // The same ranges out of order through one stream in an arena the size of its
+        // workspace, which a second allocation would overflow
+        {
+            size_t workspace_size = lsrac_stream_workspace_size(&plan);
+            void * workspace = malloc(workspace_size);
+
+            lsrac_arena_t arena;
+            lsrac_arena_init(&arena, workspace, workspace_size);
+            lsrac_allocator_t arena_allocator = lsrac_arena_allocator(&arena);
+
+            lsrac_stream_t stream;
+            if (lsrac_stream_init(&stream, &plan, &arena_allocator) != LSRAC_RET_VAL_OK) {
+                test_ok = false;
+            }
+
+            std::fill(result.begin(), result.end(), 0.0f);
+
+            size_t order[] = { 2, 0, 3, 1 };
+            for (size_t k = 0; k < ARRAY_COUNT(order) && test_ok; ++k) {
+                uint64_t dst_first = bounds[order[k]];
+                uint64_t dst_frames = bounds[order[k] + 1] - dst_first;
+
+                if (lsrac_stream_convert(&stream, result.data() + dst_first * channels, src.data(), dst_first, 0,
+                                         dst_frames, src_total, src_total) != LSRAC_RET_VAL_OK) {
+                    test_ok = false;
+                }
+            }
+
+            if (memcmp(result.data(), reference.data(), sizeof(float) * result.size()) != 0) {
+                test_ok = false;
+            }
+
+            lsrac_stream_uninit(&stream);
+            free(workspace);
+        }
+
+        // Too little source, and a range past the end
+        if (lsrac_plan_convert(&plan, result.data(), src.data() + 100 * channels, 100, 100, 10, src_total - 100, src_total) != LSRAC_RET_VAL_ARGUMENT_ERROR ||
+            lsrac_plan_convert(&plan, result.data(), src.data(), dst_total, 0, 1, src_total, src_total) != LSRAC_RET_VAL_ARGUMENT_ERROR) {
+            test_ok = false;
+        }
+
+        lsrac_plan_uninit(&plan);
+
+        if (test_ok) {
+            printf("Test %d: successful\n", test_number);
+        } else {
+            printf("Test %d: FAIL\n", test_number);
+        }
+
+        test_number++;
+    }
+
+    {
+        /*
+         *  TEST: edge policies
+         */
+
+        bool test_ok = true;
+
+        // Reflecting is the same as the caller providing the mirrored samples around the source
+        const int32_t extra = 64;
+        const uint64_t src_count = 1000;
+
+        std::vector<float> mirrored(src_count + 2 * extra);
+        for (int64_t i = -extra; i < static_cast<int64_t>(src_count) + extra; ++i) {
+            int64_t j = i < 0 ? -i : i >= static_cast<int64_t>(src_count) ? 2 * static_cast<int64_t>(src_count - 1) - i : i;
+            mirrored[static_cast<size_t>(i + extra)] = static_cast<float>(sin(0.05 * static_cast<double>(j)) + 0.25);
+        }
+
+        std::vector<float> reflected(3000);
+        std::vector<float> provided(3000);
+
+        if (lsrac_convert_audio_edge(reflected.data(), mirrored.data() + extra, 3000, src_count, sizeof(float), sizeof(float), 0, 0, LSRAC_EDGE_REFLECT) != LSRAC_RET_VAL_OK ||
+            lsrac_convert_audio(provided.data(), mirrored.data() + extra, 3000, src_count, sizeof(float), sizeof(float), extra, extra) != LSRAC_RET_VAL_OK ||
+            memcmp(reflected.data(), provided.data(), sizeof(float) * reflected.size()) != 0) {
+            test_ok = false;
+        }
+
+        if (lsrac_convert_audio_edge(reflected.data(), mirrored.data(), 3000, src_count, sizeof(float), sizeof(float), 0, 0, 4) != LSRAC_RET_VAL_ARGUMENT_ERROR) {
+            test_ok = false;
+        }
+
+        // A constant signal stays constant up to the edges, except with zero padding
+        uint32_t edges[] = { LSRAC_EDGE_RENORMALIZE, LSRAC_EDGE_ZERO, LSRAC_EDGE_REFLECT, LSRAC_EDGE_CLAMP };
+
+        for (size_t e = 0; e < ARRAY_COUNT(edges); ++e) {
+            lsrac_plan_t plan;
+            lsrac_plan_init(&plan, 44100, 48000, 1, nullptr);
+            lsrac_plan_set_edge(&plan, edges[e]);
+
+            lsrac_stream_t stream;
+            lsrac_stream_init(&stream, &plan, nullptr);
+
+            std::vector<float> constant(2000, 0.5f);
+            std::vector<float> out(2200);
+
+            uint64_t written = 0;
+            uint64_t flushed = 0;
+            lsrac_stream_process(&stream, out.data(), out.size(), &written, constant.data(), constant.size(), nullptr);
+            lsrac_stream_flush(&stream, out.data() + written, out.size() - written, &flushed);
+
+            uint64_t total = written + flushed;
+            float first = out[0];
+            float last = out[total - 1];
+            float middle = out[total / 2];
+
+            if (fabsf(middle - 0.5f) > 1e-5f) {
+                test_ok = false;
+            }
+
+            if (edges[e] == LSRAC_EDGE_ZERO) {
+                if (first > 0.45f || last > 0.45f) {
+                    test_ok = false;
+                }
+            } else if (fabsf(first - 0.5f) > 1e-5f || fabsf(last - 0.5f) > 1e-5f) {
+                test_ok = false;
+            }
+
+            lsrac_stream_uninit(&stream);
+            lsrac_plan_uninit(&plan);
+        }
+
+        if (test_ok) {
+            printf("Test %d: successful\n", test_number);
+        } else {
+            printf("Test %d: FAIL\n", test_number);
+        }
+
+        test_number++;
+    }
+
+    {
+        /*
+         *  TEST: tiled filtering gives the same output as going frame by frame
+         */
+
+        bool test_ok = true;
+
+        struct {
+            uint32_t src_rate;
+            uint32_t dst_rate;
+            uint32_t channels;
+            uint32_t dst_channels;
+        } cases[] = {
+            { 96000, 8000,  32, 32 },   // long filter, several channel groups
+            { 44100, 48000, 32, 32 },
+            { 22050, 48000, 4,  2 },    // mixed after filtering
+        };
+
+        for (size_t k = 0; k < ARRAY_COUNT(cases) && test_ok; ++k) {
+            lsrac_plan_t plan;
+            lsrac_plan_init(&plan, cases[k].src_rate, cases[k].dst_rate, cases[k].channels, nullptr);
+
+            if (cases[k].dst_channels != cases[k].channels) {
+                std::vector<float> gains(cases[k].dst_channels * cases[k].channels, 0.3f);
+                lsrac_plan_set_mix(&plan, cases[k].dst_channels, gains.data());
+            }
+
+            if (plan.tile_frames < 1 || plan.tile_frames > LSRAC__TILE_MAX_FRAMES || plan.tile_channels < 1) {
+                test_ok = false;
+                break;
+            }
+
+            const uint64_t src_frames = 12000;
+            uint64_t dst_capacity = src_frames * cases[k].dst_rate / cases[k].src_rate + 16;
+
+            std::vector<float> src(src_frames * cases[k].channels);
+            for (size_t i = 0; i < src.size(); ++i) {
+                src[i] = static_cast<float>(0.8 * sin(0.0007 * static_cast<double>(i) * static_cast<double>(i % 13 + 1)));
+            }
+
+            std::vector<int16_t> outputs[2];
+
+            for (int pass = 0; pass < 2; ++pass) {
+                // The second pass goes one frame and all channels at a time
+                uint32_t tile_frames = plan.tile_frames;
+                uint32_t tile_channels = plan.tile_channels;
+                if (pass == 1) {
+                    plan.tile_frames = 1;
+                    plan.tile_channels = LSRAC_MAX_CHANNELS;
+                }
+
+                lsrac_stream_t stream;
+                lsrac_stream_init(&stream, &plan, nullptr);
+                lsrac_stream_set_output(&stream, 1.0f, LSRAC_OUTPUT_DITHER | LSRAC_OUTPUT_NOISE_SHAPING);
+
+                std::vector<int16_t> & out = outputs[pass];
+                out.resize(dst_capacity * cases[k].dst_channels);
+
+                lsrac_buffer_t src_buffer;
+                lsrac_buffer_t dst_buffer;
+                lsrac_buffer_interleaved(&src_buffer, src.data(), cases[k].channels, LSRAC_FORMAT_F32);
+                lsrac_buffer_interleaved(&dst_buffer, out.data(), cases[k].dst_channels, LSRAC_FORMAT_S16);
+
+                uint64_t written = 0;
+                uint64_t flushed = 0;
+                lsrac_stream_process_buffers(&stream, &dst_buffer, dst_capacity, &written, &src_buffer, src_frames, nullptr);
+                lsrac_buffer_advance(&dst_buffer, written);
+                lsrac_stream_flush_buffers(&stream, &dst_buffer, dst_capacity - written, &flushed);
+                out.resize((written + flushed) * cases[k].dst_channels);
+
+                lsrac_stream_uninit(&stream);
+
+                plan.tile_frames = tile_frames;
+                plan.tile_channels = tile_channels;
+            }
+
+            if (outputs[0].size() != outputs[1].size() ||
+                memcmp(outputs[0].data(), outputs[1].data(), sizeof(int16_t) * outputs[0].size()) != 0) {
+                test_ok = false;
+            }
+
+            lsrac_plan_uninit(&plan);
+        }
+
+        if (test_ok) {
+            printf("Test %d: successful\n", test_number);
+        } else {
+            printf("Test %d: FAIL\n", test_number);
+        }
+
+        test_number++;
+    }
+
+    {
+        /*
+         *  TEST: stats count the work of the calling thread
+         */
+
+        bool test_ok = true;
+
+        lsrac_stats_reset();
+
+        lsrac_plan_t plan;
+        lsrac_plan_init(&plan, 44100, 48000, 2, nullptr);
+
+        lsrac_stream_t stream;
+        lsrac_stream_init(&stream, &plan, nullptr);
+
+        const uint64_t src_frames = 4410;
+        const uint64_t dst_capacity = 4900;
+        std::vector<float> src(src_frames * 2, 0.25f);
+        std::vector<float> dst(dst_capacity * 2);
+
+        uint64_t written = 0;
+        uint64_t flushed = 0;
+        lsrac_stream_process(&stream, dst.data(), dst_capacity, &written, src.data(), src_frames, nullptr);
+        lsrac_stream_flush(&stream, dst.data() + written * 2, dst_capacity - written, &flushed);
+
+        lsrac_stats_t stats;
+        lsrac_stats_get(&stats);
+
+#if !defined(LSRAC_ENABLE_STATS)
+        // Without the hooks nothing is counted
+        if (stats.calls != 0 || stats.dst_frames != 0 || stats.interior_taps != 0 || stats.setup_ticks != 0) {
+            test_ok = false;
+        }
+#else
+        if (stats.calls != 2 ||
+            stats.src_frames != src_frames ||
+            stats.dst_frames != written + flushed ||
+            stats.interior_taps < (written + flushed) * 2 ||
+            stats.setup_ticks == 0 ||
+            stats.input_ticks == 0 ||
+            stats.interior_ticks == 0 ||
+            stats.edge_ticks == 0 ||
+            stats.output_ticks == 0) {
+            test_ok = false;
+        }
+
+        // A one channel conversion, its edges renormalized, so no edge taps
+        lsrac_stats_reset();
+        lsrac_convert_audio(dst.data(), src.data(), 480, 441, sizeof(float), sizeof(float), 0, 0);
+        lsrac_stats_get(&stats);
+
+        if (stats.calls != 1 ||
+            stats.src_frames != 441 ||
+            stats.dst_frames != 480 ||
+            stats.interior_taps == 0 ||
+            stats.edge_taps != 0 ||
+            stats.interior_ticks == 0 ||
+            stats.edge_ticks == 0) {
+            test_ok = false;
+        }
+#endif
+
+        // Another thread starts from zero
+        lsrac_stats_t other_stats;
+        std::thread other([&other_stats]() { lsrac_stats_get(&other_stats); });
+        other.join();
+
+        if (other_stats.calls != 0 || other_stats.interior_taps != 0 || other_stats.setup_ticks != 0) {
+            test_ok = false;
+        }
+
+        lsrac_stream_uninit(&stream);
+        lsrac_plan_uninit(&plan);
+
+        if (test_ok) {
+            printf("Test %d: successful\n", test_number);
+        } else {
+            printf("Test %d: FAIL\n", test_number);
+        }
+
+        test_number++;
+    }
+
+    {
+        /*
+         *  TEST: variable speed streams
+         */
+
+        bool test_ok = true;
+
+        const uint64_t src_frames = 9600;
+        std::vector<float> src(src_frames * 2);
+        for (uint64_t i = 0; i < src_frames; ++i) {
+            src[2 * i]     = static_cast<float>(0.8 * sin(2.0 * 3.14159265358979 * 0.01 * static_cast<double>(i)));
+            src[2 * i + 1] = static_cast<float>(0.5 * sin(2.0 * 3.14159265358979 * 0.003 * static_cast<double>(i)));
+        }
+
+        // At speed 1 the output follows a fixed rate stream
+        {
+            lsrac_plan_t plan;
+            lsrac_plan_init(&plan, 44100, 48000, 2, nullptr);
+
+            uint64_t dst_frames = lsrac_plan_dst_frames(&plan, src_frames);
+            std::vector<float> fixed(dst_frames * 2);
+            std::vector<float> variable(dst_frames * 2 + 64);
+
+            lsrac_stream_t stream;
+            lsrac_stream_init(&stream, &plan, nullptr);
+            uint64_t written = 0;
+            uint64_t flushed = 0;
+            lsrac_stream_process(&stream, fixed.data(), dst_frames, &written, src.data(), src_frames, nullptr);
+            lsrac_stream_flush(&stream, fixed.data() + written * 2, dst_frames - written, &flushed);
+            lsrac_stream_uninit(&stream);
+
+            lsrac_vstream_t vstream;
+            lsrac_vstream_init(&vstream, &plan, 2.0f, nullptr);
+            uint64_t v_written = 0;
+            uint64_t v_flushed = 0;
+            lsrac_vstream_process(&vstream, variable.data(), dst_frames + 32, &v_written, src.data(), src_frames, nullptr, nullptr);
+            lsrac_vstream_flush(&vstream, variable.data() + v_written * 2, dst_frames + 32 - v_written, &v_flushed, nullptr);
+            lsrac_vstream_uninit(&vstream);
+
+            if (v_written + v_flushed != dst_frames) {
+                test_ok = false;
+            }
+            for (uint64_t i = 0; i < 2 * dst_frames && test_ok; ++i) {
+                if (fabsf(fixed[i] - variable[i]) > 1e-4f) {
+                    test_ok = false;
+                }
+            }
+
+            lsrac_plan_uninit(&plan);
+        }
+
+        // At speed 2 the cutoff halves: a tone above half the source Nyquist frequency is removed
+        {
+            lsrac_plan_t plan;
+            lsrac_plan_init(&plan, 48000, 48000, 1, nullptr);
+
+            double frequencies[2] = { 0.05, 0.35 };
+            double rms[2] = { 0.0, 0.0 };
+
+            for (int k = 0; k < 2; ++k) {
+                std::vector<float> tone(src_frames);
+                for (uint64_t i = 0; i < src_frames; ++i) {
+                    tone[i] = static_cast<float>(0.5 * sin(2.0 * 3.14159265358979 * frequencies[k] * static_cast<double>(i)));
+                }
+
+                std::vector<float> out(src_frames / 2 + 16);
+
+                lsrac_vstream_t vstream;
+                lsrac_vstream_init(&vstream, &plan, 2.0f, nullptr);
+                lsrac_vstream_set_speed(&vstream, 2.0f, 0);
+                uint64_t written = 0;
+                uint64_t flushed = 0;
+                lsrac_vstream_process(&vstream, out.data(), out.size(), &written, tone.data(), src_frames, nullptr, nullptr);
+                lsrac_vstream_flush(&vstream, out.data() + written, out.size() - written, &flushed, nullptr);
+                lsrac_vstream_uninit(&vstream);
+
+                if (written + flushed != src_frames / 2) {
+                    test_ok = false;
+                }
+
+                for (uint64_t i = 500; i < src_frames / 2 - 500; ++i) {
+                    rms[k] += static_cast<double>(out[i]) * out[i];
+                }
+                rms[k] = sqrt(rms[k] / static_cast<double>(src_frames / 2 - 1000));
+            }
+
+            if (fabs(rms[0] - 0.5 / sqrt(2.0)) > 0.01 || rms[1] > 0.005) {
+                test_ok = false;
+            }
+
+            lsrac_plan_uninit(&plan);
+        }
+
+        // A speed ramp, fed in small chunks, gives the same output as one call and has no jumps
+        {
+            lsrac_plan_t plan;
+            lsrac_plan_init(&plan, 44100, 48000, 2, nullptr);
+
+            std::vector<float> outputs[2];
+
+            for (int pass = 0; pass < 2; ++pass) {
+                std::vector<float> & out = outputs[pass];
+                out.resize(2 * 3 * src_frames);
+
+                lsrac_vstream_t vstream;
+                lsrac_vstream_init(&vstream, &plan, 2.0f, nullptr);
+                lsrac_vstream_set_speed(&vstream, 0.5f, 0);
+                lsrac_vstream_set_speed(&vstream, 2.0f, 6000);
+
+                uint64_t chunk = pass == 0 ? src_frames : 37;
+                uint64_t read_total = 0;
+                uint64_t written_total = 0;
+
+                while (read_total < src_frames) {
+                    uint64_t count = src_frames - read_total < chunk ? src_frames - read_total : chunk;
+                    uint64_t read = 0;
+                    uint64_t written = 0;
+                    lsrac_vstream_process(&vstream, out.data() + 2 * written_total, out.size() / 2 - written_total, &written,
+                                          src.data() + 2 * read_total, count, &read, nullptr);
+                    read_total += read;
+                    written_total += written;
+                }
+
+                uint64_t flushed = 0;
+                lsrac_vstream_flush(&vstream, out.data() + 2 * written_total, out.size() / 2 - written_total, &flushed, nullptr);
+                out.resize(2 * (written_total + flushed));
+
+                if (vstream.speed != 2.0) {
+                    test_ok = false;
+                }
+
+                lsrac_vstream_uninit(&vstream);
+            }
+
+            if (outputs[0].size() != outputs[1].size() ||
+                memcmp(outputs[0].data(), outputs[1].data(), sizeof(float) * outputs[0].size()) != 0) {
+                test_ok = false;
+            }
+
+            // The steepest the 0.01 cycles per frame tone gets at speed 2 and 48 kHz out
+            float max_step = static_cast<float>(0.8 * 2.0 * 3.14159265358979 * 0.01 * 2.0 * 44100.0 / 48000.0) * 1.1f;
+            for (size_t i = 2 * 200; i + 2 < outputs[0].size() - 2 * 200; i += 2) {
+                if (fabsf(outputs[0][i + 2] - outputs[0][i]) > max_step) {
+                    test_ok = false;
+                    break;
+                }
+            }
+
+            lsrac_plan_uninit(&plan);
+        }
+
+        if (test_ok) {
+            printf("Test %d: successful\n", test_number);
+        } else {
+            printf("Test %d: FAIL\n", test_number);
+        }
+
+        test_number++;
+    }
+
+    {
+        /*
+         *  TEST: ranges read from a wav file match a conversion of the whole file
+         */
+
+        bool test_ok = true;
+
+        drwav * wav = drwav_open_file("test_batch_in.wav");
+        if (wav == nullptr) {
+            test_ok = false;
+        } else {
+            uint64_t src_frames = wav->totalSampleCount / wav->channels;
+
+            std::vector<float> src(static_cast<size_t>(wav->totalSampleCount));
+            drwav_read_f32(wav, wav->totalSampleCount, src.data());
+
+            lsrac_plan_t plan;
+            lsrac_plan_init(&plan, wav->sampleRate, 48000, wav->channels, nullptr);
+
+            uint64_t dst_frames = lsrac_plan_dst_frames(&plan, src_frames);
+            std::vector<float> full(dst_frames * 2);
+
+            lsrac_stream_t stream;
+            lsrac_stream_init(&stream, &plan, nullptr);
+            uint64_t written = 0;
+            uint64_t flushed = 0;
+            lsrac_stream_process(&stream, full.data(), dst_frames, &written, src.data(), src_frames, nullptr);
+            lsrac_stream_flush(&stream, full.data() + written * 2, dst_frames - written, &flushed);
+            lsrac_stream_uninit(&stream);
+
+            // Backwards, so every range is a seek; the last one runs past the end
+            uint64_t ranges[][2] = {
+                { dst_frames - 700, 1000 },
+                { 5123, 17 },
+                { 2000, 2500 },
+                { 0, 1 },
+                { 0, dst_frames },
+            };
+
+            std::vector<float> part(dst_frames * 2);
+
+            for (size_t k = 0; k < ARRAY_COUNT(ranges) && test_ok; ++k) {
+                uint64_t read = 0;
+                uint64_t expected = ranges[k][0] + ranges[k][1] <= dst_frames ? ranges[k][1] : dst_frames - ranges[k][0];
+
+                if (lsrac_batch_read_range(wav, &plan, part.data(), ranges[k][0], ranges[k][1], &read) != LSRAC_RET_VAL_OK ||
+                    read != expected ||
+                    memcmp(part.data(), full.data() + 2 * ranges[k][0], sizeof(float) * 2 * read) != 0) {
+                    test_ok = false;
+                }
+            }
+
+            uint64_t read = 1;
+            if (lsrac_batch_read_range(wav, &plan, part.data(), dst_frames, 10, &read) != LSRAC_RET_VAL_OK || read != 0) {
+                test_ok = false;
+            }
+
+            lsrac_plan_uninit(&plan);
+            drwav_close(wav);
+        }
+
+        if (test_ok) {
+            printf("Test %d: successful\n", test_number);
+        } else {
+            printf("Test %d: FAIL\n", test_number);
+        }
+
+        test_number++;
+    }
+
+    {
+        /*
+         *  TEST: seeking ADPCM wav files lands on the same samples as reading from the start
+         */
+
+        bool test_ok = true;
+
+        // IMA and MS ADPCM, mono and stereo
+        uint16_t formats[][2] = {
+            { DR_WAVE_FORMAT_DVI_ADPCM, 1 },
+            { DR_WAVE_FORMAT_DVI_ADPCM, 2 },
+            { DR_WAVE_FORMAT_ADPCM,     1 },
+            { DR_WAVE_FORMAT_ADPCM,     2 },
+        };
+
+        const uint32_t block_align = 256;
+        const uint32_t block_count = 9;
+        uint32_t seed = 12345;
+
+        for (size_t f = 0; f < ARRAY_COUNT(formats) && test_ok; ++f) {
+            std::vector<uint8_t> file;
+            make_adpcm_wav(file, formats[f][0], formats[f][1], block_align, block_count, &seed);
+
+            drwav * wav = drwav_open_memory(file.data(), file.size());
+            if (wav == nullptr) {
+                test_ok = false;
+                break;
+            }
+
+            uint64_t total = wav->totalSampleCount;
+            std::vector<int16_t> all(static_cast<size_t>(total));
+            std::vector<int16_t> part(64);
+
+            if (drwav_read_s16(wav, total, all.data()) != total) {
+                test_ok = false;
+            }
+
+            // Backwards and forwards, within a block and across blocks, on block boundaries
+            uint64_t per_block = total / block_count;
+            uint64_t positions[] = { total - 40, 3, per_block * 4, per_block * 4 + 30, per_block * 4 + 20, per_block - 1, 0, per_block * 7 + 5, total - 1 };
+
+            for (size_t k = 0; k < ARRAY_COUNT(positions) && test_ok; ++k) {
+                uint64_t count = total - positions[k] < part.size() ? total - positions[k] : part.size();
+
+                if (!drwav_seek_to_sample(wav, positions[k]) ||
+                    drwav_read_s16(wav, count, part.data()) != count ||
+                    memcmp(part.data(), all.data() + positions[k], sizeof(int16_t) * count) != 0) {
+                    test_ok = false;
+                }
+            }
+
+            drwav_close(wav);
+        }
+
+        if (test_ok) {
+            printf("Test %d: successful\n", test_number);
+        } else {
+            printf("Test %d: FAIL\n", test_number);
+        }
+
+        test_number++;
+    }
+
+    {
+        /*
+         *  TEST: ADPCM blocks decoded on several threads match the serial decoder
+         */
+
+        bool test_ok = true;
+
+        uint16_t formats[][2] = {
+            { DR_WAVE_FORMAT_DVI_ADPCM, 2 },
+            { DR_WAVE_FORMAT_ADPCM,     1 },
+        };
+
+        uint32_t seed = 777;
+
+        for (size_t f = 0; f < ARRAY_COUNT(formats) && test_ok; ++f) {
+            std::vector<uint8_t> file;
+            make_adpcm_wav(file, formats[f][0], formats[f][1], 512, 300, &seed);
+
+            drwav * wav = drwav_open_memory(file.data(), file.size());
+            if (wav == nullptr) {
+                test_ok = false;
+                break;
+            }
+
+            uint32_t channels = wav->channels;
+            uint64_t total = wav->totalSampleCount;
+            uint64_t block_samples = drwav_samples_per_block(wav);
+
+            std::vector<float> serial(static_cast<size_t>(total));
+            std::vector<float> parallel(static_cast<size_t>(total));
+
+            if (drwav_read_f32(wav, total, serial.data()) != total) {
+                test_ok = false;
+            }
+
+            // Raw blocks decoded by hand
+            std::vector<uint8_t> raw(3 * wav->fmt.blockAlign);
+            std::vector<int16_t> decoded(static_cast<size_t>(3 * block_samples));
+            if (!drwav_seek_to_sample(wav, 5 * block_samples) ||
+                drwav_read_raw_blocks(wav, 3, raw.data()) != 3 ||
+                wav->compressed.iCurrentSample != 8 * block_samples) {
+                test_ok = false;
+            }
+            drwav_decode_blocks_s16(wav, raw.data(), 3, decoded.data());
+            for (size_t i = 0; i < decoded.size() && test_ok; ++i) {
+                if (decoded[i] / 32768.0f != serial[5 * block_samples + i]) {
+                    test_ok = false;
+                }
+            }
+
+            // Starting inside a block and ending inside another, on 4 threads, then reading on
+            uint64_t first = block_samples * 3 / 2 / channels;
+            uint64_t frames = (total - block_samples) / channels - first;
+            if (!drwav_seek_to_sample(wav, first * channels) ||
+                lsrac_batch_read_f32(wav, parallel.data(), frames, 4) != frames ||
+                lsrac_batch_read_f32(wav, parallel.data() + frames * channels, total, 4) != total / channels - first - frames ||
+                memcmp(parallel.data(), serial.data() + first * channels, sizeof(float) * (total - first * channels)) != 0) {
+                test_ok = false;
+            }
+
+            // A file cut half a block short: the parallel read stops where the serial one does
+            std::vector<uint8_t> cut(file.begin(), file.end() - wav->fmt.blockAlign / 2);
+            drwav * cut_wav = drwav_open_memory(cut.data(), cut.size());
+            if (cut_wav == nullptr) {
+                test_ok = false;
+            } else {
+                std::vector<float> cut_serial(static_cast<size_t>(total), -2.0f);
+                std::vector<float> cut_parallel(static_cast<size_t>(total), -2.0f);
+
+                uint64_t serial_frames = drwav_read_f32(cut_wav, total, cut_serial.data()) / channels;
+                if (serial_frames >= total / channels ||
+                    !drwav_seek_to_sample(cut_wav, 0) ||
+                    lsrac_batch_read_f32(cut_wav, cut_parallel.data(), total / channels, 4) != serial_frames ||
+                    memcmp(cut_parallel.data(), cut_serial.data(), sizeof(float) * total) != 0) {
+                    test_ok = false;
+                }
+
+                drwav_close(cut_wav);
+            }
+
+            drwav_close(wav);
+        }
+
+        if (test_ok) {
+            printf("Test %d: successful\n", test_number);
+        } else {
+            printf("Test %d: FAIL\n", test_number);
+        }
+
+        test_number++;
+    }
+
+    {
+        /*
+         *  TEST: double precision conversions follow the float ones, and ranges line up
+         */
+
+        bool test_ok = true;
+
+        // Stereo goes through the channel pairs, mono and the 3 channel remainder add two taps at a time
+        uint32_t channel_counts[] = { 1, 2, 3 };
+        uint32_t qualities[] = { LSRAC_QUALITY_BEST, LSRAC_QUALITY_MEDIUM };
+
+        for (size_t q = 0; q < ARRAY_COUNT(qualities) && test_ok; ++q) {
+            for (size_t k = 0; k < ARRAY_COUNT(channel_counts) && test_ok; ++k) {
+                uint32_t channels = channel_counts[k];
+                uint64_t src_frames = 4410;
+
+                lsrac_plan_t plan;
+                lsrac_plan_init(&plan, 44100, 48000, channels, nullptr);
+                lsrac_plan_set_quality(&plan, qualities[q]);
+                lsrac_plan_set_edge(&plan, k == 1 ? LSRAC_EDGE_REFLECT : LSRAC_EDGE_RENORMALIZE);
+
+                uint64_t dst_frames = lsrac_plan_dst_frames(&plan, src_frames);
+
+                std::vector<double> src64(src_frames * channels);
+                std::vector<float>  src32(src_frames * channels);
+                for (uint64_t i = 0; i < src_frames * channels; ++i) {
+                    src64[i] = 0.9 * sin(0.0131 * static_cast<double>(i / channels) * static_cast<double>(i % channels + 1));
+                    src32[i] = static_cast<float>(src64[i]);
+                }
+
+                std::vector<double> dst64(dst_frames * channels);
+                std::vector<double> part64(dst_frames * channels);
+                std::vector<float>  dst32(dst_frames * channels);
+
+                if (lsrac_plan_convert_f64(&plan, dst64.data(), src64.data(), 0, 0, dst_frames, src_frames, src_frames) != LSRAC_RET_VAL_OK ||
+                    lsrac_plan_convert(&plan, dst32.data(), src32.data(), 0, 0, dst_frames, src_frames, src_frames) != LSRAC_RET_VAL_OK) {
+                    test_ok = false;
+                }
+
+                for (uint64_t i = 0; i < dst_frames * channels && test_ok; ++i) {
+                    if (fabs(dst64[i] - static_cast<double>(dst32[i])) > 1e-4) {
+                        test_ok = false;
+                    }
+                }
+
+                // Ranges converted from just their source window
+                uint64_t ranges[][2] = { { 0, 17 }, { 17, 2000 }, { 2017, dst_frames - 2017 } };
+                for (size_t r = 0; r < ARRAY_COUNT(ranges) && test_ok; ++r) {
+                    uint64_t window_first;
+                    uint64_t window_end;
+                    lsrac_plan_src_window(&plan, ranges[r][0], ranges[r][1], &window_first, &window_end);
+                    window_end = window_end < src_frames ? window_end : src_frames;
+
+                    if (lsrac_plan_convert_f64(&plan, part64.data() + ranges[r][0] * channels, src64.data() + window_first * channels,
+                                               ranges[r][0], window_first, ranges[r][1], window_end - window_first, src_frames) != LSRAC_RET_VAL_OK) {
+                        test_ok = false;
+                    }
+                }
+
+                if (test_ok && memcmp(part64.data(), dst64.data(), sizeof(double) * dst64.size()) != 0) {
+                    test_ok = false;
+                }
+
+                lsrac_plan_uninit(&plan);
+            }
+        }
+
+        // Every channel adds up its taps in the same order, in pairs or on its own
+        {
+            uint64_t src_frames = 3000;
+            uint32_t channel_counts[] = { 1, 2, 3, 5 };
+
+            std::vector<double> mono;
+
+            for (size_t k = 0; k < ARRAY_COUNT(channel_counts) && test_ok; ++k) {
+                uint32_t channels = channel_counts[k];
+
+                lsrac_plan_t plan;
+                lsrac_plan_init(&plan, 48000, 44100, channels, nullptr);
+                uint64_t dst_frames = lsrac_plan_dst_frames(&plan, src_frames);
+
+                std::vector<double> src64(src_frames * channels);
+                for (uint64_t i = 0; i < src_frames * channels; ++i) {
+                    src64[i] = 0.8 * sin(0.021 * static_cast<double>(i / channels));
+                }
+
+                std::vector<double> dst64(dst_frames * channels);
+                if (lsrac_plan_convert_f64(&plan, dst64.data(), src64.data(), 0, 0, dst_frames, src_frames, src_frames) != LSRAC_RET_VAL_OK) {
+                    test_ok = false;
+                }
+
+                if (channels == 1) {
+                    mono = dst64;
+                }
+                for (uint64_t i = 0; i < dst_frames * channels && test_ok; ++i) {
+                    if (memcmp(&dst64[i], &mono[i / channels], sizeof(double)) != 0) {
+                        test_ok = false;
+                    }
+                }
+
+                lsrac_plan_uninit(&plan);
+            }
+        }
+
+        // Prepared plans give the same output without allocating, also after a quality change
+        {
+            lsrac_allocator_t counting_allocator;
+            counting_allocator.alloc     = test_counting_alloc;
+            counting_allocator.free      = test_counting_free;
+            counting_allocator.alignment = 0;
+            counting_allocator.user_data = NULL;
+
+            uint64_t src_frames = 3000;
+            uint32_t channels = 2;
+
+            lsrac_plan_t plan;
+            lsrac_plan_init(&plan, 44100, 48000, channels, &counting_allocator);
+            uint64_t dst_frames = lsrac_plan_dst_frames(&plan, src_frames);
+
+            std::vector<double> src64(src_frames * channels);
+            for (uint64_t i = 0; i < src_frames * channels; ++i) {
+                src64[i] = 0.7 * sin(0.017 * static_cast<double>(i / channels) * static_cast<double>(i % channels + 1));
+            }
+
+            std::vector<double> unprepared(dst_frames * channels);
+            std::vector<double> prepared(dst_frames * channels);
+
+            uint32_t qualities[] = { LSRAC_QUALITY_MEDIUM, LSRAC_QUALITY_BEST };
+            for (size_t q = 0; q < ARRAY_COUNT(qualities) && test_ok; ++q) {
+                lsrac_plan_set_quality(&plan, qualities[q]);
+                lsrac_plan_convert_f64(&plan, unprepared.data(), src64.data(), 0, 0, dst_frames, src_frames, src_frames);
+
+                if (q == 0 && lsrac_plan_prepare_f64(&plan) != LSRAC_RET_VAL_OK) {
+                    test_ok = false;
+                }
+
+                int32_t allocations_before = test_allocation_count;
+                if (lsrac_plan_convert_f64(&plan, prepared.data(), src64.data(), 0, 0, dst_frames, src_frames, src_frames) != LSRAC_RET_VAL_OK ||
+                    test_allocation_count != allocations_before ||
+                    memcmp(prepared.data(), unprepared.data(), sizeof(double) * prepared.size()) != 0) {
+                    test_ok = false;
+                }
+
+                // A single frame lines up with the whole conversion
+                if (test_ok && lsrac_plan_convert_f64(&plan, prepared.data(), src64.data(), 100, 0, 1, src_frames, src_frames) != LSRAC_RET_VAL_OK) {
+                    test_ok = false;
+                }
+                if (test_ok && memcmp(prepared.data(), unprepared.data() + 100 * channels, sizeof(double) * channels) != 0) {
+                    test_ok = false;
+                }
+            }
+
+            lsrac_plan_uninit(&plan);
+        }
+
+        // Away from the edges the double precision output is closer to the ideal sine
+        {
+            uint64_t src_frames = 48000;
+            uint64_t dst_frames = 44100;
+            double step = 0.05;
+
+            std::vector<double> src64(src_frames);
+            std::vector<float>  src32(src_frames);
+            for (uint64_t i = 0; i < src_frames; ++i) {
+                src64[i] = 0.5 * sin(step * static_cast<double>(i));
+                src32[i] = static_cast<float>(src64[i]);
+            }
+
+            std::vector<double> dst64(dst_frames);
+            std::vector<float>  dst32(dst_frames);
+            lsrac_convert_rates_f64(dst64.data(), src64.data(), 44100, 48000, 0, 0, dst_frames, src_frames, src_frames, 1);
+            lsrac_convert_rates(dst32.data(), src32.data(), 44100, 48000, 0, 0, dst_frames, src_frames, src_frames, 1);
+
+            double error64 = 0.0;
+            double error32 = 0.0;
+            for (uint64_t i = 1000; i < dst_frames - 1000; ++i) {
+                double ideal = 0.5 * sin(step * ((static_cast<double>(i) + 0.5) * 48000.0 / 44100.0 - 0.5));
+                error64 = fmax(error64, fabs(dst64[i] - ideal));
+                error32 = fmax(error32, fabs(static_cast<double>(dst32[i]) - ideal));
+            }
+
+            if (!(error64 < error32)) {
+                test_ok = false;
+            }
+        }
+
+        if (test_ok) {
+            printf("Test %d: successful\n", test_number);
+        } else {
+            printf("Test %d: FAIL\n", test_number);
+        }
+
+        test_number++;
+    }
+
+    {
+        /*
+         *  TEST: pairwise and Kahan accumulation are closer to a double precision conversion
+         */
+
+        bool test_ok = true;
+
+        uint64_t src_frames = 8820;
+
+        std::vector<float>  src32(src_frames);
+        std::vector<double> src64(src_frames);
+        uint32_t seed = 1;
+        for (uint64_t i = 0; i < src_frames; ++i) {
+            seed = seed * 1664525u + 1013904223u;
+            src32[i] = static_cast<float>(0.7 * sin(0.01 * static_cast<double>(i)) + 0.2 * (static_cast<double>(seed >> 8) / 16777216.0 - 0.5));
+            src64[i] = src32[i];
+        }
+
+        // 44100 -> 47999 has no phase table, so the taps are computed per frame
+        uint32_t dst_rates[] = { 48000, 47999 };
+
+        for (size_t r = 0; r < ARRAY_COUNT(dst_rates) && test_ok; ++r) {
+            double errors[3] = { 0.0, 0.0, 0.0 };
+
+            for (uint32_t accumulation = LSRAC_ACCUMULATE_SERIAL; accumulation <= LSRAC_ACCUMULATE_KAHAN; ++accumulation) {
+                lsrac_plan_t plan;
+                lsrac_plan_init(&plan, 44100, dst_rates[r], 1, nullptr);
+                if (lsrac_plan_set_accumulation(&plan, accumulation) != LSRAC_RET_VAL_OK) {
+                    test_ok = false;
+                }
+
+                uint64_t dst_frames = lsrac_plan_dst_frames(&plan, src_frames);
+                std::vector<float>  dst32(dst_frames);
+                std::vector<double> dst64(dst_frames);
+
+                if (lsrac_plan_convert(&plan, dst32.data(), src32.data(), 0, 0, dst_frames, src_frames, src_frames) != LSRAC_RET_VAL_OK ||
+                    lsrac_plan_convert_f64(&plan, dst64.data(), src64.data(), 0, 0, dst_frames, src_frames, src_frames) != LSRAC_RET_VAL_OK) {
+                    test_ok = false;
+                }
+
+                for (uint64_t i = 0; i < dst_frames; ++i) {
+                    double error = static_cast<double>(dst32[i]) - dst64[i];
+                    errors[accumulation] += error * error;
+                }
+
+                lsrac_plan_uninit(&plan);
+            }
+
+            if (!(errors[LSRAC_ACCUMULATE_PAIRWISE] < errors[LSRAC_ACCUMULATE_SERIAL]) ||
+                !(errors[LSRAC_ACCUMULATE_KAHAN] < errors[LSRAC_ACCUMULATE_PAIRWISE])) {
+                test_ok = false;
+            }
+        }
+
+        lsrac_plan_t plan;
+        lsrac_plan_init(&plan, 44100, 48000, 1, nullptr);
+        if (lsrac_plan_set_accumulation(&plan, LSRAC_ACCUMULATE_KAHAN + 1) != LSRAC_RET_VAL_ARGUMENT_ERROR ||
+            lsrac_plan_set_accumulation(nullptr, LSRAC_ACCUMULATE_KAHAN) != LSRAC_RET_VAL_ARGUMENT_ERROR) {
+            test_ok = false;
+        }
+        lsrac_plan_uninit(&plan);
+
+        if (test_ok) {
+            printf("Test %d: successful\n", test_number);
+        } else {
+            printf("Test %d: FAIL\n", test_number);
+        }
+
+        test_number++;
+    }
+
+    {
+        /*
+         *  TEST: integer factor upsampling filters whole periods like single frames
+         */
+
+        bool test_ok = true;
+
+        uint32_t src_rates[] = { 24000, 16000, 8000 };     // x2, x3 and x6 to 48000
+        uint32_t qualities[] = { LSRAC_QUALITY_BEST, LSRAC_QUALITY_PREVIEW };
+
+        for (size_t r = 0; r < ARRAY_COUNT(src_rates) && test_ok; ++r) {
+            for (size_t q = 0; q < ARRAY_COUNT(qualities) && test_ok; ++q) {
+                uint32_t channels = 2;
+                uint64_t src_frames = 1000;
+
+                lsrac_plan_t plan;
+                lsrac_plan_init(&plan, src_rates[r], 48000, channels, nullptr);
+                lsrac_plan_set_quality(&plan, qualities[q]);
+
+                if (plan.period_taps == nullptr) {
+                    test_ok = false;
+                }
+
+                std::vector<float>  src(src_frames * channels);
+                std::vector<double> src64(src_frames * channels);
+                for (uint64_t i = 0; i < src_frames * channels; ++i) {
+                    src[i] = static_cast<float>(0.8 * sin(0.07 * static_cast<double>(i / channels) + static_cast<double>(i % channels)));
+                    src64[i] = src[i];
+                }
+
+                uint64_t dst_frames = lsrac_plan_dst_frames(&plan, src_frames);
+                std::vector<float>  whole(dst_frames * channels);
+                std::vector<float>  parts(dst_frames * channels);
+                std::vector<double> whole64(dst_frames * channels);
+
+                if (lsrac_plan_convert(&plan, whole.data(), src.data(), 0, 0, dst_frames, src_frames, src_frames) != LSRAC_RET_VAL_OK ||
+                    lsrac_plan_convert_f64(&plan, whole64.data(), src64.data(), 0, 0, dst_frames, src_frames, src_frames) != LSRAC_RET_VAL_OK) {
+                    test_ok = false;
+                }
+
+                // Ranges that start and end in the middle of periods
+                uint64_t bounds[] = { 0, 1, 8, 301, 1001, dst_frames };
+                for (size_t b = 0; b + 1 < ARRAY_COUNT(bounds) && test_ok; ++b) {
+                    if (lsrac_plan_convert(&plan, parts.data() + bounds[b] * channels, src.data(), bounds[b], 0,
+                                           bounds[b + 1] - bounds[b], src_frames, src_frames) != LSRAC_RET_VAL_OK) {
+                        test_ok = false;
+                    }
+                }
+
+                if (test_ok && memcmp(whole.data(), parts.data(), sizeof(float) * whole.size()) != 0) {
+                    test_ok = false;
+                }
+
+                for (size_t i = 0; i < whole.size() && test_ok; ++i) {
+                    if (fabs(static_cast<double>(whole[i]) - whole64[i]) > 1e-5) {
+                        test_ok = false;
+                    }
+                }
+
+                lsrac_plan_uninit(&plan);
+            }
+        }
+
+        if (test_ok) {
+            printf("Test %d: successful\n", test_number);
+        } else {
+            printf("Test %d: FAIL\n", test_number);
+        }
+
+        test_number++;
+    }
+
     drwav_free(sample_data);
 
     return 0;